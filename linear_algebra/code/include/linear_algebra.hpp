@@ -9,13 +9,17 @@
 #define LINEAR_ALGEBRA_HPP_DEFINED
 
 #include <cstdint>
+#include <cmath>
 #include <algorithm>
 #include <complex>
 #include <initializer_list>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <thread>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 //--------------------------------------------------------------------------------------------------
 //- Namespace alternatives for testing and also for detecting/avoiding ADL issues.  Pick a pair
@@ -31,19 +35,31 @@
 #define USING_STD
 
 //#define LA_USE_VECTOR_ENGINE_ITERATORS
+//#define LA_USE_EXECUTION_POLICIES
+
+#ifdef LA_USE_EXECUTION_POLICIES
+#include <execution>
+#endif
 
 //- Implementation headers.
 //
 #include "linear_algebra/forward_declarations.hpp"
 #include "linear_algebra/private_support.hpp"
 #include "linear_algebra/public_support.hpp"
+#include "linear_algebra/dense_kernels.hpp"
 #include "linear_algebra/vector_iterators.hpp"
 #include "linear_algebra/dynamic_engines.hpp"
+#include "linear_algebra/numa_allocator.hpp"
+#include "linear_algebra/huge_page_allocator.hpp"
 #include "linear_algebra/fixed_size_engines.hpp"
 #include "linear_algebra/column_engine.hpp"
 #include "linear_algebra/row_engine.hpp"
 #include "linear_algebra/transpose_engine.hpp"
 #include "linear_algebra/submatrix_engine.hpp"
+#include "linear_algebra/slice_engine.hpp"
+#include "linear_algebra/diagonal_engine.hpp"
+#include "linear_algebra/strided_engines.hpp"
+#include "linear_algebra/external_engines.hpp"
 #include "linear_algebra/vector.hpp"
 #include "linear_algebra/matrix.hpp"
 #include "linear_algebra/library_aliases.hpp"
@@ -63,6 +79,22 @@
 #include "linear_algebra/multiplication_traits.hpp"
 #include "linear_algebra/multiplication_traits_impl.hpp"
 #include "linear_algebra/operation_traits.hpp"
+#include "linear_algebra/strassen_traits.hpp"
+#include "linear_algebra/semiring_traits.hpp"
 #include "linear_algebra/arithmetic_operators.hpp"
+#include "linear_algebra/elementwise_operations.hpp"
+#include "linear_algebra/spectral_decompositions.hpp"
+#include "linear_algebra/matrix_inverse.hpp"
+#include "linear_algebra/affine_engine.hpp"
+#include "linear_algebra/low_rank_engine.hpp"
+#include "linear_algebra/kronecker_engine.hpp"
+#include "linear_algebra/toeplitz_engines.hpp"
+#include "linear_algebra/tiled_engine.hpp"
+#include "linear_algebra/permutation_engine.hpp"
+#include "linear_algebra/shm_engines.hpp"
+#include "linear_algebra/out_of_core.hpp"
+#include "linear_algebra/scatter_accumulator.hpp"
+#include "linear_algebra/gemv_coalescer.hpp"
+#include "linear_algebra/geometry.hpp"
 
 #endif  //- LINEAR_ALGEBRA_HPP_DEFINED
@@ -0,0 +1,581 @@
+//==================================================================================================
+//  File:       affine_engine.hpp
+//
+//  Summary:    This header defines a 4x4 matrix engine that represents a 3D affine transform,
+//
+//                  [ r00 r01 r02 t0 ]
+//                  [ r10 r11 r12 t1 ]
+//                  [ r20 r21 r22 t2 ]
+//                  [  0   0   0  1  ]
+//
+//              Only the upper three rows are stored; the last row is implicit.  Multiplication
+//              traits specializations are also provided so that products of affine transforms
+//              with each other, with 4-vectors, and with 4xN and Nx4 fixed-size matrices skip the
+//              arithmetic involving the implicit row.  The free functions transform_point() and
+//              transform_direction() apply a transform to a 3-vector, treating it as having an
+//              implicit fourth element of 1 or 0, respectively.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_AFFINE_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_AFFINE_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+//==================================================================================================
+//  Fixed-size affine transform engine.  The engine is readable, but not writable, since the
+//  elements of the last row are not stored; transforms are set by initializer list, or by
+//  assignment from another 4x4 engine.  swap_rows() and swap_columns() require indices in the
+//  upper three rows and the first three columns, respectively.
+//==================================================================================================
+//
+template<class T>
+class affine_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type const&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    //- Construct/copy/destroy
+    //
+    ~affine_engine() noexcept = default;
+
+    constexpr affine_engine();
+    template<class U>
+    constexpr affine_engine(initializer_list<U> list);
+    constexpr affine_engine(affine_engine&&) noexcept = default;
+    constexpr affine_engine(affine_engine const&) = default;
+
+    constexpr affine_engine&    operator =(affine_engine&&) noexcept = default;
+    constexpr affine_engine&    operator =(affine_engine const&) = default;
+    template<class ET2>
+    constexpr affine_engine&    operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    constexpr size_type     columns() const noexcept;
+    constexpr size_type     rows() const noexcept;
+    constexpr size_tuple    size() const noexcept;
+
+    constexpr size_type     column_capacity() const noexcept;
+    constexpr size_type     row_capacity() const noexcept;
+    constexpr size_tuple    capacity() const noexcept;
+
+    //- Element access
+    //
+    constexpr const_reference   operator ()(size_type i, size_type j) const;
+
+    //- Modifiers
+    //
+    constexpr void      swap(affine_engine& rhs) noexcept;
+    constexpr void      swap_columns(size_type j1, size_type j2);
+    constexpr void      swap_rows(size_type i1, size_type i2);
+
+  private:
+    static constexpr T  sa_last_row[4] = { T(0), T(0), T(0), T(1) };
+
+    T   ma_elems[12];
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+//- The default-constructed transform is the identity.
+//
+template<class T> constexpr
+affine_engine<T>::affine_engine()
+:   ma_elems{ T(1), T(0), T(0), T(0),
+              T(0), T(1), T(0), T(0),
+              T(0), T(0), T(1), T(0) }
+{}
+
+//- The list holds the upper three rows in row-major order; any fourth row is ignored.
+//
+template<class T>
+template<class U> constexpr
+affine_engine<T>::affine_engine(initializer_list<U> list)
+:   affine_engine()
+{
+    size_t const    count = std::min((size_t) 12, (size_t) list.size());
+    auto            iter  = list.begin();
+
+    for (size_t i = 0;  i < count;  ++i, ++iter)
+    {
+        ma_elems[i] = static_cast<T>(*iter);
+    }
+}
+
+//- Assignment from a 4x4 engine copies the upper three rows; the source's last row is assumed
+//  to be (0,0,0,1) and is not read.
+//
+template<class T>
+template<class ET2> constexpr
+affine_engine<T>&
+affine_engine<T>::operator =(ET2 const& rhs)
+{
+    using src_size_type = typename ET2::size_type;
+
+    if (static_cast<size_t>(rhs.rows()) != 4  ||  static_cast<size_t>(rhs.columns()) != 4)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    for (size_type i = 0;  i < 3;  ++i)
+    {
+        for (size_type j = 0;  j < 4;  ++j)
+        {
+            ma_elems[i*4 + j] = static_cast<T>(rhs(static_cast<src_size_type>(i),
+                                                   static_cast<src_size_type>(j)));
+        }
+    }
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T> constexpr
+typename affine_engine<T>::size_type
+affine_engine<T>::columns() const noexcept
+{
+    return 4;
+}
+
+template<class T> constexpr
+typename affine_engine<T>::size_type
+affine_engine<T>::rows() const noexcept
+{
+    return 4;
+}
+
+template<class T> constexpr
+typename affine_engine<T>::size_tuple
+affine_engine<T>::size() const noexcept
+{
+    return size_tuple(4, 4);
+}
+
+template<class T> constexpr
+typename affine_engine<T>::size_type
+affine_engine<T>::column_capacity() const noexcept
+{
+    return 4;
+}
+
+template<class T> constexpr
+typename affine_engine<T>::size_type
+affine_engine<T>::row_capacity() const noexcept
+{
+    return 4;
+}
+
+template<class T> constexpr
+typename affine_engine<T>::size_tuple
+affine_engine<T>::capacity() const noexcept
+{
+    return size_tuple(4, 4);
+}
+
+//----------------
+//- Element access
+//
+template<class T> constexpr
+typename affine_engine<T>::const_reference
+affine_engine<T>::operator ()(size_type i, size_type j) const
+{
+    return (i < 3) ? ma_elems[i*4 + j] : sa_last_row[j];
+}
+
+//-----------
+//- Modifiers
+//
+template<class T> constexpr
+void
+affine_engine<T>::swap(affine_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        for (size_t i = 0;  i < 12;  ++i)
+        {
+            detail::la_swap(ma_elems[i], rhs.ma_elems[i]);
+        }
+    }
+}
+
+//- Swapping the translation column, or the implicit last row, would change the meaning of the
+//  last row; such indices throw.
+//
+template<class T> constexpr
+void
+affine_engine<T>::swap_columns(size_type j1, size_type j2)
+{
+    if (j1 >= 3  ||  j2 >= 3)
+    {
+        throw runtime_error("invalid index");
+    }
+    if (j1 != j2)
+    {
+        for (size_t i = 0;  i < 3;  ++i)
+        {
+            detail::la_swap(ma_elems[i*4 + j1], ma_elems[i*4 + j2]);
+        }
+    }
+}
+
+template<class T> constexpr
+void
+affine_engine<T>::swap_rows(size_type i1, size_type i2)
+{
+    if (i1 >= 3  ||  i2 >= 3)
+    {
+        throw runtime_error("invalid index");
+    }
+    if (i1 != i2)
+    {
+        for (size_t j = 0;  j < 4;  ++j)
+        {
+            detail::la_swap(ma_elems[i1*4 + j], ma_elems[i2*4 + j]);
+        }
+    }
+}
+
+//==================================================================================================
+//                            **** AFFINE ENGINE MULTIPLICATION TRAITS ****
+//==================================================================================================
+//  Engine promotion:  affine*affine is affine; affine*(fixed-size 4-vector or 4xN matrix) and
+//  (fixed-size Nx4 matrix)*affine are fixed-size.  All other combinations use the defaults.
+//==================================================================================================
+//
+template<class OT, class T1, class T2>
+struct matrix_multiplication_engine_traits<OT, affine_engine<T1>, affine_engine<T2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = affine_engine<element_type>;
+};
+
+template<class OT, class T1, class T2>
+struct matrix_multiplication_engine_traits<OT, affine_engine<T1>, fs_vector_engine<T2, 4>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_vector_engine<element_type, 4>;
+};
+
+template<class OT, class T1, class T2, size_t C2>
+struct matrix_multiplication_engine_traits<OT, affine_engine<T1>, fs_matrix_engine<T2, 4, C2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_matrix_engine<element_type, 4, C2>;
+};
+
+template<class OT, class T1, size_t R1, class T2>
+struct matrix_multiplication_engine_traits<OT, fs_matrix_engine<T1, R1, 4>, affine_engine<T2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_matrix_engine<element_type, R1, 4>;
+};
+
+//--------------------------------------------------------------------------------------------------
+//  Arithmetic:  products with an affine left-hand operand use only its stored rows, and copy the
+//  last row/element of the right-hand operand through unchanged; products with an affine
+//  right-hand operand add the left-hand operand's last column in place of multiplying it by the
+//  implicit row.
+//--------------------------------------------------------------------------------------------------
+//
+namespace detail {
+//- Makes an affine matrix from the upper three rows of a transform, in row-major order.
+//
+template<class T, class OT>
+constexpr matrix<affine_engine<T>, OT>
+make_affine_matrix(T const (&e)[12])
+{
+    return matrix<affine_engine<T>, OT>{ e[0], e[1], e[2],  e[3],
+                                         e[4], e[5], e[6],  e[7],
+                                         e[8], e[9], e[10], e[11] };
+}
+
+}       //- detail namespace
+
+//- affine*affine:  [R1 t1; 0 1] * [R2 t2; 0 1] = [R1*R2  R1*t2 + t1; 0 1].
+//
+template<class OT, class T1, class OT1, class T2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<affine_engine<T1>, OT1>, matrix<affine_engine<T2>, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, affine_engine<T1>, affine_engine<T2>>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<affine_engine<T1>, OT1>::size_type;
+    using size_type_2 = typename matrix<affine_engine<T2>, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<affine_engine<T1>, OT1> const& m1,
+                                 matrix<affine_engine<T2>, OT2> const& m2);
+};
+
+template<class OT, class T1, class OT1, class T2, class OT2>
+inline auto
+matrix_multiplication_traits<OT, matrix<affine_engine<T1>, OT1>, matrix<affine_engine<T2>, OT2>>::multiply
+(matrix<affine_engine<T1>, OT1> const& m1, matrix<affine_engine<T2>, OT2> const& m2) -> result_type
+{
+    using elem_type = typename result_type::element_type;
+
+    PrintOperandTypes<result_type>("multiplication_traits (affine*affine)", m1, m2);
+
+    elem_type   e[12];
+
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        for (size_t j = 0;  j < 4;  ++j)
+        {
+            elem_type   er = (j == 3) ? m1(i, 3) : 0;
+
+            for (size_t k = 0;  k < 3;  ++k)
+            {
+                er += m1(i, k) * m2(k, j);
+            }
+            e[i*4 + j] = er;
+        }
+    }
+    return detail::make_affine_matrix<elem_type, op_traits>(e);
+}
+
+//- affine*vector:  the first three elements of the result are R*v(0:3) + t*v(3), and the last is
+//  v(3); in particular, points (v(3) == 1) are translated and directions (v(3) == 0) are not.
+//
+template<class OT, class T1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<affine_engine<T1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, affine_engine<T1>, ET2>;
+    using op_traits    = OT;
+    using result_type  = vector<engine_type, op_traits>;
+
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<affine_engine<T1>, OT1> const& m1,
+                                 vector<ET2, OT2> const& v2);
+};
+
+template<class OT, class T1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OT, matrix<affine_engine<T1>, OT1>, vector<ET2, OT2>>::multiply
+(matrix<affine_engine<T1>, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (affine*v)", m1, v2);
+
+    if (static_cast<size_t>(v2.elements()) != 4)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    result_type     vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(static_cast<size_type_r>(4));
+    }
+
+    auto const  x = v2(static_cast<size_type_2>(0));
+    auto const  y = v2(static_cast<size_type_2>(1));
+    auto const  z = v2(static_cast<size_type_2>(2));
+    auto const  w = v2(static_cast<size_type_2>(3));
+
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        vr(static_cast<size_type_r>(i)) = m1(i, 0)*x + m1(i, 1)*y + m1(i, 2)*z + m1(i, 3)*w;
+    }
+    vr(static_cast<size_type_r>(3)) = w;
+
+    return vr;
+}
+
+//- affine*fs_matrix:  each column is transformed as a 4-vector.
+//
+template<class OT, class T1, class OT1, class T2, size_t C2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<affine_engine<T1>, OT1>, matrix<fs_matrix_engine<T2, 4, C2>, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, affine_engine<T1>, fs_matrix_engine<T2, 4, C2>>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<affine_engine<T1>, OT1>::size_type;
+    using size_type_2 = typename matrix<fs_matrix_engine<T2, 4, C2>, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<affine_engine<T1>, OT1> const& m1,
+                                 matrix<fs_matrix_engine<T2, 4, C2>, OT2> const& m2);
+};
+
+template<class OT, class T1, class OT1, class T2, size_t C2, class OT2>
+inline auto
+matrix_multiplication_traits<OT, matrix<affine_engine<T1>, OT1>, matrix<fs_matrix_engine<T2, 4, C2>, OT2>>::multiply
+(matrix<affine_engine<T1>, OT1> const& m1, matrix<fs_matrix_engine<T2, 4, C2>, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (affine*m)", m1, m2);
+
+    result_type     mr;
+
+    for (size_t j = 0;  j < C2;  ++j)
+    {
+        for (size_t i = 0;  i < 3;  ++i)
+        {
+            mr(i, j) = m1(i, 0)*m2(0, j) + m1(i, 1)*m2(1, j) + m1(i, 2)*m2(2, j) + m1(i, 3)*m2(3, j);
+        }
+        mr(3, j) = m2(3, j);
+    }
+    return mr;
+}
+
+//- fs_matrix*affine:  M * [R t; 0 1] = [M(:,0:3)*R  M(:,0:3)*t + M(:,3)].
+//
+template<class OT, class T1, size_t R1, class OT1, class T2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<fs_matrix_engine<T1, R1, 4>, OT1>, matrix<affine_engine<T2>, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, fs_matrix_engine<T1, R1, 4>, affine_engine<T2>>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<fs_matrix_engine<T1, R1, 4>, OT1>::size_type;
+    using size_type_2 = typename matrix<affine_engine<T2>, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<fs_matrix_engine<T1, R1, 4>, OT1> const& m1,
+                                 matrix<affine_engine<T2>, OT2> const& m2);
+};
+
+template<class OT, class T1, size_t R1, class OT1, class T2, class OT2>
+inline auto
+matrix_multiplication_traits<OT, matrix<fs_matrix_engine<T1, R1, 4>, OT1>, matrix<affine_engine<T2>, OT2>>::multiply
+(matrix<fs_matrix_engine<T1, R1, 4>, OT1> const& m1, matrix<affine_engine<T2>, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (m*affine)", m1, m2);
+
+    result_type     mr;
+
+    for (size_t i = 0;  i < R1;  ++i)
+    {
+        for (size_t j = 0;  j < 4;  ++j)
+        {
+            mr(i, j) = m1(i, 0)*m2(0, j) + m1(i, 1)*m2(1, j) + m1(i, 2)*m2(2, j);
+        }
+        mr(i, 3) += m1(i, 3);
+    }
+    return mr;
+}
+
+//==================================================================================================
+//                              **** DETERMINANT AND INVERSE ****
+//==================================================================================================
+//  The determinant of an affine transform is that of its 3x3 block, and its inverse is again an
+//  affine transform.
+//==================================================================================================
+//
+template<class T, class OT>
+auto
+determinant(matrix<affine_engine<T>, OT> const& m) -> T
+{
+    static_assert(is_floating_point_v<T>, "determinant requires floating-point elements");
+
+    return m(0, 0)*(m(1, 1)*m(2, 2) - m(1, 2)*m(2, 1))
+         + m(0, 1)*(m(1, 2)*m(2, 0) - m(1, 0)*m(2, 2))
+         + m(0, 2)*(m(1, 0)*m(2, 1) - m(1, 1)*m(2, 0));
+}
+
+template<class T, class OT>
+auto
+inverse(matrix<affine_engine<T>, OT> const& m) -> matrix<affine_engine<T>, OT>
+{
+    static_assert(is_floating_point_v<T>, "inverse requires floating-point elements");
+
+    T   a[16], b[16], det;
+
+    for (size_t i = 0;  i < 16;  ++i)
+    {
+        a[i] = m(i / 4, i % 4);
+    }
+
+    detail::affine_inverse4_kernel<T, 1>(a, b, &det);
+
+    if (det == T(0))
+    {
+        throw runtime_error("singular matrix");
+    }
+
+    T   e[12];
+
+    copy_n(b, 12, e);
+    return detail::make_affine_matrix<T, OT>(e);
+}
+
+//==================================================================================================
+//                              **** POINT/DIRECTION TRANSFORMS ****
+//==================================================================================================
+//  Applies the affine transform m, which may use any 4x4 engine but whose last row is assumed to
+//  be (0,0,0,1), to a 3-vector v.  transform_point() includes the translation and
+//  transform_direction() does not.  The result has the same type as v.
+//==================================================================================================
+//
+namespace detail {
+
+template<bool Translate, class ET1, class OT1, class ET2, class OT2>
+vector<ET2, OT2>
+affine_transform3(matrix<ET1, OT1> const& m, vector<ET2, OT2> const& v)
+{
+    using size_type_1 = typename matrix<ET1, OT1>::size_type;
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using elem_type   = typename vector<ET2, OT2>::element_type;
+
+    if (static_cast<size_t>(m.rows()) != 4  ||  static_cast<size_t>(m.columns()) != 4  ||
+        static_cast<size_t>(v.elements()) != 3)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    vector<ET2, OT2>    vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(static_cast<size_type_2>(3));
+    }
+
+    elem_type const     x = v(0), y = v(1), z = v(2);
+
+    for (size_type_1 i = 0;  i < 3;  ++i)
+    {
+        elem_type   er = m(i, 0)*x + m(i, 1)*y + m(i, 2)*z;
+
+        if constexpr (Translate)
+        {
+            er += m(i, 3);
+        }
+        vr(static_cast<size_type_2>(i)) = er;
+    }
+    return vr;
+}
+
+}       //- detail namespace
+
+template<class ET1, class OT1, class ET2, class OT2>
+inline vector<ET2, OT2>
+transform_point(matrix<ET1, OT1> const& m, vector<ET2, OT2> const& v)
+{
+    return detail::affine_transform3<true>(m, v);
+}
+
+template<class ET1, class OT1, class ET2, class OT2>
+inline vector<ET2, OT2>
+transform_direction(matrix<ET1, OT1> const& m, vector<ET2, OT2> const& v)
+{
+    return detail::affine_transform3<false>(m, v);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_AFFINE_ENGINE_HPP_DEFINED
@@ -274,6 +274,24 @@ Fill(matrix<ET, OT>& m)
     }
 }
 
+//- Returns the largest absolute element-wise difference between two matrices of the same size.
+//
+template<class ET1, class OT1, class ET2, class OT2>
+double
+MaxAbsDiff(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2)
+{
+    double  diff = 0;
+
+    for (size_t i = 0;  i < (size_t) m1.rows();  ++i)
+    {
+        for (size_t j = 0;  j < (size_t) m1.columns();  ++j)
+        {
+            diff = max(diff, (double) abs(m1(i, j) - m2(i, j)));
+        }
+    }
+    return diff;
+}
+
 }   //- STD_LA namespace
 
 #endif
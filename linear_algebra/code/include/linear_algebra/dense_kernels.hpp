@@ -0,0 +1,544 @@
+//==================================================================================================
+//  File:       dense_kernels.hpp
+//
+//  Summary:    This header defines several private computational kernels that operate directly
+//              on dense, row-major storage described by a pointer and a leading dimension.  They
+//              are the building blocks used by the arithmetic traits and algorithms elsewhere
+//              in the library when an operation is large enough to be worth the bother.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_DENSE_KERNELS_HPP_DEFINED
+#define LINEAR_ALGEBRA_DENSE_KERNELS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Block sizes used by the blocked kernels below.  The row/inner block sizes are chosen so that
+//  a block of A and a panel of B remain resident in L1/L2 for typical element types; the column
+//  block size is a multiple of every common SIMD width.
+//==================================================================================================
+//
+inline constexpr size_t     gemm_row_block   = 64;
+inline constexpr size_t     gemm_inner_block = 128;
+inline constexpr size_t     gemm_col_block   = 256;
+
+//==================================================================================================
+//  Blocked matrix product kernel:  C(m x n) += A(m x k) * B(k x n).  All operands are row-major
+//  with leading dimensions lda, ldb, and ldc, respectively.  The innermost loop runs over unit-
+//  stride rows of B and C, so it is readily vectorized by the compiler.
+//==================================================================================================
+//
+template<class T>
+void
+gemm_kernel(size_t m, size_t n, size_t k,
+            T const* p_a, size_t lda,
+            T const* p_b, size_t ldb,
+            T*       p_c, size_t ldc)
+{
+    for (size_t i0 = 0;  i0 < m;  i0 += gemm_row_block)
+    {
+        size_t const    i1 = min(m, i0 + gemm_row_block);
+
+        for (size_t k0 = 0;  k0 < k;  k0 += gemm_inner_block)
+        {
+            size_t const    k1 = min(k, k0 + gemm_inner_block);
+
+            for (size_t j0 = 0;  j0 < n;  j0 += gemm_col_block)
+            {
+                size_t const    j1 = min(n, j0 + gemm_col_block);
+
+                for (size_t i = i0;  i < i1;  ++i)
+                {
+                    T*  p_ci = p_c + i*ldc;
+
+                    for (size_t kk = k0;  kk < k1;  ++kk)
+                    {
+                        T const     aik  = p_a[i*lda + kk];
+                        T const*    p_bk = p_b + kk*ldb;
+
+                        for (size_t j = j0;  j < j1;  ++j)
+                        {
+                            p_ci[j] += aik * p_bk[j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+//- Overwriting variant:  C(m x n) = A(m x k) * B(k x n).
+//
+template<class T>
+void
+gemm_assign_kernel(size_t m, size_t n, size_t k,
+                   T const* p_a, size_t lda,
+                   T const* p_b, size_t ldb,
+                   T*       p_c, size_t ldc)
+{
+    for (size_t i = 0;  i < m;  ++i)
+    {
+        fill_n(p_c + i*ldc, n, T{});
+    }
+    gemm_kernel(m, n, k, p_a, lda, p_b, ldb, p_c, ldc);
+}
+
+//==================================================================================================
+//  Element-wise kernels on (m x n) row-major blocks:  C = A + B and C = A - B.  The output may
+//  alias either input.
+//==================================================================================================
+//
+template<class T>
+void
+add_kernel(size_t m, size_t n, T const* p_a, size_t lda, T const* p_b, size_t ldb,
+           T* p_c, size_t ldc)
+{
+    for (size_t i = 0;  i < m;  ++i)
+    {
+        T const*    p_ai = p_a + i*lda;
+        T const*    p_bi = p_b + i*ldb;
+        T*          p_ci = p_c + i*ldc;
+
+        for (size_t j = 0;  j < n;  ++j)
+        {
+            p_ci[j] = p_ai[j] + p_bi[j];
+        }
+    }
+}
+
+template<class T>
+void
+sub_kernel(size_t m, size_t n, T const* p_a, size_t lda, T const* p_b, size_t ldb,
+           T* p_c, size_t ldc)
+{
+    for (size_t i = 0;  i < m;  ++i)
+    {
+        T const*    p_ai = p_a + i*lda;
+        T const*    p_bi = p_b + i*ldb;
+        T*          p_ci = p_c + i*ldc;
+
+        for (size_t j = 0;  j < n;  ++j)
+        {
+            p_ci[j] = p_ai[j] - p_bi[j];
+        }
+    }
+}
+
+//==================================================================================================
+//  Transpose kernels.  transpose_kernel() computes B(n x m) = A(m x n)' out of place.  It halves
+//  the larger extent recursively until a leaf fits in L1, so that it is cache-oblivious, and
+//  transposes each leaf in register-sized square tiles, which the compiler turns into in-register
+//  shuffles.  Large transposes are divided among threads by rows of B.
+//
+//  transpose_square_kernel() transposes an (n x n) block in place by exchanging mirrored tiles;
+//  transpose_contiguous_kernel() transposes a contiguous (m x n) array in place, into an (n x m)
+//  one, by following the cycles of the permutation, using one bit of workspace per element.
+//==================================================================================================
+//
+inline constexpr size_t     transpose_tile = 8;
+inline constexpr size_t     transpose_leaf = 64;
+inline constexpr size_t     transpose_parallel_threshold = size_t(1) << 18;
+
+template<class T>
+void
+transpose_leaf_kernel(size_t m, size_t n, T const* p_a, size_t lda, T* p_b, size_t ldb)
+{
+    constexpr size_t    ts = transpose_tile;
+
+    size_t const    mt = m - m % ts;
+    size_t const    nt = n - n % ts;
+
+    for (size_t i0 = 0;  i0 < mt;  i0 += ts)
+    {
+        for (size_t j0 = 0;  j0 < nt;  j0 += ts)
+        {
+            T   tile[ts][ts];
+
+            for (size_t i = 0;  i < ts;  ++i)
+            {
+                for (size_t j = 0;  j < ts;  ++j)
+                {
+                    tile[j][i] = p_a[(i0 + i)*lda + j0 + j];
+                }
+            }
+            for (size_t j = 0;  j < ts;  ++j)
+            {
+                for (size_t i = 0;  i < ts;  ++i)
+                {
+                    p_b[(j0 + j)*ldb + i0 + i] = tile[j][i];
+                }
+            }
+        }
+    }
+
+    //- The partial tiles along the right and bottom edges.
+    //
+    for (size_t i = 0;  i < m;  ++i)
+    {
+        for (size_t j = nt;  j < n;  ++j)
+        {
+            p_b[j*ldb + i] = p_a[i*lda + j];
+        }
+    }
+    for (size_t i = mt;  i < m;  ++i)
+    {
+        for (size_t j = 0;  j < nt;  ++j)
+        {
+            p_b[j*ldb + i] = p_a[i*lda + j];
+        }
+    }
+}
+
+template<class T>
+void
+transpose_recursive_kernel(size_t m, size_t n, T const* p_a, size_t lda, T* p_b, size_t ldb)
+{
+    constexpr size_t    ts = transpose_tile;
+
+    if (m <= transpose_leaf  &&  n <= transpose_leaf)
+    {
+        transpose_leaf_kernel(m, n, p_a, lda, p_b, ldb);
+    }
+    else if (m >= n)
+    {
+        size_t const    mh = (m/2 + ts - 1) / ts * ts;
+
+        transpose_recursive_kernel(mh, n, p_a, lda, p_b, ldb);
+        transpose_recursive_kernel(m - mh, n, p_a + mh*lda, lda, p_b + mh, ldb);
+    }
+    else
+    {
+        size_t const    nh = (n/2 + ts - 1) / ts * ts;
+
+        transpose_recursive_kernel(m, nh, p_a, lda, p_b, ldb);
+        transpose_recursive_kernel(m, n - nh, p_a + nh, lda, p_b + nh*ldb, ldb);
+    }
+}
+
+//- Runs work(k) for k in [0, parts), on parts - 1 new threads and the calling one; if a thread
+//  cannot be started, its part is run by the calling thread.
+//
+template<class F>
+void
+run_parallel_parts(size_t parts, F const& work)
+{
+    std::vector<std::thread>    pool;
+
+    pool.reserve(parts - 1);
+
+    for (size_t k = 1;  k < parts;  ++k)
+    {
+        try
+        {
+            pool.emplace_back(work, k);
+        }
+        catch (...)
+        {
+            work(k);
+        }
+    }
+    work(0);
+
+    for (auto& t : pool)
+    {
+        t.join();
+    }
+}
+
+inline size_t
+transpose_threads(size_t m, size_t n) noexcept
+{
+    if (m*n < transpose_parallel_threshold)
+    {
+        return 1;
+    }
+    return max(size_t(1), min(static_cast<size_t>(std::thread::hardware_concurrency()),
+                              n / transpose_leaf));
+}
+
+template<class T>
+void
+transpose_kernel(size_t m, size_t n, T const* p_a, size_t lda, T* p_b, size_t ldb)
+{
+    size_t const    nthr = is_nothrow_copy_assignable_v<T> ? transpose_threads(m, n) : 1;
+
+    if (nthr > 1)
+    {
+        run_parallel_parts(nthr, [=](size_t k)
+                                 {
+                                     size_t const    j0 = n*k / nthr;
+                                     size_t const    j1 = n*(k + 1) / nthr;
+
+                                     transpose_recursive_kernel(m, j1 - j0, p_a + j0, lda,
+                                                                p_b + j0*ldb, ldb);
+                                 });
+    }
+    else
+    {
+        transpose_recursive_kernel(m, n, p_a, lda, p_b, ldb);
+    }
+}
+
+template<class T>
+void
+transpose_square_kernel(size_t n, T* p, size_t ld)
+{
+    constexpr size_t    bs = transpose_leaf;
+
+    size_t const    nblk = (n + bs - 1) / bs;
+    size_t const    nthr = is_nothrow_swappable_v<T> ? min(transpose_threads(n, n), nblk) : 1;
+
+    //- Block row b exchanges the blocks to the right of the diagonal with their mirror images
+    //  below it; block rows touch disjoint pairs of blocks, so they are dealt round-robin.
+    //
+    auto    work = [=](size_t k)
+                   {
+                       for (size_t i0 = k*bs;  i0 < n;  i0 += nthr*bs)
+                       {
+                           size_t const    i1 = min(n, i0 + bs);
+
+                           for (size_t j0 = i0;  j0 < n;  j0 += bs)
+                           {
+                               size_t const    j1 = min(n, j0 + bs);
+
+                               for (size_t i = i0;  i < i1;  ++i)
+                               {
+                                   for (size_t j = max(j0, i + 1);  j < j1;  ++j)
+                                   {
+                                       std::swap(p[i*ld + j], p[j*ld + i]);
+                                   }
+                               }
+                           }
+                       }
+                   };
+
+    if (nthr > 1)
+    {
+        run_parallel_parts(nthr, work);
+    }
+    else
+    {
+        work(0);
+    }
+}
+
+template<class T>
+void
+transpose_contiguous_kernel(size_t m, size_t n, T* p)
+{
+    if (m < 2  ||  n < 2)
+    {
+        return;
+    }
+
+    //- The element at index s moves to index s*m mod (m*n - 1); the first and last are fixed.
+    //
+    size_t const        last = m*n - 1;
+    std::vector<bool>   done(m*n);
+
+    for (size_t s = 1;  s < last;  ++s)
+    {
+        if (done[s])
+        {
+            continue;
+        }
+
+        T       carry = std::move(p[s]);
+        size_t  i = s;
+
+        do
+        {
+            i = (i*m) % last;
+            std::swap(carry, p[i]);
+            done[i] = true;
+        }
+        while (i != s);
+    }
+}
+
+//- If a matrix engine is the transpose of row-major storage -- a transpose view of an engine that
+//  has data(), or a strided engine with unit row stride -- returns a pointer to that storage and
+//  its leading dimension; otherwise, returns a null pointer.
+//
+template<class ET>
+auto
+transposed_storage(ET const& eng) -> tuple<remove_reference_t<decltype(eng(0, 0))> const*, size_t>
+{
+    using pointer_type = remove_reference_t<decltype(eng(0, 0))> const*;
+    using result_type  = tuple<pointer_type, size_t>;
+
+    if (eng.rows() != 0  &&  eng.columns() != 0)
+    {
+        if constexpr (is_dense_transpose_v<ET>)
+        {
+            return result_type(&eng(0, 0), static_cast<size_t>(eng.row_capacity()));
+        }
+        else if constexpr (has_strides_v<ET>)
+        {
+            if (eng.row_stride() == 1  &&  eng.column_stride() >= static_cast<ptrdiff_t>(eng.rows()))
+            {
+                return result_type(&eng(0, 0), static_cast<size_t>(eng.column_stride()));
+            }
+        }
+    }
+    return result_type(nullptr, 0);
+}
+
+//==================================================================================================
+//  Householder reflectors.  A reflector is H = I - tau*v*v', where v(0) = 1.  Given a vector x of
+//  length len with stride inc, make_householder() computes v and tau such that H*x = beta*e1 and
+//  returns beta.  On return x(0) = 1 and x(1:len) holds the rest of v.  If x(1:len) is already
+//  zero then tau = 0 and H is the identity.
+//==================================================================================================
+//
+template<class T>
+T
+make_householder(size_t len, T* p_x, size_t inc, T& tau)
+{
+    T const     alpha = p_x[0];
+    T           xnorm = 0;
+
+    for (size_t i = 1;  i < len;  ++i)
+    {
+        xnorm += p_x[i*inc] * p_x[i*inc];
+    }
+
+    p_x[0] = T(1);
+
+    if (xnorm == T(0))
+    {
+        tau = T(0);
+        return alpha;
+    }
+
+    T const     norm  = sqrt(alpha*alpha + xnorm);
+    T const     beta  = (alpha >= T(0)) ? -norm : norm;
+    T const     scale = T(1) / (alpha - beta);
+
+    for (size_t i = 1;  i < len;  ++i)
+    {
+        p_x[i*inc] *= scale;
+    }
+
+    tau = (beta - alpha) / beta;
+    return beta;
+}
+
+//==================================================================================================
+//  Forms the first n columns of Q = H(0) * H(1) * ... * H(nr-1), an (m x m) product of Householder
+//  reflectors, in the row-major (m x n) block at p_q.  Reflector j is stored in column j of the
+//  row-major block at p_v, and its first (unit) element is in row off+j; tau(j) is at p_tau[j].
+//
+//  The reflectors are applied in blocks using the compact WY representation, H(j0)*...*H(j1-1) =
+//  I - V*T*V', where T is upper triangular, so that nearly all of the work is done by the GEMM
+//  kernel above.
+//==================================================================================================
+//
+inline constexpr size_t     householder_block = 32;
+
+template<class T>
+void
+form_householder_product(size_t m, size_t n, size_t nr, size_t off,
+                         T const* p_v, size_t ldv, T const* p_tau,
+                         T* p_q, size_t ldq)
+{
+    for (size_t i = 0;  i < m;  ++i)
+    {
+        fill_n(p_q + i*ldq, n, T{});
+        if (i < n) p_q[i*ldq + i] = T(1);
+    }
+
+    std::vector<T>  vt, vb, t, w;
+
+    for (size_t jb = (nr + householder_block - 1) / householder_block;  jb-- > 0;  )
+    {
+        size_t const    j0 = jb * householder_block;
+        size_t const    r0 = off + j0;
+
+        //- Rows and columns of Q above/left of r0 are not touched by this block of reflectors,
+        //  since Q is still the identity there.
+        //
+        if (r0 >= m  ||  r0 >= n) continue;
+
+        size_t const    mr = m - r0;
+        size_t const    kb = min(mr, min(nr, j0 + householder_block) - j0);
+        size_t const    nc = n - r0;
+
+        //- Pack V' (kb x mr) and V (mr x kb), with explicit unit diagonal and zeros above.
+        //
+        vt.assign(kb*mr, T{});
+        vb.assign(mr*kb, T{});
+
+        for (size_t jj = 0;  jj < kb;  ++jj)
+        {
+            vt[jj*mr + jj] = T(1);
+            for (size_t i = jj + 1;  i < mr;  ++i)
+            {
+                vt[jj*mr + i] = p_v[(r0 + i)*ldv + j0 + jj];
+            }
+            for (size_t i = jj;  i < mr;  ++i)
+            {
+                vb[i*kb + jj] = vt[jj*mr + i];
+            }
+        }
+
+        //- Build the triangular factor T column by column:  T(0:jj, jj) = -tau(jj) * T(0:jj, 0:jj)
+        //  * V(:, 0:jj)' * v(jj).
+        //
+        t.assign(kb*kb, T{});
+        w.assign(kb, T{});
+
+        for (size_t jj = 0;  jj < kb;  ++jj)
+        {
+            T const     tau = p_tau[j0 + jj];
+
+            for (size_t l = 0;  l < jj;  ++l)
+            {
+                T   dot = 0;
+                for (size_t i = jj;  i < mr;  ++i)
+                {
+                    dot += vt[l*mr + i] * vt[jj*mr + i];
+                }
+                w[l] = dot;
+            }
+            for (size_t ii = 0;  ii < jj;  ++ii)
+            {
+                T   sum = 0;
+                for (size_t l = ii;  l < jj;  ++l)
+                {
+                    sum += t[ii*kb + l] * w[l];
+                }
+                t[ii*kb + jj] = -tau * sum;
+            }
+            t[jj*kb + jj] = tau;
+        }
+
+        //- Q(r0:m, r0:n) -= V * (T * (V' * Q(r0:m, r0:n))).
+        //
+        T*  p_qb = p_q + r0*ldq + r0;
+
+        w.assign(2*kb*nc, T{});
+        gemm_assign_kernel(kb, nc, mr, vt.data(), mr, p_qb, ldq, w.data(), nc);
+
+        for (size_t ii = 0;  ii < kb;  ++ii)
+        {
+            T*  p_wi = w.data() + kb*nc + ii*nc;
+
+            for (size_t l = ii;  l < kb;  ++l)
+            {
+                T const     til = -t[ii*kb + l];
+                T const*    p_wl = w.data() + l*nc;
+
+                for (size_t j = 0;  j < nc;  ++j)
+                {
+                    p_wi[j] += til * p_wl[j];
+                }
+            }
+        }
+        gemm_kernel(mr, nc, kb, vb.data(), kb, w.data() + kb*nc, nc, p_qb, ldq);
+    }
+}
+
+}       //- detail namespace
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_DENSE_KERNELS_HPP_DEFINED
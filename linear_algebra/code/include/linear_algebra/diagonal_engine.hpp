@@ -0,0 +1,231 @@
+//==================================================================================================
+//  File:       diagonal_engine.hpp
+//
+//  Summary:    This header defines an engine that acts as a "view" of a matrix diagonal.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_DIAGONAL_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_DIAGONAL_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//- Distance between successive diagonal elements in the storage of a matrix engine that has
+//  data(), if known at compile time; zero otherwise.
+//
+template<class ET>
+inline constexpr size_t     static_diagonal_stride = 0;
+
+template<class T, size_t R, size_t C>
+inline constexpr size_t     static_diagonal_stride<fs_matrix_engine<T, R, C>> = C + 1;
+
+template<class T, size_t R, size_t C>
+inline constexpr size_t     static_diagonal_stride<fs_matrix_engine<T, R, C> const> = C + 1;
+
+}       //- detail namespace
+//==================================================================================================
+//  Matrix diagonal engine, meant to act as a "view" of the k-th diagonal of a matrix, where
+//  k > 0 denotes a super-diagonal and k < 0 a sub-diagonal.
+//
+//  If the wrapped engine exposes its storage via data(), then the diagonal is accessed as a
+//  strided run of that storage, whose stride is a compile-time constant for fixed-size engines.
+//==================================================================================================
+//
+template<class ET, class VCT>
+class diagonal_engine
+{
+    static_assert(is_matrix_engine_v<ET>);
+    static_assert(is_vector_engine_tag<VCT>);
+
+    static constexpr bool   has_direct_access = detail::has_data_v<ET>;
+    static constexpr size_t static_stride     = detail::static_diagonal_stride<remove_cv_t<ET>>;
+
+  public:
+    //- Types
+    //
+    using engine_category = VCT;
+    using element_type    = typename ET::element_type;
+    using value_type      = typename ET::value_type;
+    using pointer         = detail::noe_pointer_t<ET, VCT>;
+    using const_pointer   = typename ET::const_pointer;
+    using reference       = detail::noe_reference_t<ET, VCT>;
+    using const_reference = typename ET::const_reference;
+    using difference_type = typename ET::difference_type;
+    using size_type       = typename ET::size_type;
+
+#ifdef LA_USE_VECTOR_ENGINE_ITERATORS
+    using iterator        = detail::noe_iterator_t<ET, VCT, diagonal_engine>;
+    using const_iterator  = detail::vector_const_iterator<diagonal_engine>;
+#endif
+
+    //- Construct/copy/destroy
+    //
+    ~diagonal_engine() noexcept = default;
+
+    constexpr diagonal_engine() noexcept;
+    constexpr diagonal_engine(diagonal_engine&&) noexcept = default;
+    constexpr diagonal_engine(diagonal_engine const&) noexcept = default;
+
+    constexpr diagonal_engine&  operator =(diagonal_engine&&) noexcept = default;
+    constexpr diagonal_engine&  operator =(diagonal_engine const&) noexcept = default;
+
+#ifdef LA_USE_VECTOR_ENGINE_ITERATORS
+    //- Iterators
+    //
+    constexpr iterator          begin() const noexcept;
+    constexpr iterator          end() const noexcept;
+    constexpr const_iterator    cbegin() const noexcept;
+    constexpr const_iterator    cend() const noexcept;
+#endif
+
+    //- Capacity
+    //
+    constexpr size_type     capacity() const noexcept;
+    constexpr size_type     elements() const noexcept;
+
+    //- Element access
+    //
+    constexpr reference     operator ()(size_type i) const;
+
+    //- Modifiers
+    //
+    constexpr void      swap(diagonal_engine& rhs);
+
+  private:
+    template<class ET2, class OT2>  friend class vector;
+    using referent_type = detail::noe_referent_t<ET, VCT>;
+
+    referent_type*  mp_other;
+    pointer         mp_data;
+    size_type       m_row;
+    size_type       m_col;
+    size_type       m_elems;
+    size_type       m_stride;
+
+    constexpr diagonal_engine(referent_type& eng, difference_type k);
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class ET, class VCT> constexpr
+diagonal_engine<ET, VCT>::diagonal_engine() noexcept
+:   mp_other(nullptr)
+,   mp_data(nullptr)
+,   m_row(0)
+,   m_col(0)
+,   m_elems(0)
+,   m_stride(0)
+{}
+
+#ifdef LA_USE_VECTOR_ENGINE_ITERATORS
+//-----------
+//- Iterators
+//
+template<class ET, class VCT> constexpr
+typename diagonal_engine<ET, VCT>::iterator
+diagonal_engine<ET, VCT>::begin() const noexcept
+{
+    return iterator(this, 0, m_elems);
+}
+
+template<class ET, class VCT> constexpr
+typename diagonal_engine<ET, VCT>::iterator
+diagonal_engine<ET, VCT>::end() const noexcept
+{
+    return iterator(this, m_elems, m_elems);
+}
+
+template<class ET, class VCT> constexpr
+typename diagonal_engine<ET, VCT>::const_iterator
+diagonal_engine<ET, VCT>::cbegin() const noexcept
+{
+    return const_iterator(this, 0, m_elems);
+}
+
+template<class ET, class VCT> constexpr
+typename diagonal_engine<ET, VCT>::const_iterator
+diagonal_engine<ET, VCT>::cend() const noexcept
+{
+    return const_iterator(this, m_elems, m_elems);
+}
+
+#endif
+//----------
+//- Capacity
+//
+template<class ET, class VCT> constexpr
+typename diagonal_engine<ET, VCT>::size_type
+diagonal_engine<ET, VCT>::capacity() const noexcept
+{
+    return m_elems;
+}
+
+template<class ET, class VCT> constexpr
+typename diagonal_engine<ET, VCT>::size_type
+diagonal_engine<ET, VCT>::elements() const noexcept
+{
+    return m_elems;
+}
+
+//----------------
+//- Element access
+//
+template<class ET, class VCT> constexpr
+typename diagonal_engine<ET, VCT>::reference
+diagonal_engine<ET, VCT>::operator ()(size_type i) const
+{
+    if constexpr (has_direct_access  &&  static_stride != 0)
+    {
+        return mp_data[i*static_stride];
+    }
+    else if constexpr (has_direct_access)
+    {
+        return mp_data[i*m_stride];
+    }
+    else
+    {
+        return (*mp_other)(m_row + i, m_col + i);
+    }
+}
+
+//-----------
+//- Modifiers
+//
+template<class ET, class VCT> constexpr
+void
+diagonal_engine<ET, VCT>::swap(diagonal_engine& rhs)
+{
+    std::swap(mp_other, rhs.mp_other);
+    std::swap(mp_data, rhs.mp_data);
+    std::swap(m_row, rhs.m_row);
+    std::swap(m_col, rhs.m_col);
+    std::swap(m_elems, rhs.m_elems);
+    std::swap(m_stride, rhs.m_stride);
+}
+
+//------------------------
+//- Private implementation
+//
+template<class ET, class VCT> constexpr
+diagonal_engine<ET, VCT>::diagonal_engine(referent_type& eng, difference_type k)
+:   mp_other(&eng)
+,   mp_data(nullptr)
+,   m_row((k < 0) ? static_cast<size_type>(-k) : 0)
+,   m_col((k > 0) ? static_cast<size_type>(k) : 0)
+,   m_elems(0)
+,   m_stride(0)
+{
+    if (m_row < eng.rows()  &&  m_col < eng.columns())
+    {
+        m_elems = min(eng.rows() - m_row, eng.columns() - m_col);
+
+        if constexpr (has_direct_access)
+        {
+            m_stride = eng.column_capacity() + 1;
+            mp_data  = eng.data() + (m_row*eng.column_capacity() + m_col);
+        }
+    }
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_DIAGONAL_ENGINE_HPP_DEFINED
@@ -78,6 +78,11 @@ class dr_vector_engine
     reference       operator ()(size_type i);
     const_reference operator ()(size_type i) const;
 
+    //- Data access
+    //
+    pointer         data() noexcept;
+    const_pointer   data() const noexcept;
+
     //- Modifiers
     //
     void    swap(dr_vector_engine& rhs) noexcept;
@@ -301,6 +306,23 @@ dr_vector_engine<T,AT>::operator ()(size_type i) const
     return mp_elems[i];
 }
 
+//-------------
+//- Data access
+//
+template<class T, class AT> inline
+typename dr_vector_engine<T,AT>::pointer
+dr_vector_engine<T,AT>::data() noexcept
+{
+    return mp_elems;
+}
+
+template<class T, class AT> inline
+typename dr_vector_engine<T,AT>::const_pointer
+dr_vector_engine<T,AT>::data() const noexcept
+{
+    return mp_elems;
+}
+
 //-----------
 //- Modifiers
 //
@@ -486,11 +508,17 @@ class dr_matrix_engine
     reference           operator ()(size_type i, size_type j);
     const_reference     operator ()(size_type i, size_type j) const;
 
+    //- Data access
+    //
+    pointer             data() noexcept;
+    const_pointer       data() const noexcept;
+
     //- Modifiers
     //
     void    swap(dr_matrix_engine& other) noexcept;
     void    swap_columns(size_type c1, size_type c2) noexcept;
     void    swap_rows(size_type r1, size_type r2) noexcept;
+    void    transpose_in_place();
 
   private:
     pointer         mp_elems;       //- For exposition; data buffer
@@ -513,7 +541,7 @@ class dr_matrix_engine
 template<class T, class AT> inline
 dr_matrix_engine<T,AT>::~dr_matrix_engine() noexcept
 {
-    delete [] mp_elems;
+    detail::deallocate(m_alloc, mp_elems, (size_t)(m_rowcap*m_colcap));
 }
 
 template<class T, class AT>
@@ -605,6 +633,23 @@ dr_matrix_engine<T,AT>::operator =(ET2 const& rhs)
     size_type           cols = (size_type) rhs.columns();
     dr_matrix_engine    tmp(rows, cols);
 
+    //- Materializing a transpose of row-major storage reads or writes one of the two with a large
+    //  stride, so it is done with the blocked transpose kernel.
+    //
+    if constexpr ((detail::is_dense_transpose_v<ET2> || detail::has_strides_v<ET2>)  &&
+                  is_same_v<typename ET2::value_type, T>)
+    {
+        auto const  [p_src, lds] = detail::transposed_storage(rhs);
+
+        if (p_src != nullptr)
+        {
+            detail::transpose_kernel((size_t) cols, (size_t) rows, p_src, lds,
+                                     tmp.mp_elems, (size_t) tmp.m_colcap);
+            tmp.swap(*this);
+            return *this;
+        }
+    }
+
     src_size_type   si, sj;
     size_type       di, dj;
 
@@ -704,6 +749,23 @@ dr_matrix_engine<T,AT>::operator ()(size_type i, size_type j) const
     return mp_elems[i*m_colcap + j];
 }
 
+//-------------
+//- Data access
+//
+template<class T, class AT> inline
+typename dr_matrix_engine<T,AT>::pointer
+dr_matrix_engine<T,AT>::data() noexcept
+{
+    return mp_elems;
+}
+
+template<class T, class AT> inline
+typename dr_matrix_engine<T,AT>::const_pointer
+dr_matrix_engine<T,AT>::data() const noexcept
+{
+    return mp_elems;
+}
+
 //-----------
 //- Modifiers
 //
@@ -747,6 +809,33 @@ dr_matrix_engine<T,AT>::swap_rows(size_type r1, size_type r2) noexcept
     }
 }
 
+//- Transposes in place when the matrix is square, or when it has no spare capacity; otherwise,
+//  the transpose is built in a new buffer.
+//
+template<class T, class AT>
+void
+dr_matrix_engine<T,AT>::transpose_in_place()
+{
+    if (m_rows == m_cols)
+    {
+        detail::transpose_square_kernel((size_t) m_rows, mp_elems, (size_t) m_colcap);
+    }
+    else if (m_rows == m_rowcap  &&  m_cols == m_colcap)
+    {
+        detail::transpose_contiguous_kernel((size_t) m_rows, (size_t) m_cols, mp_elems);
+        std::swap(m_rows, m_cols);
+        std::swap(m_rowcap, m_colcap);
+    }
+    else
+    {
+        dr_matrix_engine    tmp(m_cols, m_rows);
+
+        detail::transpose_kernel((size_t) m_rows, (size_t) m_cols, mp_elems, (size_t) m_colcap,
+                                 tmp.mp_elems, (size_t) tmp.m_colcap);
+        tmp.swap(*this);
+    }
+}
+
 //------------------------
 //- Private implementation
 //
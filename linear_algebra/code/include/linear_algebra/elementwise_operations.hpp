@@ -0,0 +1,501 @@
+//==================================================================================================
+//  File:       elementwise_operations.hpp
+//
+//  Summary:    This header defines functions that apply an arbitrary function element-wise to
+//              one vector or matrix (elementwise_map), or to corresponding elements of two of them
+//              (zip_with), along with the Hadamard (element-wise) product.  It also defines
+//              broadcasting functions, which combine each row (or column) of a matrix with a vector
+//              without materializing the expanded operand.
+//
+//              The type of the result is that of the corresponding negation (for elementwise_map)
+//              or addition (for zip_with) expression, as determined by the operation traits; the
+//              values returned by the function are converted to its element type.
+//
+//              If LA_USE_EXECUTION_POLICIES is defined, each function also has an overload taking
+//              a standard execution policy as its first argument.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_ELEMENTWISE_OPERATIONS_HPP_DEFINED
+#define LINEAR_ALGEBRA_ELEMENTWISE_OPERATIONS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Element-wise kernels.  When the result and all operands expose their storage via data(), the
+//  function is applied along unit-stride rows through raw pointers, so that the loop is readily
+//  vectorized.  Otherwise, elements are visited through the engines' operator().
+//==================================================================================================
+//
+template<class OP>
+inline constexpr bool   has_dense_storage_v = has_data_v<typename OP::engine_type>;
+
+template<class ET, class OT>
+auto
+row_data(vector<ET, OT>& v, size_t)
+{
+    return v.engine().data();
+}
+
+template<class ET, class OT>
+auto
+row_data(vector<ET, OT> const& v, size_t)
+{
+    return v.engine().data();
+}
+
+template<class ET, class OT>
+auto
+row_data(matrix<ET, OT>& m, size_t i)
+{
+    return m.engine().data() + i*m.engine().column_capacity();
+}
+
+template<class ET, class OT>
+auto
+row_data(matrix<ET, OT> const& m, size_t i)
+{
+    return m.engine().data() + i*m.engine().column_capacity();
+}
+
+//- Returns (rows, columns) of an operand, treating a vector as a single row.
+//
+template<class ET, class OT>
+tuple<size_t, size_t>
+elementwise_extents(vector<ET, OT> const& v)
+{
+    return tuple<size_t, size_t>(1, static_cast<size_t>(v.elements()));
+}
+
+template<class ET, class OT>
+tuple<size_t, size_t>
+elementwise_extents(matrix<ET, OT> const& m)
+{
+    return tuple<size_t, size_t>(static_cast<size_t>(m.rows()), static_cast<size_t>(m.columns()));
+}
+
+template<class ET, class OT>
+void
+elementwise_resize(vector<ET, OT>& vr, size_t, size_t cols)
+{
+    using size_type = typename vector<ET, OT>::size_type;
+
+    if constexpr (is_resizable_engine_v<ET>)
+    {
+        vr.resize(static_cast<size_type>(cols));
+    }
+}
+
+template<class ET, class OT>
+void
+elementwise_resize(matrix<ET, OT>& mr, size_t rows, size_t cols)
+{
+    using size_type = typename matrix<ET, OT>::size_type;
+
+    if constexpr (is_resizable_engine_v<ET>)
+    {
+        mr.resize(static_cast<size_type>(rows), static_cast<size_type>(cols));
+    }
+}
+
+//- Element (i, j) of an operand, where a vector is treated as a single row.
+//
+template<class ET, class OT>
+decltype(auto)
+elementwise_at(vector<ET, OT>& v, size_t, size_t j)
+{
+    return v(static_cast<typename vector<ET, OT>::size_type>(j));
+}
+
+template<class ET, class OT>
+decltype(auto)
+elementwise_at(vector<ET, OT> const& v, size_t, size_t j)
+{
+    return v(static_cast<typename vector<ET, OT>::size_type>(j));
+}
+
+template<class ET, class OT>
+decltype(auto)
+elementwise_at(matrix<ET, OT>& m, size_t i, size_t j)
+{
+    using size_type = typename matrix<ET, OT>::size_type;
+    return m(static_cast<size_type>(i), static_cast<size_type>(j));
+}
+
+template<class ET, class OT>
+decltype(auto)
+elementwise_at(matrix<ET, OT> const& m, size_t i, size_t j)
+{
+    using size_type = typename matrix<ET, OT>::size_type;
+    return m(static_cast<size_type>(i), static_cast<size_type>(j));
+}
+
+template<class F, class RT, class... OPS>
+void
+elementwise_apply(F& f, RT& r, OPS const&... ops)
+{
+    using elem_type = typename RT::element_type;
+
+    auto const  [rows, cols] = elementwise_extents(r);
+
+    if constexpr ((has_dense_storage_v<RT> && ... && has_dense_storage_v<OPS>))
+    {
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            auto    p_r = row_data(r, i);
+            auto    ps  = tuple(row_data(ops, i)...);
+
+            for (size_t j = 0;  j < cols;  ++j)
+            {
+                p_r[j] = static_cast<elem_type>(apply([&](auto... p) { return f(p[j]...); }, ps));
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            for (size_t j = 0;  j < cols;  ++j)
+            {
+                elementwise_at(r, i, j) = static_cast<elem_type>(f(elementwise_at(ops, i, j)...));
+            }
+        }
+    }
+}
+
+#ifdef LA_USE_EXECUTION_POLICIES
+//- Policy-driven variant.  Dense operands are handed to std::transform() row by row, or all
+//  at once if their rows are packed without padding; others are processed serially.
+//
+template<class EP, class F, class RT, class... OPS>
+void
+elementwise_apply_policy(EP&& policy, F& f, RT& r, OPS const&... ops)
+{
+    static_assert(sizeof...(OPS) == 1  ||  sizeof...(OPS) == 2);
+
+    using elem_type = typename RT::element_type;
+
+    if constexpr ((has_dense_storage_v<RT> && ... && has_dense_storage_v<OPS>))
+    {
+        auto const  [rows, cols] = elementwise_extents(r);
+        auto        g = [&f](auto const&... x) { return static_cast<elem_type>(f(x...)); };
+
+        bool const  packed = (rows <= 1)  ||
+                             ((row_data(r, 1) - row_data(r, 0) == ptrdiff_t(cols)) && ... &&
+                              (row_data(ops, 1) - row_data(ops, 0) == ptrdiff_t(cols)));
+        size_t const    n_rows = packed ? min(rows, size_t(1)) : rows;
+        size_t const    n_cols = packed ? rows*cols : cols;
+
+        for (size_t i = 0;  i < n_rows;  ++i)
+        {
+            auto const  ps = tuple(row_data(ops, i)...);
+
+            if constexpr (sizeof...(OPS) == 1)
+            {
+                transform(policy, get<0>(ps), get<0>(ps) + n_cols, row_data(r, i), g);
+            }
+            else
+            {
+                transform(policy, get<0>(ps), get<0>(ps) + n_cols, get<1>(ps), row_data(r, i), g);
+            }
+        }
+    }
+    else
+    {
+        elementwise_apply(f, r, ops...);
+    }
+}
+#endif
+
+//- Broadcasting kernels.  Element (i, j) of the result is f(m(i, j), v(j)) when broadcasting
+//  along rows, and f(m(i, j), v(i)) when broadcasting along columns; the matrix is streamed once.
+//
+template<class F, class RT, class MT, class VT>
+void
+broadcast_rows_apply(F& f, RT& r, MT const& m, VT const& v)
+{
+    using elem_type = typename RT::element_type;
+
+    auto const  [rows, cols] = elementwise_extents(m);
+
+    if constexpr (has_dense_storage_v<RT> && has_dense_storage_v<MT> && has_dense_storage_v<VT>)
+    {
+        auto const  p_v = row_data(v, 0);
+
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            auto        p_r = row_data(r, i);
+            auto const  p_m = row_data(m, i);
+
+            for (size_t j = 0;  j < cols;  ++j)
+            {
+                p_r[j] = static_cast<elem_type>(f(p_m[j], p_v[j]));
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            for (size_t j = 0;  j < cols;  ++j)
+            {
+                elementwise_at(r, i, j) =
+                    static_cast<elem_type>(f(elementwise_at(m, i, j), elementwise_at(v, 0, j)));
+            }
+        }
+    }
+}
+
+template<class F, class RT, class MT, class VT>
+void
+broadcast_columns_apply(F& f, RT& r, MT const& m, VT const& v)
+{
+    using elem_type = typename RT::element_type;
+
+    auto const  [rows, cols] = elementwise_extents(m);
+
+    if constexpr (has_dense_storage_v<RT> && has_dense_storage_v<MT>)
+    {
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            auto        p_r = row_data(r, i);
+            auto const  p_m = row_data(m, i);
+            auto const  vi  = elementwise_at(v, 0, i);
+
+            for (size_t j = 0;  j < cols;  ++j)
+            {
+                p_r[j] = static_cast<elem_type>(f(p_m[j], vi));
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            auto const  vi = elementwise_at(v, 0, i);
+
+            for (size_t j = 0;  j < cols;  ++j)
+            {
+                elementwise_at(r, i, j) = static_cast<elem_type>(f(elementwise_at(m, i, j), vi));
+            }
+        }
+    }
+}
+
+template<class OP1, class OP2>
+void
+check_elementwise_extents(OP1 const& op1, OP2 const& op2)
+{
+    if (elementwise_extents(op1) != elementwise_extents(op2))
+    {
+        throw runtime_error("invalid size");
+    }
+}
+
+//- Result types, as given by the negation and addition traits.
+//
+template<class OT1, class OP1>
+using map_result_t = typename matrix_negation_traits_t<OT1, OP1>::result_type;
+
+template<class OT1, class OT2, class OP1, class OP2>
+using zip_result_t = typename matrix_addition_traits_t<matrix_operation_traits_selector_t<OT1, OT2>,
+                                                       OP1, OP2>::result_type;
+
+}       //- detail namespace
+//==================================================================================================
+//                                  **** ELEMENT-WISE MAP ****
+//==================================================================================================
+//
+template<class F, class ET1, class OT1>
+auto
+elementwise_map(F f, vector<ET1, OT1> const& v1) -> detail::map_result_t<OT1, vector<ET1, OT1>>
+{
+    detail::map_result_t<OT1, vector<ET1, OT1>>  vr;
+
+    detail::elementwise_resize(vr, 1, static_cast<size_t>(v1.elements()));
+    detail::elementwise_apply(f, vr, v1);
+    return vr;
+}
+
+template<class F, class ET1, class OT1>
+auto
+elementwise_map(F f, matrix<ET1, OT1> const& m1) -> detail::map_result_t<OT1, matrix<ET1, OT1>>
+{
+    detail::map_result_t<OT1, matrix<ET1, OT1>>  mr;
+
+    detail::elementwise_resize(mr, static_cast<size_t>(m1.rows()), static_cast<size_t>(m1.columns()));
+    detail::elementwise_apply(f, mr, m1);
+    return mr;
+}
+
+//==================================================================================================
+//                                **** ELEMENT-WISE ZIP ****
+//==================================================================================================
+//
+template<class F, class ET1, class OT1, class ET2, class OT2>
+auto
+zip_with(F f, vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2)
+    -> detail::zip_result_t<OT1, OT2, vector<ET1, OT1>, vector<ET2, OT2>>
+{
+    detail::zip_result_t<OT1, OT2, vector<ET1, OT1>, vector<ET2, OT2>>    vr;
+
+    detail::check_elementwise_extents(v1, v2);
+    detail::elementwise_resize(vr, 1, static_cast<size_t>(v1.elements()));
+    detail::elementwise_apply(f, vr, v1, v2);
+    return vr;
+}
+
+template<class F, class ET1, class OT1, class ET2, class OT2>
+auto
+zip_with(F f, matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2)
+    -> detail::zip_result_t<OT1, OT2, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    detail::zip_result_t<OT1, OT2, matrix<ET1, OT1>, matrix<ET2, OT2>>    mr;
+
+    detail::check_elementwise_extents(m1, m2);
+    detail::elementwise_resize(mr, static_cast<size_t>(m1.rows()), static_cast<size_t>(m1.columns()));
+    detail::elementwise_apply(f, mr, m1, m2);
+    return mr;
+}
+
+//- The Hadamard product of two vectors or two matrices.
+//
+template<class OP1, class OP2>
+auto
+hadamard(OP1 const& op1, OP2 const& op2)
+{
+    return STD_LA::zip_with([](auto const& x, auto const& y) { return x * y; }, op1, op2);
+}
+
+//==================================================================================================
+//                                  **** BROADCASTING ****
+//==================================================================================================
+//- Combines every row of a matrix with a vector having one element per column, e.g. to subtract
+//  column means:  broadcast_rows(minus<>(), m, means).  The result has the type of -m.
+//
+template<class F, class ET1, class OT1, class ET2, class OT2>
+auto
+broadcast_rows(F f, matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2)
+    -> detail::map_result_t<OT1, matrix<ET1, OT1>>
+{
+    detail::map_result_t<OT1, matrix<ET1, OT1>>  mr;
+
+    if (v2.elements() != m1.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::elementwise_resize(mr, static_cast<size_t>(m1.rows()), static_cast<size_t>(m1.columns()));
+    detail::broadcast_rows_apply(f, mr, m1, v2);
+    return mr;
+}
+
+//- Combines every column of a matrix with a vector having one element per row, e.g. to scale
+//  rows:  broadcast_columns(multiplies<>(), m, weights).  The result has the type of -m.
+//
+template<class F, class ET1, class OT1, class ET2, class OT2>
+auto
+broadcast_columns(F f, matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2)
+    -> detail::map_result_t<OT1, matrix<ET1, OT1>>
+{
+    detail::map_result_t<OT1, matrix<ET1, OT1>>  mr;
+
+    if (v2.elements() != m1.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::elementwise_resize(mr, static_cast<size_t>(m1.rows()), static_cast<size_t>(m1.columns()));
+    detail::broadcast_columns_apply(f, mr, m1, v2);
+    return mr;
+}
+
+//- In-place forms, which update the matrix without allocating a result.
+//
+template<class F, class ET1, class OT1, class ET2, class OT2>
+void
+broadcast_rows_in_place(F f, matrix<ET1, OT1>& m1, vector<ET2, OT2> const& v2)
+{
+    if (v2.elements() != m1.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::broadcast_rows_apply(f, m1, m1, v2);
+}
+
+template<class F, class ET1, class OT1, class ET2, class OT2>
+void
+broadcast_columns_in_place(F f, matrix<ET1, OT1>& m1, vector<ET2, OT2> const& v2)
+{
+    if (v2.elements() != m1.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::broadcast_columns_apply(f, m1, m1, v2);
+}
+
+#ifdef LA_USE_EXECUTION_POLICIES
+//==================================================================================================
+//                         **** OVERLOADS TAKING EXECUTION POLICIES ****
+//==================================================================================================
+//
+template<class EP, class F, class ET1, class OT1,
+         enable_if_t<is_execution_policy_v<remove_cv_t<remove_reference_t<EP>>>, bool> = true>
+auto
+elementwise_map(EP&& policy, F f, vector<ET1, OT1> const& v1) -> detail::map_result_t<OT1, vector<ET1, OT1>>
+{
+    detail::map_result_t<OT1, vector<ET1, OT1>>  vr;
+
+    detail::elementwise_resize(vr, 1, static_cast<size_t>(v1.elements()));
+    detail::elementwise_apply_policy(policy, f, vr, v1);
+    return vr;
+}
+
+template<class EP, class F, class ET1, class OT1,
+         enable_if_t<is_execution_policy_v<remove_cv_t<remove_reference_t<EP>>>, bool> = true>
+auto
+elementwise_map(EP&& policy, F f, matrix<ET1, OT1> const& m1) -> detail::map_result_t<OT1, matrix<ET1, OT1>>
+{
+    detail::map_result_t<OT1, matrix<ET1, OT1>>  mr;
+
+    detail::elementwise_resize(mr, static_cast<size_t>(m1.rows()), static_cast<size_t>(m1.columns()));
+    detail::elementwise_apply_policy(policy, f, mr, m1);
+    return mr;
+}
+
+template<class EP, class F, class ET1, class OT1, class ET2, class OT2,
+         enable_if_t<is_execution_policy_v<remove_cv_t<remove_reference_t<EP>>>, bool> = true>
+auto
+zip_with(EP&& policy, F f, vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2)
+    -> detail::zip_result_t<OT1, OT2, vector<ET1, OT1>, vector<ET2, OT2>>
+{
+    detail::zip_result_t<OT1, OT2, vector<ET1, OT1>, vector<ET2, OT2>>    vr;
+
+    detail::check_elementwise_extents(v1, v2);
+    detail::elementwise_resize(vr, 1, static_cast<size_t>(v1.elements()));
+    detail::elementwise_apply_policy(policy, f, vr, v1, v2);
+    return vr;
+}
+
+template<class EP, class F, class ET1, class OT1, class ET2, class OT2,
+         enable_if_t<is_execution_policy_v<remove_cv_t<remove_reference_t<EP>>>, bool> = true>
+auto
+zip_with(EP&& policy, F f, matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2)
+    -> detail::zip_result_t<OT1, OT2, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    detail::zip_result_t<OT1, OT2, matrix<ET1, OT1>, matrix<ET2, OT2>>    mr;
+
+    detail::check_elementwise_extents(m1, m2);
+    detail::elementwise_resize(mr, static_cast<size_t>(m1.rows()), static_cast<size_t>(m1.columns()));
+    detail::elementwise_apply_policy(policy, f, mr, m1, m2);
+    return mr;
+}
+
+template<class EP, class OP1, class OP2,
+         enable_if_t<is_execution_policy_v<remove_cv_t<remove_reference_t<EP>>>, bool> = true>
+auto
+hadamard(EP&& policy, OP1 const& op1, OP2 const& op2)
+{
+    return STD_LA::zip_with(policy, [](auto const& x, auto const& y) { return x * y; }, op1, op2);
+}
+#endif
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_ELEMENTWISE_OPERATIONS_HPP_DEFINED
@@ -0,0 +1,614 @@
+//==================================================================================================
+//  File:       external_engines.hpp
+//
+//  Summary:    This header defines non-owning vector and matrix engines over element buffers that
+//              are owned by something else, such as a network frame, a column of a table, or a
+//              memory-mapped file, so that such data can be used as a vector or matrix without
+//              first being copied.  An engine whose element type is const-qualified is read-only.
+//
+//              Two layouts are supported:
+//
+//                - dense:  vector elements are contiguous, and matrix rows are contiguous and
+//                  separated by a leading dimension ld >= columns.  These engines provide data()
+//                  and column_capacity() == ld, so the dense kernels use them directly.
+//
+//                - strided:  element i of a vector is at p + i*stride, and element (i, j) of a
+//                  matrix is at p + i*row_stride + j*column_stride, for arbitrary (possibly
+//                  negative) strides; for example, a column-major buffer has row_stride == 1.
+//
+//              external_vector() and external_matrix() also accept any mdspan-like object of rank
+//              one or two -- that is, one providing rank(), extent(r), stride(r), and a pointer
+//              data_handle() -- and to_mdspan() produces a layout_stride mdspan-like object from
+//              a vector or matrix whose storage is dense or strided, so that data can cross the
+//              boundary in either direction without being copied.
+//
+//              Like other views, these engines are copied shallowly; assigning a vector or matrix
+//              of a different engine type to one copies elements into the external buffer.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_EXTERNAL_ENGINES_HPP_DEFINED
+#define LINEAR_ALGEBRA_EXTERNAL_ENGINES_HPP_DEFINED
+
+namespace STD_LA {
+
+enum class external_layout
+{
+    dense,
+    strided
+};
+
+//==================================================================================================
+//  External vector engine.
+//==================================================================================================
+//
+template<class T, external_layout L = external_layout::dense>
+class external_vector_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = conditional_t<is_const_v<T>, readable_vector_engine_tag,
+                                                         writable_vector_engine_tag>;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+
+    static constexpr external_layout    layout = L;
+
+    //- Construct/copy/destroy
+    //
+    ~external_vector_engine() noexcept = default;
+
+    constexpr external_vector_engine() noexcept = default;
+    constexpr external_vector_engine(external_vector_engine&&) noexcept = default;
+    constexpr external_vector_engine(external_vector_engine const&) noexcept = default;
+    constexpr external_vector_engine(pointer p, size_type elems, difference_type stride = 1);
+
+    constexpr external_vector_engine&   operator =(external_vector_engine&&) noexcept = default;
+    constexpr external_vector_engine&   operator =(external_vector_engine const&) noexcept = default;
+    template<class ET2>
+    constexpr external_vector_engine&   operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    constexpr size_type         capacity() const noexcept;
+    constexpr size_type         elements() const noexcept;
+    constexpr difference_type   stride() const noexcept;
+
+    //- Element access
+    //
+    constexpr reference     operator ()(size_type i) const;
+
+    //- Data access; only dense engines have data().
+    //
+    template<external_layout L2 = L, enable_if_t<L2 == external_layout::dense, bool> = true>
+    constexpr pointer       data() const noexcept;
+
+    //- Modifiers
+    //
+    constexpr void      swap(external_vector_engine& rhs) noexcept;
+    constexpr void      swap_elements(size_type i, size_type j) const;
+
+  private:
+    pointer             mp_data  = nullptr;
+    size_type           m_elems  = 0;
+    difference_type     m_stride = 1;
+};
+
+template<class T, external_layout L> constexpr
+external_vector_engine<T, L>::external_vector_engine(pointer p, size_type elems, difference_type stride)
+:   mp_data(p)
+,   m_elems(elems)
+,   m_stride(stride)
+{
+    if (L == external_layout::dense  &&  stride != 1)
+    {
+        throw runtime_error("invalid stride");
+    }
+}
+
+template<class T, external_layout L>
+template<class ET2> constexpr
+external_vector_engine<T, L>&
+external_vector_engine<T, L>::operator =(ET2 const& rhs)
+{
+    using src_size_type = typename ET2::size_type;
+
+    static_assert(!is_const_v<T>);
+
+    if (static_cast<size_type>(rhs.elements()) != m_elems)
+    {
+        throw runtime_error("invalid size");
+    }
+    for (size_type i = 0;  i < m_elems;  ++i)
+    {
+        (*this)(i) = static_cast<value_type>(rhs(static_cast<src_size_type>(i)));
+    }
+    return *this;
+}
+
+template<class T, external_layout L> constexpr
+typename external_vector_engine<T, L>::size_type
+external_vector_engine<T, L>::capacity() const noexcept
+{
+    return m_elems;
+}
+
+template<class T, external_layout L> constexpr
+typename external_vector_engine<T, L>::size_type
+external_vector_engine<T, L>::elements() const noexcept
+{
+    return m_elems;
+}
+
+template<class T, external_layout L> constexpr
+typename external_vector_engine<T, L>::difference_type
+external_vector_engine<T, L>::stride() const noexcept
+{
+    return m_stride;
+}
+
+template<class T, external_layout L> constexpr
+typename external_vector_engine<T, L>::reference
+external_vector_engine<T, L>::operator ()(size_type i) const
+{
+    if constexpr (L == external_layout::dense)
+    {
+        return mp_data[i];
+    }
+    else
+    {
+        return mp_data[static_cast<difference_type>(i)*m_stride];
+    }
+}
+
+template<class T, external_layout L>
+template<external_layout L2, enable_if_t<L2 == external_layout::dense, bool>> constexpr
+typename external_vector_engine<T, L>::pointer
+external_vector_engine<T, L>::data() const noexcept
+{
+    return mp_data;
+}
+
+template<class T, external_layout L> constexpr
+void
+external_vector_engine<T, L>::swap(external_vector_engine& rhs) noexcept
+{
+    std::swap(mp_data, rhs.mp_data);
+    std::swap(m_elems, rhs.m_elems);
+    std::swap(m_stride, rhs.m_stride);
+}
+
+template<class T, external_layout L> constexpr
+void
+external_vector_engine<T, L>::swap_elements(size_type i, size_type j) const
+{
+    if (i != j)
+    {
+        detail::la_swap((*this)(i), (*this)(j));
+    }
+}
+
+//==================================================================================================
+//  External matrix engine.
+//==================================================================================================
+//
+template<class T, external_layout L = external_layout::dense>
+class external_matrix_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = conditional_t<is_const_v<T>, readable_matrix_engine_tag,
+                                                         writable_matrix_engine_tag>;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    static constexpr external_layout    layout = L;
+
+    //- Construct/copy/destroy
+    //
+    ~external_matrix_engine() noexcept = default;
+
+    constexpr external_matrix_engine() noexcept = default;
+    constexpr external_matrix_engine(external_matrix_engine&&) noexcept = default;
+    constexpr external_matrix_engine(external_matrix_engine const&) noexcept = default;
+    constexpr external_matrix_engine(pointer p, size_type rows, size_type cols,
+                                     difference_type rs, difference_type cs = 1);
+
+    constexpr external_matrix_engine&   operator =(external_matrix_engine&&) noexcept = default;
+    constexpr external_matrix_engine&   operator =(external_matrix_engine const&) noexcept = default;
+    template<class ET2>
+    constexpr external_matrix_engine&   operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    constexpr size_type     columns() const noexcept;
+    constexpr size_type     rows() const noexcept;
+    constexpr size_tuple    size() const noexcept;
+
+    constexpr size_type     column_capacity() const noexcept;
+    constexpr size_type     row_capacity() const noexcept;
+    constexpr size_tuple    capacity() const noexcept;
+
+    constexpr difference_type   row_stride() const noexcept;
+    constexpr difference_type   column_stride() const noexcept;
+
+    //- Element access
+    //
+    constexpr reference     operator ()(size_type i, size_type j) const;
+
+    //- Data access; only dense engines have data(), with row i at data() + i*column_capacity().
+    //
+    template<external_layout L2 = L, enable_if_t<L2 == external_layout::dense, bool> = true>
+    constexpr pointer       data() const noexcept;
+
+    //- Modifiers
+    //
+    constexpr void      swap(external_matrix_engine& rhs) noexcept;
+    constexpr void      swap_columns(size_type c1, size_type c2) const;
+    constexpr void      swap_rows(size_type r1, size_type r2) const;
+
+  private:
+    pointer             mp_data   = nullptr;
+    size_type           m_rows    = 0;
+    size_type           m_cols    = 0;
+    difference_type     m_rstride = 0;
+    difference_type     m_cstride = 1;
+};
+
+//- For dense engines, rs is the leading dimension, which must be at least cols, and cs must be 1.
+//
+template<class T, external_layout L> constexpr
+external_matrix_engine<T, L>::external_matrix_engine
+(pointer p, size_type rows, size_type cols, difference_type rs, difference_type cs)
+:   mp_data(p)
+,   m_rows(rows)
+,   m_cols(cols)
+,   m_rstride(rs)
+,   m_cstride(cs)
+{
+    if (L == external_layout::dense  &&  (cs != 1  ||  rs < 0  ||  size_type(rs) < cols))
+    {
+        throw runtime_error("invalid stride");
+    }
+}
+
+template<class T, external_layout L>
+template<class ET2> constexpr
+external_matrix_engine<T, L>&
+external_matrix_engine<T, L>::operator =(ET2 const& rhs)
+{
+    using src_size_type = typename ET2::size_type;
+
+    static_assert(!is_const_v<T>);
+
+    if (static_cast<size_type>(rhs.rows()) != m_rows  ||
+        static_cast<size_type>(rhs.columns()) != m_cols)
+    {
+        throw runtime_error("invalid size");
+    }
+    for (size_type i = 0;  i < m_rows;  ++i)
+    {
+        for (size_type j = 0;  j < m_cols;  ++j)
+        {
+            (*this)(i, j) = static_cast<value_type>(rhs(static_cast<src_size_type>(i),
+                                                        static_cast<src_size_type>(j)));
+        }
+    }
+    return *this;
+}
+
+template<class T, external_layout L> constexpr
+typename external_matrix_engine<T, L>::size_type
+external_matrix_engine<T, L>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, external_layout L> constexpr
+typename external_matrix_engine<T, L>::size_type
+external_matrix_engine<T, L>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, external_layout L> constexpr
+typename external_matrix_engine<T, L>::size_tuple
+external_matrix_engine<T, L>::size() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class T, external_layout L> constexpr
+typename external_matrix_engine<T, L>::size_type
+external_matrix_engine<T, L>::column_capacity() const noexcept
+{
+    if constexpr (L == external_layout::dense)
+    {
+        return static_cast<size_type>(m_rstride);
+    }
+    else
+    {
+        return m_cols;
+    }
+}
+
+template<class T, external_layout L> constexpr
+typename external_matrix_engine<T, L>::size_type
+external_matrix_engine<T, L>::row_capacity() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, external_layout L> constexpr
+typename external_matrix_engine<T, L>::size_tuple
+external_matrix_engine<T, L>::capacity() const noexcept
+{
+    return size_tuple(m_rows, column_capacity());
+}
+
+template<class T, external_layout L> constexpr
+typename external_matrix_engine<T, L>::difference_type
+external_matrix_engine<T, L>::row_stride() const noexcept
+{
+    return m_rstride;
+}
+
+template<class T, external_layout L> constexpr
+typename external_matrix_engine<T, L>::difference_type
+external_matrix_engine<T, L>::column_stride() const noexcept
+{
+    return m_cstride;
+}
+
+template<class T, external_layout L> constexpr
+typename external_matrix_engine<T, L>::reference
+external_matrix_engine<T, L>::operator ()(size_type i, size_type j) const
+{
+    if constexpr (L == external_layout::dense)
+    {
+        return mp_data[i*static_cast<size_type>(m_rstride) + j];
+    }
+    else
+    {
+        return mp_data[static_cast<difference_type>(i)*m_rstride +
+                       static_cast<difference_type>(j)*m_cstride];
+    }
+}
+
+template<class T, external_layout L>
+template<external_layout L2, enable_if_t<L2 == external_layout::dense, bool>> constexpr
+typename external_matrix_engine<T, L>::pointer
+external_matrix_engine<T, L>::data() const noexcept
+{
+    return mp_data;
+}
+
+template<class T, external_layout L> constexpr
+void
+external_matrix_engine<T, L>::swap(external_matrix_engine& rhs) noexcept
+{
+    std::swap(mp_data, rhs.mp_data);
+    std::swap(m_rows, rhs.m_rows);
+    std::swap(m_cols, rhs.m_cols);
+    std::swap(m_rstride, rhs.m_rstride);
+    std::swap(m_cstride, rhs.m_cstride);
+}
+
+template<class T, external_layout L> constexpr
+void
+external_matrix_engine<T, L>::swap_columns(size_type c1, size_type c2) const
+{
+    if (c1 != c2)
+    {
+        for (size_type i = 0;  i < m_rows;  ++i)
+        {
+            detail::la_swap((*this)(i, c1), (*this)(i, c2));
+        }
+    }
+}
+
+template<class T, external_layout L> constexpr
+void
+external_matrix_engine<T, L>::swap_rows(size_type r1, size_type r2) const
+{
+    if (r1 != r2)
+    {
+        for (size_type j = 0;  j < m_cols;  ++j)
+        {
+            detail::la_swap((*this)(r1, j), (*this)(r2, j));
+        }
+    }
+}
+
+namespace detail {
+//==================================================================================================
+//  Detection trait for mdspan-like types.
+//==================================================================================================
+//
+template<class M, class = void>
+struct is_mdspan_like : false_type
+{};
+
+template<class M>
+struct is_mdspan_like<M, void_t<decltype(M::rank()),
+                                decltype(declval<M const&>().extent(0)),
+                                decltype(declval<M const&>().stride(0)),
+                                decltype(declval<M const&>().data_handle())>>
+:   bool_constant<is_pointer_v<decltype(declval<M const&>().data_handle())>>
+{};
+
+template<class M> inline constexpr
+bool    is_mdspan_like_v = is_mdspan_like<M>::value;
+}       //- detail namespace
+//==================================================================================================
+//                              **** EXTERNAL VECTORS AND MATRICES ****
+//==================================================================================================
+//  The pointer's (possibly const) element type becomes that of the result.
+//==================================================================================================
+//
+template<class OT = matrix_operation_traits, class T>
+auto
+external_vector(T* p, size_t elems)
+{
+    vector<external_vector_engine<T>, OT>   vr;
+
+    vr.engine() = external_vector_engine<T>(p, elems);
+    return vr;
+}
+
+template<class OT = matrix_operation_traits, class T>
+auto
+external_vector(T* p, size_t elems, ptrdiff_t stride)
+{
+    using engine_type = external_vector_engine<T, external_layout::strided>;
+
+    vector<engine_type, OT>     vr;
+
+    vr.engine() = engine_type(p, elems, stride);
+    return vr;
+}
+
+template<class OT = matrix_operation_traits, class T>
+auto
+external_matrix(T* p, size_t rows, size_t cols)
+{
+    matrix<external_matrix_engine<T>, OT>   mr;
+
+    mr.engine() = external_matrix_engine<T>(p, rows, cols, static_cast<ptrdiff_t>(cols));
+    return mr;
+}
+
+template<class OT = matrix_operation_traits, class T>
+auto
+external_matrix(T* p, size_t rows, size_t cols, size_t ld)
+{
+    matrix<external_matrix_engine<T>, OT>   mr;
+
+    mr.engine() = external_matrix_engine<T>(p, rows, cols, static_cast<ptrdiff_t>(ld));
+    return mr;
+}
+
+template<class OT = matrix_operation_traits, class T>
+auto
+external_matrix(T* p, size_t rows, size_t cols, ptrdiff_t rs, ptrdiff_t cs)
+{
+    using engine_type = external_matrix_engine<T, external_layout::strided>;
+
+    matrix<engine_type, OT>     mr;
+
+    mr.engine() = engine_type(p, rows, cols, rs, cs);
+    return mr;
+}
+
+//- Views of mdspan-like objects are always strided, since the layout is known only at run time.
+//
+template<class OT = matrix_operation_traits, class MDS,
+         enable_if_t<detail::is_mdspan_like_v<MDS>, bool> = true>
+auto
+external_vector(MDS const& mds)
+{
+    static_assert(MDS::rank() == 1);
+
+    return external_vector<OT>(mds.data_handle(), static_cast<size_t>(mds.extent(0)),
+                               static_cast<ptrdiff_t>(mds.stride(0)));
+}
+
+template<class OT = matrix_operation_traits, class MDS,
+         enable_if_t<detail::is_mdspan_like_v<MDS>, bool> = true>
+auto
+external_matrix(MDS const& mds)
+{
+    static_assert(MDS::rank() == 2);
+
+    return external_matrix<OT>(mds.data_handle(),
+                               static_cast<size_t>(mds.extent(0)), static_cast<size_t>(mds.extent(1)),
+                               static_cast<ptrdiff_t>(mds.stride(0)), static_cast<ptrdiff_t>(mds.stride(1)));
+}
+
+//==================================================================================================
+//  Conversion to a layout_stride mdspan-like type MDS, such as
+//
+//      std::mdspan<T, std::dextents<size_t, 2>, std::layout_stride>
+//
+//  which must be constructible from a pointer and a mapping_type, itself constructible from an
+//  extents_type and an array of strides.  The operand's engine must have data() or strides, and
+//  since layout_stride requires them to be non-negative, negative strides throw.
+//==================================================================================================
+//
+template<class MDS, class ET, class OT>
+MDS
+to_mdspan(vector<ET, OT>& v)
+{
+    using mapping_type = typename MDS::mapping_type;
+    using extents_type = typename MDS::extents_type;
+    using index_type   = typename extents_type::index_type;
+
+    static_assert(MDS::rank() == 1);
+    static_assert(detail::has_data_v<ET> || detail::has_stride_v<ET>);
+
+    auto&   eng = v.engine();
+
+    if constexpr (detail::has_data_v<ET>)
+    {
+        return MDS(eng.data(), mapping_type(extents_type(static_cast<index_type>(eng.elements())),
+                                            array<index_type, 1>{1}));
+    }
+    else
+    {
+        if (eng.stride() < 0)
+        {
+            throw runtime_error("invalid stride");
+        }
+        return MDS((eng.elements() == 0) ? nullptr : &eng(0),
+                   mapping_type(extents_type(static_cast<index_type>(eng.elements())),
+                                array<index_type, 1>{static_cast<index_type>(eng.stride())}));
+    }
+}
+
+template<class MDS, class ET, class OT>
+MDS
+to_mdspan(matrix<ET, OT>& m)
+{
+    using mapping_type = typename MDS::mapping_type;
+    using extents_type = typename MDS::extents_type;
+    using index_type   = typename extents_type::index_type;
+
+    static_assert(MDS::rank() == 2);
+    static_assert(detail::has_data_v<ET> || detail::has_strides_v<ET>);
+
+    auto&               eng = m.engine();
+    extents_type const  ext(static_cast<index_type>(eng.rows()), static_cast<index_type>(eng.columns()));
+
+    if constexpr (detail::has_data_v<ET>)
+    {
+        return MDS(eng.data(),
+                   mapping_type(ext, array<index_type, 2>{static_cast<index_type>(eng.column_capacity()), 1}));
+    }
+    else
+    {
+        if (eng.row_stride() < 0  ||  eng.column_stride() < 0)
+        {
+            throw runtime_error("invalid stride");
+        }
+        return MDS((eng.rows() == 0  ||  eng.columns() == 0) ? nullptr : &eng(0, 0),
+                   mapping_type(ext, array<index_type, 2>{static_cast<index_type>(eng.row_stride()),
+                                                          static_cast<index_type>(eng.column_stride())}));
+    }
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_EXTERNAL_ENGINES_HPP_DEFINED
@@ -69,6 +69,11 @@ class fs_vector_engine
     constexpr reference         operator ()(size_type i);
     constexpr const_reference   operator ()(size_type i) const;
 
+    //- Data access
+    //
+    constexpr pointer           data() noexcept;
+    constexpr const_pointer     data() const noexcept;
+
     //- Modifiers
     //
     constexpr void  swap(fs_vector_engine& rhs) noexcept;
@@ -199,6 +204,23 @@ fs_vector_engine<T,N>::operator ()(size_type i) const
     return ma_elems[i];
 }
 
+//-------------
+//- Data access
+//
+template<class T, size_t N> constexpr 
+typename fs_vector_engine<T,N>::pointer
+fs_vector_engine<T,N>::data() noexcept
+{
+    return ma_elems;
+}
+
+template<class T, size_t N> constexpr 
+typename fs_vector_engine<T,N>::const_pointer
+fs_vector_engine<T,N>::data() const noexcept
+{
+    return ma_elems;
+}
+
 //-----------
 //- Modifiers
 //
@@ -277,6 +299,11 @@ class fs_matrix_engine
     constexpr reference         operator ()(size_type i, size_type j);
     constexpr const_reference   operator ()(size_type i, size_type j) const;
 
+    //- Data access
+    //
+    constexpr pointer           data() noexcept;
+    constexpr const_pointer     data() const noexcept;
+
     //- Modifiers
     //
     constexpr void      swap(fs_matrix_engine& rhs) noexcept;
@@ -341,12 +368,12 @@ fs_matrix_engine<T,R,C>::operator =(ET2 const& rhs)
         throw runtime_error("invalid size");
     }
 
-    src_size_type   si = 0, sj = 0;
-    size_type       di = 0, dj = 0;
+    src_size_type   si, sj;
+    size_type       di, dj;
 
-    for (;  di < rows();  ++di, ++si)
+    for (di = 0, si = 0;  di < rows();  ++di, ++si)
     {
-        for (;  dj < columns();  ++dj, ++sj)
+        for (dj = 0, sj = 0;  dj < columns();  ++dj, ++sj)
         {
             (*this)(di, dj) = rhs(si, sj);
         }
@@ -417,6 +444,23 @@ fs_matrix_engine<T,R,C>::operator ()(size_type i, size_type j) const
     return ma_elems[i*C + j];
 }
 
+//-------------
+//- Data access
+//
+template<class T, size_t R, size_t C> constexpr 
+typename fs_matrix_engine<T,R,C>::pointer
+fs_matrix_engine<T,R,C>::data() noexcept
+{
+    return ma_elems;
+}
+
+template<class T, size_t R, size_t C> constexpr 
+typename fs_matrix_engine<T,R,C>::const_pointer
+fs_matrix_engine<T,R,C>::data() const noexcept
+{
+    return ma_elems;
+}
+
 //-----------
 //- Modifiers
 //
@@ -28,11 +28,21 @@ struct resizable_matrix_engine_tag : public integral_constant<int, 11> {};
 //
 template<class T, class AT>     class dr_vector_engine;
 template<class T, class AT>     class dr_matrix_engine;
+template<class T, class AT>     class low_rank_engine;
+template<class T, class AT>     class kronecker_engine;
+template<class T, class AT>     class toeplitz_engine;
+template<class T, class AT>     class circulant_engine;
+template<class T, class AT>     class permutation_engine;
+template<class T>               class shm_vector_engine;
+template<class T>               class shm_matrix_engine;
+
+template<class T, class AT, size_t TS, bool MO=false>   class tiled_matrix_engine;
 
 //- Owning engines with fixed-size internal storage.
 //
 template<class T, size_t N>             class fs_vector_engine;
 template<class T, size_t R, size_t C>   class fs_matrix_engine;
+template<class T>                       class affine_engine;
 
 //- Non-owning, view-style engines.
 //
@@ -40,6 +50,11 @@ template<class ET, class VCT>   class column_engine;
 template<class ET, class VCT>   class row_engine;
 template<class ET, class MCT>   class transpose_engine;
 template<class ET, class MCT>   class submatrix_engine;
+template<class ET, class VCT>   class diagonal_engine;
+
+template<class ET, class VCT, size_t S=0>   class slice_engine;
+template<class ET, class MCT>               class strided_matrix_engine;
+template<class ET, class VCT>               class strided_vector_engine;
 
 template<class T>   struct scalar_engine;
 
@@ -78,6 +93,11 @@ template<class OT, class OP1, class OP2>    struct matrix_addition_traits;
 template<class OT, class OP1, class OP2>    struct matrix_subtraction_traits;
 template<class OT, class OP1, class OP2>    struct matrix_multiplication_traits;
 
+//- Alternative arithmetic traits, selected by operation traits types other than the default.
+//
+template<class OT, class OP1, class OP2>    struct strassen_multiplication_traits;
+template<class OT, class OP1, class OP2>    struct semiring_multiplication_traits;
+
 //- A traits type that chooses between two operation traits types in the binary arithmetic
 //  operators and free functions that act like binary operators (e.g., outer_product()).
 //  Note that this traits class is a customization point.
@@ -0,0 +1,282 @@
+//==================================================================================================
+//  File:       gemv_coalescer.hpp
+//
+//  Summary:    This header defines a front end that coalesces concurrent matrix-vector products
+//              with one shared matrix W into matrix-matrix products.  A product W*x streams all of
+//              W from memory to do two flops per element, so it is bound by memory bandwidth;
+//              computing W*[x1 ... xb] instead streams W once for b products.
+//
+//              submit() queues a vector and returns a future for its product.  A worker thread
+//              collects queued vectors until either max_batch of them are waiting or the window
+//              has elapsed since the first of them arrived, stacks them as the columns of one
+//              matrix, multiplies with the GEMM kernel (if W has data(); otherwise, element-wise),
+//              and fulfils the futures.  Destroying the coalescer completes the queued requests.
+//
+//              W is referenced, not copied, and must not be modified or destroyed while the
+//              coalescer exists.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_GEMV_COALESCER_HPP_DEFINED
+#define LINEAR_ALGEBRA_GEMV_COALESCER_HPP_DEFINED
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace STD_LA {
+
+template<class ET, class OT>
+class gemv_coalescer
+{
+  public:
+    using matrix_type = matrix<ET, OT>;
+    using value_type  = typename ET::value_type;
+    using result_type = dyn_vector<value_type>;
+    using size_type   = size_t;
+    using window_type = std::chrono::microseconds;
+    using clock_type  = std::chrono::steady_clock;
+
+    static constexpr size_type      default_max_batch = 32;
+    static constexpr window_type    default_window    = window_type(200);
+
+    ~gemv_coalescer();
+
+    gemv_coalescer(matrix<ET, OT> const& w, size_type max_batch = default_max_batch,
+                   window_type window = default_window);
+    gemv_coalescer(gemv_coalescer const&) = delete;
+    gemv_coalescer&     operator =(gemv_coalescer const&) = delete;
+
+    template<class ET2, class OT2>
+    std::future<result_type>    submit(vector<ET2, OT2> const& x);
+
+    size_type   batches() const;
+    size_type   requests() const;
+
+  private:
+    struct request
+    {
+        std::vector<value_type>     x;
+        std::promise<result_type>   result;
+        clock_type::time_point      arrival;
+    };
+
+    matrix_type const*          mp_w;
+    size_type                   m_max_batch;
+    window_type                 m_window;
+    std::deque<request>         m_queue;
+    mutable std::mutex          m_mutex;
+    std::condition_variable     m_ready;
+    bool                        m_stop;
+    size_type                   m_batches;
+    size_type                   m_requests;
+    std::thread                 m_worker;
+
+    void    run();
+    void    multiply(std::vector<request>& batch) const;
+};
+
+template<class ET, class OT>
+gemv_coalescer<ET, OT>::~gemv_coalescer()
+{
+    {
+        std::lock_guard<std::mutex>     lock(m_mutex);
+        m_stop = true;
+    }
+    m_ready.notify_one();
+    m_worker.join();
+}
+
+template<class ET, class OT>
+gemv_coalescer<ET, OT>::gemv_coalescer(matrix<ET, OT> const& w, size_type max_batch, window_type window)
+:   mp_w(&w)
+,   m_max_batch(max(size_type(1), max_batch))
+,   m_window(window)
+,   m_queue()
+,   m_mutex()
+,   m_ready()
+,   m_stop(false)
+,   m_batches(0)
+,   m_requests(0)
+,   m_worker()
+{
+    m_worker = std::thread(&gemv_coalescer::run, this);
+}
+
+template<class ET, class OT>
+template<class ET2, class OT2>
+std::future<typename gemv_coalescer<ET, OT>::result_type>
+gemv_coalescer<ET, OT>::submit(vector<ET2, OT2> const& x)
+{
+    using src_size_type = typename vector<ET2, OT2>::size_type;
+
+    size_type const     n = static_cast<size_type>(mp_w->columns());
+
+    if (static_cast<size_type>(x.elements()) != n)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    request     req;
+
+    req.x.resize(n);
+
+    for (size_type i = 0;  i < n;  ++i)
+    {
+        req.x[i] = static_cast<value_type>(x(static_cast<src_size_type>(i)));
+    }
+
+    std::future<result_type>    fut = req.result.get_future();
+
+    {
+        std::lock_guard<std::mutex>     lock(m_mutex);
+
+        req.arrival = clock_type::now();
+        m_queue.push_back(std::move(req));
+        ++m_requests;
+    }
+    m_ready.notify_one();
+
+    return fut;
+}
+
+template<class ET, class OT>
+typename gemv_coalescer<ET, OT>::size_type
+gemv_coalescer<ET, OT>::batches() const
+{
+    std::lock_guard<std::mutex>     lock(m_mutex);
+    return m_batches;
+}
+
+template<class ET, class OT>
+typename gemv_coalescer<ET, OT>::size_type
+gemv_coalescer<ET, OT>::requests() const
+{
+    std::lock_guard<std::mutex>     lock(m_mutex);
+    return m_requests;
+}
+
+//- The worker:  waits for a first request, then until the batch is full, the window has elapsed
+//  since the oldest queued request arrived, or the coalescer is stopping, whichever comes first.
+//  Queued requests are completed before the worker exits.
+//
+template<class ET, class OT>
+void
+gemv_coalescer<ET, OT>::run()
+{
+    std::unique_lock<std::mutex>    lock(m_mutex);
+
+    for (;;)
+    {
+        m_ready.wait(lock, [this] { return m_stop  ||  !m_queue.empty(); });
+
+        if (m_queue.empty())
+        {
+            return;
+        }
+
+        auto const  deadline = m_queue.front().arrival + m_window;
+
+        m_ready.wait_until(lock, deadline,
+                           [this] { return m_stop  ||  m_queue.size() >= m_max_batch; });
+
+        std::vector<request>    batch;
+        size_type const         count = min(m_max_batch, m_queue.size());
+
+        batch.reserve(count);
+
+        for (size_type b = 0;  b < count;  ++b)
+        {
+            batch.push_back(std::move(m_queue.front()));
+            m_queue.pop_front();
+        }
+        ++m_batches;
+
+        lock.unlock();
+        multiply(batch);
+        lock.lock();
+    }
+}
+
+//- Computes Y = W*X, where the columns of X are the batch's vectors, and hands column b of Y to
+//  request b.  X and Y are row-major, so that the GEMM kernel's inner loop runs along the batch.
+//
+template<class ET, class OT>
+void
+gemv_coalescer<ET, OT>::multiply(std::vector<request>& batch) const
+{
+    using w_size_type = typename matrix_type::size_type;
+
+    try
+    {
+        size_type const     m  = static_cast<size_type>(mp_w->rows());
+        size_type const     n  = static_cast<size_type>(mp_w->columns());
+        size_type const     nb = batch.size();
+
+        std::vector<value_type>     xs(n*nb);
+        std::vector<value_type>     ys(m*nb);
+
+        for (size_type b = 0;  b < nb;  ++b)
+        {
+            for (size_type k = 0;  k < n;  ++k)
+            {
+                xs[k*nb + b] = batch[b].x[k];
+            }
+        }
+
+        if constexpr (detail::has_data_v<ET>)
+        {
+            auto const&     eng = mp_w->engine();
+
+            detail::gemm_assign_kernel(m, nb, n, eng.data(), static_cast<size_type>(eng.column_capacity()),
+                                       xs.data(), nb, ys.data(), nb);
+        }
+        else
+        {
+            for (size_type i = 0;  i < m;  ++i)
+            {
+                for (size_type k = 0;  k < n;  ++k)
+                {
+                    value_type const    wik = static_cast<value_type>
+                                                ((*mp_w)(static_cast<w_size_type>(i), static_cast<w_size_type>(k)));
+
+                    for (size_type b = 0;  b < nb;  ++b)
+                    {
+                        ys[i*nb + b] += wik * xs[k*nb + b];
+                    }
+                }
+            }
+        }
+
+        for (size_type b = 0;  b < nb;  ++b)
+        {
+            result_type     y(m);
+
+            for (size_type i = 0;  i < m;  ++i)
+            {
+                y(i) = ys[i*nb + b];
+            }
+            batch[b].result.set_value(std::move(y));
+        }
+    }
+    catch (...)
+    {
+        for (auto& req : batch)
+        {
+            try
+            {
+                req.result.set_exception(std::current_exception());
+            }
+            catch (std::future_error const&)
+            {
+                //- This request's value was already set.
+            }
+        }
+    }
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_GEMV_COALESCER_HPP_DEFINED
@@ -0,0 +1,292 @@
+//==================================================================================================
+//  File:       geometry.hpp
+//
+//  Summary:    This header defines some basic 3D geometry operations on 3- and 4-element vectors:
+//              cross product, length, normalization, and rotation by unit quaternions.  These
+//              work with any vector engine, including user-defined compact engines, and return
+//              results of the same type as the (first) operand.  Quaternions are 4-vectors that
+//              hold (x, y, z, w), with w the scalar part.
+//
+//              The batch_*() functions operate on arrays of 3-vectors in structure-of-arrays
+//              layout, i.e., with separate arrays of x, y, and z coordinates.  Their loops are
+//              free of branches and of cross-iteration dependencies, so the compiler vectorizes
+//              them across points.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_GEOMETRY_HPP_DEFINED
+#define LINEAR_ALGEBRA_GEOMETRY_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+
+template<class ET, class OT>
+void
+geom_check_size(vector<ET, OT> const& v, size_t n)
+{
+    if (static_cast<size_t>(v.elements()) != n)
+    {
+        throw runtime_error("invalid size");
+    }
+}
+
+//- Returns an uninitialized vector of type VT holding n elements.
+//
+template<class VT>
+VT
+geom_make_vector(size_t n)
+{
+    using size_type = typename VT::size_type;
+
+    VT  vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(static_cast<size_type>(n));
+    }
+    return vr;
+}
+
+//- The quaternion rotation of (x, y, z) by unit quaternion (qx, qy, qz, qw), written as
+//  v + 2w(q x v) + 2(q x (q x v)), which needs fewer operations than q*v*conj(q).
+//
+template<class T>
+inline void
+quaternion_rotate3(T qx, T qy, T qz, T qw, T& x, T& y, T& z)
+{
+    T const     tx = T(2) * (qy*z - qz*y);
+    T const     ty = T(2) * (qz*x - qx*z);
+    T const     tz = T(2) * (qx*y - qy*x);
+
+    T const     rx = x + qw*tx + (qy*tz - qz*ty);
+    T const     ry = y + qw*ty + (qz*tx - qx*tz);
+    T const     rz = z + qw*tz + (qx*ty - qy*tx);
+
+    x = rx;
+    y = ry;
+    z = rz;
+}
+
+}       //- detail namespace
+//==================================================================================================
+//                                  **** 3-VECTOR OPERATIONS ****
+//==================================================================================================
+//
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+cross(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2) -> vector<ET1, OT1>
+{
+    using size_type_r = typename vector<ET1, OT1>::size_type;
+
+    detail::geom_check_size(v1, 3);
+    detail::geom_check_size(v2, 3);
+
+    auto const  x1 = v1(0), y1 = v1(1), z1 = v1(2);
+    auto const  x2 = v2(0), y2 = v2(1), z2 = v2(2);
+    auto        vr = detail::geom_make_vector<vector<ET1, OT1>>(3);
+
+    vr(static_cast<size_type_r>(0)) = y1*z2 - z1*y2;
+    vr(static_cast<size_type_r>(1)) = z1*x2 - x1*z2;
+    vr(static_cast<size_type_r>(2)) = x1*y2 - y1*x2;
+
+    return vr;
+}
+
+//- Squared Euclidean length, for vectors of any size.
+//
+template<class ET, class OT>
+auto
+length_squared(vector<ET, OT> const& v) -> typename vector<ET, OT>::element_type
+{
+    using size_type = typename vector<ET, OT>::size_type;
+    using elem_type = typename vector<ET, OT>::element_type;
+
+    elem_type   sum{};
+
+    for (size_type i = 0;  i < v.elements();  ++i)
+    {
+        sum += v(i) * v(i);
+    }
+    return sum;
+}
+
+template<class ET, class OT>
+auto
+length(vector<ET, OT> const& v) -> typename vector<ET, OT>::element_type
+{
+    return sqrt(length_squared(v));
+}
+
+//- Returns v scaled to unit length; the zero vector is returned unchanged.
+//
+template<class ET, class OT>
+auto
+normalize(vector<ET, OT> const& v) -> vector<ET, OT>
+{
+    using size_type = typename vector<ET, OT>::size_type;
+    using elem_type = typename vector<ET, OT>::element_type;
+
+    elem_type const     len2  = length_squared(v);
+    elem_type const     scale = (len2 > elem_type(0)) ? elem_type(1) / sqrt(len2) : elem_type(1);
+    auto                vr    = detail::geom_make_vector<vector<ET, OT>>(static_cast<size_t>(v.elements()));
+
+    for (size_type i = 0;  i < v.elements();  ++i)
+    {
+        vr(i) = v(i) * scale;
+    }
+    return vr;
+}
+
+//==================================================================================================
+//                                    **** QUATERNIONS ****
+//==================================================================================================
+//  Hamilton product q1*q2; the result is of the same type as q1.
+//
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+quaternion_multiply(vector<ET1, OT1> const& q1, vector<ET2, OT2> const& q2) -> vector<ET1, OT1>
+{
+    using size_type_r = typename vector<ET1, OT1>::size_type;
+
+    detail::geom_check_size(q1, 4);
+    detail::geom_check_size(q2, 4);
+
+    auto const  x1 = q1(0), y1 = q1(1), z1 = q1(2), w1 = q1(3);
+    auto const  x2 = q2(0), y2 = q2(1), z2 = q2(2), w2 = q2(3);
+    auto        qr = detail::geom_make_vector<vector<ET1, OT1>>(4);
+
+    qr(static_cast<size_type_r>(0)) = w1*x2 + x1*w2 + y1*z2 - z1*y2;
+    qr(static_cast<size_type_r>(1)) = w1*y2 - x1*z2 + y1*w2 + z1*x2;
+    qr(static_cast<size_type_r>(2)) = w1*z2 + x1*y2 - y1*x2 + z1*w2;
+    qr(static_cast<size_type_r>(3)) = w1*w2 - x1*x2 - y1*y2 - z1*z2;
+
+    return qr;
+}
+
+//- Returns the unit quaternion that rotates by angle radians about the given axis, which need not
+//  be normalized.  The result has the 4-vector type QT, which must be given explicitly, e.g.,
+//  quaternion_from_axis_angle<fs_vector<float, 4>>(axis, angle).
+//
+template<class QT, class ET2, class OT2, class T>
+auto
+quaternion_from_axis_angle(vector<ET2, OT2> const& axis, T angle) -> QT
+{
+    using size_type_r = typename QT::size_type;
+    using elem_type   = typename QT::element_type;
+
+    detail::geom_check_size(axis, 3);
+
+    elem_type const     len = length(axis);
+    elem_type const     s   = (len > elem_type(0)) ? sin(angle / T(2)) / len : elem_type(0);
+    auto                qr  = detail::geom_make_vector<QT>(4);
+
+    qr(static_cast<size_type_r>(0)) = axis(0) * s;
+    qr(static_cast<size_type_r>(1)) = axis(1) * s;
+    qr(static_cast<size_type_r>(2)) = axis(2) * s;
+    qr(static_cast<size_type_r>(3)) = cos(angle / T(2));
+
+    return qr;
+}
+
+//- Rotates the 3-vector v by the unit quaternion q; the result has the type of v.
+//
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+quaternion_rotate(vector<ET1, OT1> const& q, vector<ET2, OT2> const& v) -> vector<ET2, OT2>
+{
+    using size_type_r = typename vector<ET2, OT2>::size_type;
+    using elem_type   = typename vector<ET2, OT2>::element_type;
+
+    detail::geom_check_size(q, 4);
+    detail::geom_check_size(v, 3);
+
+    elem_type   x = v(0), y = v(1), z = v(2);
+    auto        vr = detail::geom_make_vector<vector<ET2, OT2>>(3);
+
+    detail::quaternion_rotate3<elem_type>(q(0), q(1), q(2), q(3), x, y, z);
+
+    vr(static_cast<size_type_r>(0)) = x;
+    vr(static_cast<size_type_r>(1)) = y;
+    vr(static_cast<size_type_r>(2)) = z;
+
+    return vr;
+}
+
+//==================================================================================================
+//                              **** BATCHED STRUCTURE-OF-ARRAYS ****
+//==================================================================================================
+//  Each function processes n points whose coordinates are stored in separate arrays.  Output
+//  arrays may be the same as the corresponding input arrays, but must not otherwise overlap them.
+//==================================================================================================
+//
+template<class T>
+void
+batch_length(T const* p_x, T const* p_y, T const* p_z, T* p_len, size_t n)
+{
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        p_len[i] = sqrt(p_x[i]*p_x[i] + p_y[i]*p_y[i] + p_z[i]*p_z[i]);
+    }
+}
+
+//- Normalizes n points in place; zero vectors are left unchanged.
+//
+template<class T>
+void
+batch_normalize(T* p_x, T* p_y, T* p_z, size_t n)
+{
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        T const     x = p_x[i], y = p_y[i], z = p_z[i];
+        T const     len2  = x*x + y*y + z*z;
+        T const     scale = (len2 > T(0)) ? T(1) / sqrt(len2) : T(1);
+
+        p_x[i] = x * scale;
+        p_y[i] = y * scale;
+        p_z[i] = z * scale;
+    }
+}
+
+template<class T>
+void
+batch_cross(T const* p_ax, T const* p_ay, T const* p_az,
+            T const* p_bx, T const* p_by, T const* p_bz,
+            T* p_rx, T* p_ry, T* p_rz, size_t n)
+{
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        T const     ax = p_ax[i], ay = p_ay[i], az = p_az[i];
+        T const     bx = p_bx[i], by = p_by[i], bz = p_bz[i];
+
+        p_rx[i] = ay*bz - az*by;
+        p_ry[i] = az*bx - ax*bz;
+        p_rz[i] = ax*by - ay*bx;
+    }
+}
+
+//- Rotates n points in place by the unit quaternion q (any 4-element vector).
+//
+template<class ET, class OT, class T>
+void
+batch_quaternion_rotate(vector<ET, OT> const& q, T* p_x, T* p_y, T* p_z, size_t n)
+{
+    detail::geom_check_size(q, 4);
+
+    T const     qx = static_cast<T>(q(0));
+    T const     qy = static_cast<T>(q(1));
+    T const     qz = static_cast<T>(q(2));
+    T const     qw = static_cast<T>(q(3));
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        T   x = p_x[i], y = p_y[i], z = p_z[i];
+
+        detail::quaternion_rotate3(qx, qy, qz, qw, x, y, z);
+
+        p_x[i] = x;
+        p_y[i] = y;
+        p_z[i] = z;
+    }
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_GEOMETRY_HPP_DEFINED
@@ -0,0 +1,178 @@
+//==================================================================================================
+//  File:       huge_page_allocator.hpp
+//
+//  Summary:    This header defines an allocator for the dynamic engines that backs large buffers
+//              with huge pages, reducing the TLB misses incurred by kernels that stream through
+//              large matrices.  Buffers of at least huge_page_size bytes are rounded up to a
+//              multiple of that size and aligned to it; smaller buffers are obtained as from
+//              std::allocator.  Two sources of huge pages are supported:
+//
+//                - transparent:  an anonymous mapping advised with MADV_HUGEPAGE, which the
+//                  kernel backs with transparent huge pages where it can.
+//
+//                - hugetlb:  an explicit MAP_HUGETLB mapping from the reserved huge page pool;
+//                  if the pool cannot satisfy the request, the transparent method is used.
+//
+//              On platforms other than Linux, large buffers are merely aligned to huge_page_size.
+//              Since the allocator is rebindable, the results of arithmetic on matrices that use
+//              it use it too.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_HUGE_PAGE_ALLOCATOR_HPP_DEFINED
+#define LINEAR_ALGEBRA_HUGE_PAGE_ALLOCATOR_HPP_DEFINED
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace STD_LA {
+
+enum class huge_page_source
+{
+    transparent,
+    hugetlb
+};
+
+template<class T, huge_page_source S = huge_page_source::transparent>
+class huge_page_allocator
+{
+  public:
+    using value_type      = T;
+    using pointer         = T*;
+    using const_pointer   = T const*;
+    using size_type       = size_t;
+    using difference_type = ptrdiff_t;
+    using is_always_equal = true_type;
+
+    template<class U>
+    struct rebind
+    {
+        using other = huge_page_allocator<U, S>;
+    };
+
+    static constexpr huge_page_source   source         = S;
+    static constexpr size_type          huge_page_size = size_type(2) << 20;
+
+    huge_page_allocator() noexcept = default;
+    template<class U>
+    huge_page_allocator(huge_page_allocator<U, S> const&) noexcept {}
+
+    pointer     allocate(size_type n);
+    void        deallocate(pointer p, size_type n) noexcept;
+
+    static bool         uses_huge_pages(size_type n) noexcept;
+    static size_type    mapping_size(size_type n) noexcept;
+};
+
+template<class T1, huge_page_source S1, class T2, huge_page_source S2> inline
+bool
+operator ==(huge_page_allocator<T1, S1> const&, huge_page_allocator<T2, S2> const&) noexcept
+{
+    return true;
+}
+
+template<class T1, huge_page_source S1, class T2, huge_page_source S2> inline
+bool
+operator !=(huge_page_allocator<T1, S1> const&, huge_page_allocator<T2, S2> const&) noexcept
+{
+    return false;
+}
+
+template<class T, huge_page_source S>
+typename huge_page_allocator<T,S>::pointer
+huge_page_allocator<T,S>::allocate(size_type n)
+{
+    if (n > (numeric_limits<size_type>::max() - 2*huge_page_size) / sizeof(T))
+    {
+        throw bad_array_new_length();
+    }
+    if (!uses_huge_pages(n))
+    {
+        return allocator<T>().allocate(n);
+    }
+
+    size_type const     size = mapping_size(n);
+
+#if defined(__linux__)
+    int const   prot  = PROT_READ | PROT_WRITE;
+    int const   flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#if defined(MAP_HUGETLB)
+    if constexpr (S == huge_page_source::hugetlb)
+    {
+        void*   p_map = ::mmap(nullptr, size, prot, flags | MAP_HUGETLB, -1, 0);
+
+        if (p_map != MAP_FAILED)
+        {
+            return static_cast<pointer>(p_map);
+        }
+    }
+#endif
+
+    //- Over-map by one huge page, then trim the ends so that the mapping is aligned.
+    //
+    void*   p_map = ::mmap(nullptr, size + huge_page_size, prot, flags, -1, 0);
+
+    if (p_map == MAP_FAILED)
+    {
+        throw bad_alloc();
+    }
+
+    uintptr_t const     mask   = ~uintptr_t(huge_page_size - 1);
+    char*               p_raw  = static_cast<char*>(p_map);
+    char*               p_base = reinterpret_cast<char*>
+                                    ((reinterpret_cast<uintptr_t>(p_raw) + huge_page_size - 1) & mask);
+
+    if (p_base != p_raw)
+    {
+        ::munmap(p_raw, size_type(p_base - p_raw));
+    }
+    if (p_base + size != p_raw + size + huge_page_size)
+    {
+        ::munmap(p_base + size, size_type((p_raw + size + huge_page_size) - (p_base + size)));
+    }
+#if defined(MADV_HUGEPAGE)
+    ::madvise(p_base, size, MADV_HUGEPAGE);
+#endif
+    return reinterpret_cast<pointer>(p_base);
+#else
+    return static_cast<pointer>(::operator new(size, align_val_t(huge_page_size)));
+#endif
+}
+
+template<class T, huge_page_source S>
+void
+huge_page_allocator<T,S>::deallocate(pointer p, size_type n) noexcept
+{
+    if (!uses_huge_pages(n))
+    {
+        allocator<T>().deallocate(p, n);
+        return;
+    }
+#if defined(__linux__)
+    ::munmap(p, mapping_size(n));
+#else
+    ::operator delete(p, align_val_t(huge_page_size));
+#endif
+}
+
+//- Returns whether a buffer of n elements is backed by huge pages.
+//
+template<class T, huge_page_source S> inline
+bool
+huge_page_allocator<T,S>::uses_huge_pages(size_type n) noexcept
+{
+    return n*sizeof(T) >= huge_page_size;
+}
+
+//- Returns the size in bytes of the mapping that backs a buffer of n elements.
+//
+template<class T, huge_page_source S> inline
+typename huge_page_allocator<T,S>::size_type
+huge_page_allocator<T,S>::mapping_size(size_type n) noexcept
+{
+    return (n*sizeof(T) + huge_page_size - 1) & ~(huge_page_size - 1);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_HUGE_PAGE_ALLOCATOR_HPP_DEFINED
@@ -0,0 +1,632 @@
+//==================================================================================================
+//  File:       kronecker_engine.hpp
+//
+//  Summary:    This header defines a read-only matrix engine that represents the Kronecker
+//              product A (x) B of an Ra x Ca matrix A and an Rb x Cb matrix B without forming it,
+//
+//                  (A (x) B)(i, j) = A(i / Rb, j / Cb) * B(i % Rb, j % Cb),
+//
+//              storing Ra*Ca + Rb*Cb elements rather than (Ra*Rb)*(Ca*Cb).  Multiplication traits
+//              specializations are also provided so that a product with a vector x is computed
+//              by the "vec trick" as the two small products A * X * B^T, where X is x viewed as a
+//              row-major Ca x Cb matrix, in O(Ra*Ca*Cb + Ra*Cb*Rb) operations.  Products with
+//              matrices apply the same method to all of their columns (or rows) at once, as two
+//              GEMMs; the product of two Kronecker products is (A1*A2) (x) (B1*B2) when the
+//              factors' shapes conform.
+//
+//              Kronecker products are created with the free function kronecker_product().
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_KRONECKER_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_KRONECKER_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+//==================================================================================================
+//  Kronecker-product engine.  The (small) factors are copied into dynamically-resizable engines
+//  using the given allocator type, so that the engine does not depend on their lifetimes.
+//==================================================================================================
+//
+template<class T, class AT>
+class kronecker_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using allocator_type  = AT;
+    using pointer         = element_type const*;
+    using const_pointer   = element_type const*;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    using factor_type     = dr_matrix_engine<T, AT>;
+
+    //- Construct/copy/destroy
+    //
+    ~kronecker_engine() noexcept = default;
+
+    kronecker_engine() = default;
+    kronecker_engine(kronecker_engine&&) noexcept = default;
+    kronecker_engine(kronecker_engine const&) = default;
+    template<class ET1, class ET2>
+    kronecker_engine(ET1 const& a, ET2 const& b);
+
+    kronecker_engine&   operator =(kronecker_engine&&) noexcept = default;
+    kronecker_engine&   operator =(kronecker_engine const&) = default;
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    //- Element access
+    //
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    //- Factor access
+    //
+    factor_type const&  left_factor() const noexcept;
+    factor_type const&  right_factor() const noexcept;
+
+    //- Modifiers
+    //
+    void    swap(kronecker_engine& rhs) noexcept;
+
+  private:
+    factor_type     m_a;
+    factor_type     m_b;
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class AT>
+template<class ET1, class ET2>
+kronecker_engine<T,AT>::kronecker_engine(ET1 const& a, ET2 const& b)
+:   m_a()
+,   m_b()
+{
+    m_a = a;
+    m_b = b;
+}
+
+//----------
+//- Capacity
+//
+template<class T, class AT> inline
+typename kronecker_engine<T,AT>::size_type
+kronecker_engine<T,AT>::columns() const noexcept
+{
+    return m_a.columns() * m_b.columns();
+}
+
+template<class T, class AT> inline
+typename kronecker_engine<T,AT>::size_type
+kronecker_engine<T,AT>::rows() const noexcept
+{
+    return m_a.rows() * m_b.rows();
+}
+
+template<class T, class AT> inline
+typename kronecker_engine<T,AT>::size_tuple
+kronecker_engine<T,AT>::size() const noexcept
+{
+    return size_tuple(rows(), columns());
+}
+
+template<class T, class AT> inline
+typename kronecker_engine<T,AT>::size_type
+kronecker_engine<T,AT>::column_capacity() const noexcept
+{
+    return columns();
+}
+
+template<class T, class AT> inline
+typename kronecker_engine<T,AT>::size_type
+kronecker_engine<T,AT>::row_capacity() const noexcept
+{
+    return rows();
+}
+
+template<class T, class AT> inline
+typename kronecker_engine<T,AT>::size_tuple
+kronecker_engine<T,AT>::capacity() const noexcept
+{
+    return size_tuple(rows(), columns());
+}
+
+//----------------
+//- Element access
+//
+template<class T, class AT> inline
+typename kronecker_engine<T,AT>::const_reference
+kronecker_engine<T,AT>::operator ()(size_type i, size_type j) const
+{
+    size_type const     rb = m_b.rows();
+    size_type const     cb = m_b.columns();
+
+    //- An empty factor makes the product empty, and would make the index arithmetic divide by zero.
+    //
+    if (rb == 0  ||  cb == 0)
+    {
+        throw runtime_error("invalid index");
+    }
+    return m_a(i / rb, j / cb) * m_b(i % rb, j % cb);
+}
+
+//---------------
+//- Factor access
+//
+template<class T, class AT> inline
+typename kronecker_engine<T,AT>::factor_type const&
+kronecker_engine<T,AT>::left_factor() const noexcept
+{
+    return m_a;
+}
+
+template<class T, class AT> inline
+typename kronecker_engine<T,AT>::factor_type const&
+kronecker_engine<T,AT>::right_factor() const noexcept
+{
+    return m_b;
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class AT> inline
+void
+kronecker_engine<T,AT>::swap(kronecker_engine& rhs) noexcept
+{
+    m_a.swap(rhs.m_a);
+    m_b.swap(rhs.m_b);
+}
+
+//==================================================================================================
+//                                  **** KRONECKER PRODUCTS ****
+//==================================================================================================
+//  Returns the Kronecker product A (x) B, unevaluated.  The element type is that of the product
+//  of the factors' elements, and the operation traits are those of A.
+//==================================================================================================
+//
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+kronecker_product(matrix<ET1, OT1> const& a, matrix<ET2, OT2> const& b)
+{
+    using elem_type   = matrix_multiplication_element_t<OT1, typename ET1::value_type,
+                                                        typename ET2::value_type>;
+    using engine_type = kronecker_engine<elem_type, allocator<elem_type>>;
+
+    matrix<engine_type, OT1>    mr;
+
+    mr.engine() = engine_type(a.engine(), b.engine());
+    return mr;
+}
+
+namespace detail {
+//==================================================================================================
+//  Product kernel.  Computes y_v = (A (x) B) x_v, or y_v^T = x_v^T (A (x) B) if TR is true, for
+//  the nv operands x_v, where the callable 'x(v, k)' returns element k of x_v.  The results are
+//  returned in one array, y_v in elements [v*R, (v + 1)*R), where R is the length of each y_v.
+//
+//  With op(A) = A or A^T and op(B) = B or B^T, y_v is the row-major matrix op(A) * X_v * op(B)^T,
+//  where X_v is x_v viewed as a row-major Ca x Cb matrix.  The X_v are placed side by side in one
+//  Ca x (nv*Cb) matrix, so that op(A) * [X_0 ... X_nv-1] is a single GEMM; its result, read as an
+//  (Ra*nv) x Cb matrix, is then multiplied by op(B)^T in a second GEMM.
+//==================================================================================================
+//
+template<bool TR, class ET>
+inline auto
+kronecker_at(ET const& eng, size_t i, size_t j)
+{
+    if constexpr (TR)
+        return eng(j, i);
+    else
+        return eng(i, j);
+}
+
+template<bool TR, class T, class AT, class XF>
+std::vector<T>
+kronecker_vec(dr_matrix_engine<T, AT> const& a, dr_matrix_engine<T, AT> const& b, size_t nv,
+              XF const& x)
+{
+    size_t const    ra = TR ? a.columns() : a.rows();
+    size_t const    ca = TR ? a.rows() : a.columns();
+    size_t const    rb = TR ? b.columns() : b.rows();
+    size_t const    cb = TR ? b.rows() : b.columns();
+    size_t const    nx = nv*cb;
+
+    std::vector<T>  af(ra*ca), bt(cb*rb);
+    std::vector<T>  xs(ca*nx), w(ra*nx), yw(ra*nv*rb), y(nv*ra*rb);
+
+    //- op(A), and op(B)^T, as compact row-major arrays.
+    //
+    for (size_t i1 = 0;  i1 < ra;  ++i1)
+    {
+        for (size_t p = 0;  p < ca;  ++p)
+        {
+            af[i1*ca + p] = kronecker_at<TR>(a, i1, p);
+        }
+    }
+    for (size_t q = 0;  q < cb;  ++q)
+    {
+        for (size_t i2 = 0;  i2 < rb;  ++i2)
+        {
+            bt[q*rb + i2] = kronecker_at<TR>(b, i2, q);
+        }
+    }
+
+    //- [X_0 ... X_nv-1], where X_v(p, q) = x_v(p*cb + q).
+    //
+    for (size_t v = 0;  v < nv;  ++v)
+    {
+        for (size_t p = 0;  p < ca;  ++p)
+        {
+            for (size_t q = 0;  q < cb;  ++q)
+            {
+                xs[p*nx + v*cb + q] = static_cast<T>(x(v, p*cb + q));
+            }
+        }
+    }
+
+    //- W = op(A) * [X_0 ... X_nv-1], whose row (i1*nv + v) as an (ra*nv) x cb matrix is row i1
+    //  of op(A) * X_v; then YW = W * op(B)^T.
+    //
+    gemm_assign_kernel(ra, nx, ca, af.data(), ca, xs.data(), nx, w.data(), nx);
+    gemm_assign_kernel(ra*nv, rb, cb, w.data(), cb, bt.data(), rb, yw.data(), rb);
+
+    for (size_t v = 0;  v < nv;  ++v)
+    {
+        for (size_t i1 = 0;  i1 < ra;  ++i1)
+        {
+            std::copy_n(yw.data() + (i1*nv + v)*rb, rb, y.data() + (v*ra + i1)*rb);
+        }
+    }
+    return y;
+}
+
+}       //- detail namespace
+//==================================================================================================
+//                        **** KRONECKER ENGINE MULTIPLICATION TRAITS ****
+//==================================================================================================
+//  Engine promotion:  the product of two Kronecker products is a Kronecker product.  Products
+//  involving their transposes are dense; all other combinations use the defaults.
+//==================================================================================================
+//
+template<class OT, class T1, class A1, class T2, class A2>
+struct matrix_multiplication_engine_traits<OT, kronecker_engine<T1, A1>, kronecker_engine<T2, A2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = kronecker_engine<element_type, alloc_type>;
+};
+
+template<class OT, class T1, class A1, class T2, class A2, class MCT2>
+struct matrix_multiplication_engine_traits<OT, kronecker_engine<T1, A1>,
+                                               transpose_engine<kronecker_engine<T2, A2>, MCT2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+};
+
+template<class OT, class T1, class A1, class MCT1, class T2, class A2>
+struct matrix_multiplication_engine_traits<OT, transpose_engine<kronecker_engine<T1, A1>, MCT1>,
+                                               kronecker_engine<T2, A2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+};
+
+template<class OT, class T1, class A1, class MCT1, class T2, class A2, class MCT2>
+struct matrix_multiplication_engine_traits<OT, transpose_engine<kronecker_engine<T1, A1>, MCT1>,
+                                               transpose_engine<kronecker_engine<T2, A2>, MCT2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+};
+
+//--------------------------------------------------------------------------------------------------
+//  Arithmetic.
+//--------------------------------------------------------------------------------------------------
+//
+//- kronecker*vector:  vec(A * X * B^T).
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<kronecker_engine<T1, A1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, kronecker_engine<T1, A1>, ET2>;
+    using op_traits    = OT;
+    using result_type  = vector<engine_type, op_traits>;
+
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<kronecker_engine<T1, A1>, OT1> const& m1,
+                                 vector<ET2, OT2> const& v2);
+};
+
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OT, matrix<kronecker_engine<T1, A1>, OT1>, vector<ET2, OT2>>::multiply
+(matrix<kronecker_engine<T1, A1>, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (kronecker*v)", m1, v2);
+
+    auto const&     eng = m1.engine();
+
+    if (static_cast<size_t>(v2.elements()) != eng.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    auto const  y = detail::kronecker_vec<false>(eng.left_factor(), eng.right_factor(), 1,
+                                                 [&v2](size_t, size_t k) { return v2(static_cast<size_type_2>(k)); });
+    result_type vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(static_cast<size_type_r>(y.size()));
+    }
+    for (size_t i = 0;  i < y.size();  ++i)
+    {
+        vr(static_cast<size_type_r>(i)) = y[i];
+    }
+    return vr;
+}
+
+//- vector*kronecker:  vec(A^T * X * B), since x^T (A (x) B) = ((A^T (x) B^T) x)^T.
+//
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+struct matrix_multiplication_traits<OT, vector<ET1, OT1>, matrix<kronecker_engine<T2, A2>, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, ET1, kronecker_engine<T2, A2>>;
+    using op_traits    = OT;
+    using result_type  = vector<engine_type, op_traits>;
+
+    using size_type_1 = typename vector<ET1, OT1>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(vector<ET1, OT1> const& v1,
+                                 matrix<kronecker_engine<T2, A2>, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+inline auto
+matrix_multiplication_traits<OT, vector<ET1, OT1>, matrix<kronecker_engine<T2, A2>, OT2>>::multiply
+(vector<ET1, OT1> const& v1, matrix<kronecker_engine<T2, A2>, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (v*kronecker)", v1, m2);
+
+    auto const&     eng = m2.engine();
+
+    if (static_cast<size_t>(v1.elements()) != eng.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    auto const  y = detail::kronecker_vec<true>(eng.left_factor(), eng.right_factor(), 1,
+                                                [&v1](size_t, size_t k) { return v1(static_cast<size_type_1>(k)); });
+    result_type vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(static_cast<size_type_r>(y.size()));
+    }
+    for (size_t i = 0;  i < y.size();  ++i)
+    {
+        vr(static_cast<size_type_r>(i)) = y[i];
+    }
+    return vr;
+}
+
+//- Products with other matrices go through detail::matrix_product_traits (see
+//  multiplication_traits.hpp).
+//
+namespace detail {
+
+template<class T, class A>
+struct structured_multiplication_priority<kronecker_engine<T, A>>
+:   public integral_constant<int, 2>
+{};
+
+//- kronecker*matrix:  column j of the result is the product with column j of the operand.
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_product_traits<OT, matrix<kronecker_engine<T1, A1>, OT1>, matrix<ET2, OT2>,
+                             structured_side::left>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, kronecker_engine<T1, A1>, ET2>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    using size_type_2 = typename matrix<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<kronecker_engine<T1, A1>, OT1> const& m1,
+                                 matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_product_traits<OT, matrix<kronecker_engine<T1, A1>, OT1>, matrix<ET2, OT2>,
+                      structured_side::left>::multiply
+(matrix<kronecker_engine<T1, A1>, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (kronecker*m)", m1, m2);
+
+    auto const&     eng = m1.engine();
+
+    if (static_cast<size_t>(m2.rows()) != eng.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_t const    rows = eng.rows();
+    size_t const    cols = static_cast<size_t>(m2.columns());
+    auto const      y    = kronecker_vec<false>(eng.left_factor(), eng.right_factor(), cols,
+                                                [&m2](size_t j, size_t k)
+                                                { return m2(static_cast<size_type_2>(k),
+                                                            static_cast<size_type_2>(j)); });
+    result_type     mr;
+
+    if constexpr (result_requires_resize(mr))
+    {
+        mr.resize(static_cast<size_type_r>(rows), static_cast<size_type_r>(cols));
+    }
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            mr(static_cast<size_type_r>(i), static_cast<size_type_r>(j)) = y[j*rows + i];
+        }
+    }
+    return mr;
+}
+
+//- matrix*kronecker:  row i of the result is the product of row i of the operand.
+//
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+struct matrix_product_traits<OT, matrix<ET1, OT1>, matrix<kronecker_engine<T2, A2>, OT2>,
+                             structured_side::right>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, ET1, kronecker_engine<T2, A2>>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<ET1, OT1>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<ET1, OT1> const& m1,
+                                 matrix<kronecker_engine<T2, A2>, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+inline auto
+matrix_product_traits<OT, matrix<ET1, OT1>, matrix<kronecker_engine<T2, A2>, OT2>,
+                      structured_side::right>::multiply
+(matrix<ET1, OT1> const& m1, matrix<kronecker_engine<T2, A2>, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (m*kronecker)", m1, m2);
+
+    auto const&     eng = m2.engine();
+
+    if (static_cast<size_t>(m1.columns()) != eng.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_t const    rows = static_cast<size_t>(m1.rows());
+    size_t const    cols = eng.columns();
+    auto const      y    = kronecker_vec<true>(eng.left_factor(), eng.right_factor(), rows,
+                                               [&m1](size_t i, size_t k)
+                                               { return m1(static_cast<size_type_1>(i),
+                                                           static_cast<size_type_1>(k)); });
+    result_type     mr;
+
+    if constexpr (result_requires_resize(mr))
+    {
+        mr.resize(static_cast<size_type_r>(rows), static_cast<size_type_r>(cols));
+    }
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            mr(static_cast<size_type_r>(i), static_cast<size_type_r>(j)) = y[i*cols + j];
+        }
+    }
+    return mr;
+}
+
+//- kronecker*kronecker:  (A1 (x) B1) * (A2 (x) B2) = (A1 * A2) (x) (B1 * B2) when the factors'
+//  shapes conform.  Otherwise the product is formed by the vec trick, and held as the Kronecker
+//  product [1] (x) P of a 1 x 1 identity and the dense product P.
+//
+template<class OT, class T1, class A1, class OT1, class T2, class A2, class OT2>
+struct matrix_product_traits<OT, matrix<kronecker_engine<T1, A1>, OT1>,
+                                 matrix<kronecker_engine<T2, A2>, OT2>, structured_side::left>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, kronecker_engine<T1, A1>,
+                                                            kronecker_engine<T2, A2>>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    static result_type  multiply(matrix<kronecker_engine<T1, A1>, OT1> const& m1,
+                                 matrix<kronecker_engine<T2, A2>, OT2> const& m2);
+};
+
+template<class OT, class T1, class A1, class OT1, class T2, class A2, class OT2>
+inline auto
+matrix_product_traits<OT, matrix<kronecker_engine<T1, A1>, OT1>,
+                          matrix<kronecker_engine<T2, A2>, OT2>, structured_side::left>::multiply
+(matrix<kronecker_engine<T1, A1>, OT1> const& m1, matrix<kronecker_engine<T2, A2>, OT2> const& m2)
+    -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (kronecker*kronecker)", m1, m2);
+
+    using factor_type = matrix<typename engine_type::factor_type>;
+    using elem_type   = typename engine_type::value_type;
+
+    auto const&     eng1 = m1.engine();
+    auto const&     eng2 = m2.engine();
+    result_type     mr;
+
+    if (eng1.columns() != eng2.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    if (eng1.left_factor().columns() == eng2.left_factor().rows()  &&
+        eng1.right_factor().columns() == eng2.right_factor().rows())
+    {
+        factor_type     a1, b1, a2, b2;
+
+        a1.engine() = eng1.left_factor();
+        b1.engine() = eng1.right_factor();
+        a2.engine() = eng2.left_factor();
+        b2.engine() = eng2.right_factor();
+
+        factor_type const   a = a1 * a2;
+        factor_type const   b = b1 * b2;
+
+        mr.engine() = engine_type(a.engine(), b.engine());
+    }
+    else
+    {
+        size_t const    rows = eng1.rows();
+        size_t const    cols = eng2.columns();
+        auto const      y    = kronecker_vec<false>(eng1.left_factor(), eng1.right_factor(), cols,
+                                                    [&eng2](size_t j, size_t k)
+                                                    { return eng2(k, j); });
+        factor_type     one(1, 1);
+        factor_type     p(rows, cols);
+
+        one(0, 0) = elem_type(1);
+
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            for (size_t j = 0;  j < cols;  ++j)
+            {
+                p(i, j) = y[j*rows + i];
+            }
+        }
+        mr.engine() = engine_type(one.engine(), p.engine());
+    }
+    return mr;
+}
+
+}       //- detail namespace
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_KRONECKER_ENGINE_HPP_DEFINED
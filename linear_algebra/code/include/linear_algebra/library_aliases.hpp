@@ -29,5 +29,11 @@ using fs_vector = vector<fs_vector_engine<T, N>>;
 template<class T, size_t R, size_t C>
 using fs_matrix = matrix<fs_matrix_engine<T, R, C>>;
 
+
+//- Alias for matrix objects based on the tiled engine.
+//
+template<class T, size_t TS, bool MO = false, class A = allocator<T>>
+using tiled_matrix = matrix<tiled_matrix_engine<T, A, TS, MO>>;
+
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_LIBRARY_ALIASES_HPP_DEFINED
@@ -0,0 +1,866 @@
+//==================================================================================================
+//  File:       low_rank_engine.hpp
+//
+//  Summary:    This header defines a read-only matrix engine that represents an R x C matrix of
+//              rank at most K in factored form,
+//
+//                  A = U * diag(s) * V^T,      U is R x K,  s has K elements,  V is C x K,
+//
+//              storing (R + C + 1)*K elements rather than R*C.  Element access costs O(K).
+//              Multiplication traits specializations are also provided so that products with
+//              vectors are computed as U*(s.*(V^T*x)) in O((R + C)*K) operations, products with
+//              dense matrices go through the factors, and the product of two factored matrices
+//              is again factored.  A factored matrix is converted to dense form by ordinary
+//              assignment to (or construction of) a matrix with a dense engine.
+//
+//              Factored matrices are created with the free function low_rank_matrix().
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_LOW_RANK_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_LOW_RANK_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+//==================================================================================================
+//  Low-rank (factored) matrix engine.  The factors are held in dynamically-resizable engines
+//  using the given allocator type.
+//==================================================================================================
+//
+template<class T, class AT>
+class low_rank_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using allocator_type  = AT;
+    using pointer         = element_type const*;
+    using const_pointer   = element_type const*;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    using factor_type     = dr_matrix_engine<T, AT>;
+    using weights_type    = dr_vector_engine<T, AT>;
+
+    //- Construct/copy/destroy
+    //
+    ~low_rank_engine() noexcept = default;
+
+    low_rank_engine() = default;
+    low_rank_engine(low_rank_engine&&) noexcept = default;
+    low_rank_engine(low_rank_engine const&) = default;
+    template<class ET1, class ET2>
+    low_rank_engine(ET1 const& u, ET2 const& v);
+    template<class ET1, class VT, class ET2>
+    low_rank_engine(ET1 const& u, VT const& s, ET2 const& v);
+
+    low_rank_engine&    operator =(low_rank_engine&&) noexcept = default;
+    low_rank_engine&    operator =(low_rank_engine const&) = default;
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    size_type   rank() const noexcept;
+
+    //- Element access
+    //
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    //- Factor access
+    //
+    factor_type const&  left_factor() const noexcept;
+    weights_type const& weights() const noexcept;
+    factor_type const&  right_factor() const noexcept;
+
+    //- Modifiers
+    //
+    void    swap(low_rank_engine& rhs) noexcept;
+
+  private:
+    factor_type     m_u;
+    weights_type    m_s;
+    factor_type     m_v;
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+//- Constructs U*V^T from engines holding U and V; the weights are all one.
+//
+template<class T, class AT>
+template<class ET1, class ET2>
+low_rank_engine<T,AT>::low_rank_engine(ET1 const& u, ET2 const& v)
+:   m_u()
+,   m_s(static_cast<size_type>(u.columns()))
+,   m_v()
+{
+    for (size_type k = 0;  k < m_s.elements();  ++k)
+    {
+        m_s(k) = T(1);
+    }
+    m_u = u;
+    m_v = v;
+
+    if (m_v.columns() != m_u.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+}
+
+//- Constructs U*diag(s)*V^T from engines holding U, s, and V.
+//
+template<class T, class AT>
+template<class ET1, class VT, class ET2>
+low_rank_engine<T,AT>::low_rank_engine(ET1 const& u, VT const& s, ET2 const& v)
+:   m_u()
+,   m_s()
+,   m_v()
+{
+    m_u = u;
+    m_s = s;
+    m_v = v;
+
+    if (m_v.columns() != m_u.columns()  ||  m_s.elements() != m_u.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+}
+
+//----------
+//- Capacity
+//
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_type
+low_rank_engine<T,AT>::columns() const noexcept
+{
+    return m_v.rows();
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_type
+low_rank_engine<T,AT>::rows() const noexcept
+{
+    return m_u.rows();
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_tuple
+low_rank_engine<T,AT>::size() const noexcept
+{
+    return size_tuple(m_u.rows(), m_v.rows());
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_type
+low_rank_engine<T,AT>::column_capacity() const noexcept
+{
+    return m_v.rows();
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_type
+low_rank_engine<T,AT>::row_capacity() const noexcept
+{
+    return m_u.rows();
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_tuple
+low_rank_engine<T,AT>::capacity() const noexcept
+{
+    return size_tuple(m_u.rows(), m_v.rows());
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_type
+low_rank_engine<T,AT>::rank() const noexcept
+{
+    return m_s.elements();
+}
+
+//----------------
+//- Element access
+//
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::const_reference
+low_rank_engine<T,AT>::operator ()(size_type i, size_type j) const
+{
+    value_type  er = value_type(0);
+
+    for (size_type k = 0;  k < m_s.elements();  ++k)
+    {
+        er += m_u(i, k) * m_s(k) * m_v(j, k);
+    }
+    return er;
+}
+
+//---------------
+//- Factor access
+//
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::factor_type const&
+low_rank_engine<T,AT>::left_factor() const noexcept
+{
+    return m_u;
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::weights_type const&
+low_rank_engine<T,AT>::weights() const noexcept
+{
+    return m_s;
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::factor_type const&
+low_rank_engine<T,AT>::right_factor() const noexcept
+{
+    return m_v;
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class AT> inline
+void
+low_rank_engine<T,AT>::swap(low_rank_engine& rhs) noexcept
+{
+    m_u.swap(rhs.m_u);
+    m_s.swap(rhs.m_s);
+    m_v.swap(rhs.m_v);
+}
+
+//==================================================================================================
+//                                  **** FACTORED MATRICES ****
+//==================================================================================================
+//  Returns the matrix U*V^T, or U*diag(s)*V^T, in factored form.  The element type is that of
+//  the product of the factors' elements, and the operation traits are those of U.
+//==================================================================================================
+//
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+low_rank_matrix(matrix<ET1, OT1> const& u, matrix<ET2, OT2> const& v)
+{
+    using elem_type   = matrix_multiplication_element_t<OT1, typename ET1::value_type,
+                                                        typename ET2::value_type>;
+    using engine_type = low_rank_engine<elem_type, allocator<elem_type>>;
+
+    matrix<engine_type, OT1>    mr;
+
+    mr.engine() = engine_type(u.engine(), v.engine());
+    return mr;
+}
+
+template<class ET1, class OT1, class VT, class VOT, class ET2, class OT2>
+auto
+low_rank_matrix(matrix<ET1, OT1> const& u, vector<VT, VOT> const& s, matrix<ET2, OT2> const& v)
+{
+    using elem_type   = matrix_multiplication_element_t<OT1, typename ET1::value_type,
+                                                        typename ET2::value_type>;
+    using engine_type = low_rank_engine<elem_type, allocator<elem_type>>;
+
+    matrix<engine_type, OT1>    mr;
+
+    mr.engine() = engine_type(u.engine(), s.engine(), v.engine());
+    return mr;
+}
+
+namespace detail {
+//==================================================================================================
+//  Product kernels.  Each contracts one operand with a factor to form a K-element (or K-row)
+//  intermediate, scaled by the weights, and then expands that intermediate with the other factor.
+//  Operands may be engines or math objects.
+//==================================================================================================
+//
+//- A read-only transposed reference to an engine or intermediate, used to express products with
+//  transposed operands without copying.
+//
+template<class ET>
+struct low_rank_transposed
+{
+    using size_type = typename ET::size_type;
+
+    ET const&   m_ref;
+
+    size_type       rows() const noexcept       { return m_ref.columns(); }
+    size_type       columns() const noexcept    { return m_ref.rows(); }
+    decltype(auto)  operator ()(size_type i, size_type j) const     { return m_ref(j, i); }
+};
+
+template<class ET>
+low_rank_transposed<ET>
+low_rank_t(ET const& eng)
+{
+    return low_rank_transposed<ET>{eng};
+}
+
+//- The engine of an operand that is either an engine or a math object, and whether that engine
+//  exposes row-major storage of element type T, so that the operand can be passed to the GEMM
+//  kernels directly.
+//
+template<class MT>
+struct low_rank_storage
+{
+    using engine_type = MT;
+    static MT const&    engine(MT const& m) noexcept    { return m; }
+};
+
+template<class ET, class OT>
+struct low_rank_storage<matrix<ET, OT>>
+{
+    using engine_type = ET;
+    static ET const&    engine(matrix<ET, OT> const& m) noexcept    { return m.engine(); }
+};
+
+template<class MT, class T>
+constexpr bool
+low_rank_is_dense()
+{
+    using engine_type = typename low_rank_storage<MT>::engine_type;
+
+    if constexpr (has_data_v<engine_type>)
+        return is_same_v<remove_cv_t<typename engine_type::element_type>, T>;
+    else
+        return false;
+}
+
+//- Copies the operand b into a contiguous row-major buffer.
+//
+template<class T, class MT>
+std::vector<T>
+low_rank_pack(MT const& b)
+{
+    using size_type_b = typename MT::size_type;
+
+    size_t const    rows = static_cast<size_t>(b.rows());
+    size_t const    cols = static_cast<size_t>(b.columns());
+    std::vector<T>  p(rows*cols);
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            p[i*cols + j] = b(static_cast<size_type_b>(i), static_cast<size_type_b>(j));
+        }
+    }
+    return p;
+}
+
+//- Returns the K x P product diag(s) * V^T * B, for a factor V (N x K) and an N x P operand B.
+//
+template<class T, class AT, class MT>
+dr_matrix_engine<T, AT>
+low_rank_contract(dr_matrix_engine<T, AT> const& v, dr_vector_engine<T, AT> const& s, MT const& b)
+{
+    using size_type_b = typename MT::size_type;
+
+    size_t const    n    = static_cast<size_t>(v.rows());
+    size_t const    rank = static_cast<size_t>(v.columns());
+    size_t const    cols = static_cast<size_t>(b.columns());
+
+    dr_matrix_engine<T, AT>     t(rank, cols);
+
+    //- With dense storage, the weighted transpose diag(s) * V^T (K x N, small next to B) is
+    //  formed so that both GEMM operands are row-major.
+    //
+    if constexpr (low_rank_is_dense<MT, T>())
+    {
+        auto const&     eb = low_rank_storage<MT>::engine(b);
+        std::vector<T>  vt(rank*n);
+
+        for (size_t i = 0;  i < n;  ++i)
+        {
+            for (size_t k = 0;  k < rank;  ++k)
+            {
+                vt[k*n + i] = s(k) * v(i, k);
+            }
+        }
+        gemm_assign_kernel(rank, cols, n, vt.data(), n, eb.data(),
+                           static_cast<size_t>(eb.column_capacity()),
+                           t.data(), static_cast<size_t>(t.column_capacity()));
+        return t;
+    }
+
+    for (size_t k = 0;  k < rank;  ++k)
+    {
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            t(k, j) = T(0);
+        }
+    }
+
+    //- Rows of B and of the intermediate are traversed contiguously.
+    //
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        for (size_t k = 0;  k < rank;  ++k)
+        {
+            T const     vik = v(i, k);
+
+            for (size_t j = 0;  j < cols;  ++j)
+            {
+                t(k, j) += vik * b(static_cast<size_type_b>(i), static_cast<size_type_b>(j));
+            }
+        }
+    }
+    for (size_t k = 0;  k < rank;  ++k)
+    {
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            t(k, j) *= s(k);
+        }
+    }
+    return t;
+}
+
+//- Returns the M x K product A * U * diag(s), for an M x N operand A with dense storage and a
+//  factor U (N x K).
+//
+template<class T, class AT, class ET1, class OT1>
+dr_matrix_engine<T, AT>
+low_rank_contract(matrix<ET1, OT1> const& a, dr_matrix_engine<T, AT> const& u,
+                  dr_vector_engine<T, AT> const& s)
+{
+    size_t const    rows = static_cast<size_t>(a.rows());
+    size_t const    n    = static_cast<size_t>(u.rows());
+    size_t const    rank = static_cast<size_t>(u.columns());
+
+    dr_matrix_engine<T, AT>     w(rows, rank);
+    std::vector<T>              us(n*rank);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        for (size_t k = 0;  k < rank;  ++k)
+        {
+            us[i*rank + k] = u(i, k) * s(k);
+        }
+    }
+    gemm_assign_kernel(rows, rank, n, a.engine().data(),
+                       static_cast<size_t>(a.engine().column_capacity()), us.data(), rank,
+                       w.data(), static_cast<size_t>(w.column_capacity()));
+    return w;
+}
+
+//- Returns the K-element product diag(s) * V^T * x, for a factor V (N x K) and a vector x.
+//
+template<class T, class AT, class ET2, class OT2>
+dr_vector_engine<T, AT>
+low_rank_contract(dr_matrix_engine<T, AT> const& v, dr_vector_engine<T, AT> const& s,
+                  vector<ET2, OT2> const& x)
+{
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+
+    size_t const    n    = static_cast<size_t>(v.rows());
+    size_t const    rank = static_cast<size_t>(v.columns());
+
+    dr_vector_engine<T, AT>     t(rank);
+
+    for (size_t k = 0;  k < rank;  ++k)
+    {
+        t(k) = T(0);
+    }
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        auto const  xi = x(static_cast<size_type_2>(i));
+
+        for (size_t k = 0;  k < rank;  ++k)
+        {
+            t(k) += v(i, k) * xi;
+        }
+    }
+    for (size_t k = 0;  k < rank;  ++k)
+    {
+        t(k) *= s(k);
+    }
+    return t;
+}
+
+//- Writes the M-element product U * t into the vector object vr, for a factor U (M x K).
+//
+template<class ET, class OT, class T, class AT>
+void
+low_rank_expand(vector<ET, OT>& vr, dr_matrix_engine<T, AT> const& u, dr_vector_engine<T, AT> const& t)
+{
+    using size_type_r = typename vector<ET, OT>::size_type;
+    using elem_type   = typename vector<ET, OT>::element_type;
+
+    size_t const    rows = static_cast<size_t>(u.rows());
+    size_t const    rank = static_cast<size_t>(u.columns());
+
+    if constexpr (is_resizable_engine_v<ET>)
+    {
+        vr.resize(static_cast<size_type_r>(rows));
+    }
+
+    if constexpr (low_rank_is_dense<ET, T>())
+    {
+        gemm_assign_kernel(rows, size_t(1), rank, u.data(), static_cast<size_t>(u.column_capacity()),
+                           t.data(), size_t(1), vr.engine().data(), size_t(1));
+        return;
+    }
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        elem_type   er = elem_type(0);
+
+        for (size_t k = 0;  k < rank;  ++k)
+        {
+            er += u(i, k) * t(k);
+        }
+        vr(static_cast<size_type_r>(i)) = er;
+    }
+}
+
+//- Writes the M x P product A * B into the matrix object mr, for operands A (M x K) and
+//  B (K x P); when A is a left factor and B is an intermediate, or B is a transposed right
+//  factor, this expands a contracted product.  With dense storage in the result the product is
+//  computed by the GEMM kernel, and an operand without dense storage is first packed; both are
+//  factor-sized, small next to the result.
+//
+template<class ET, class OT, class MA, class MB>
+void
+low_rank_expand(matrix<ET, OT>& mr, MA const& a, MB const& b)
+{
+    using size_type_r = typename matrix<ET, OT>::size_type;
+    using size_type_a = typename MA::size_type;
+    using size_type_b = typename MB::size_type;
+    using elem_type   = typename matrix<ET, OT>::element_type;
+
+    size_t const    rows = static_cast<size_t>(a.rows());
+    size_t const    cols = static_cast<size_t>(b.columns());
+    size_t const    rank = static_cast<size_t>(a.columns());
+
+    if constexpr (is_resizable_engine_v<ET>)
+    {
+        mr.resize(static_cast<size_type_r>(rows), static_cast<size_type_r>(cols));
+    }
+
+    if constexpr (low_rank_is_dense<ET, remove_cv_t<elem_type>>())
+    {
+        using T = remove_cv_t<elem_type>;
+
+        std::vector<T>  ap, bp;
+        T const*        pa;
+        T const*        pb;
+        size_t          lda, ldb;
+
+        if constexpr (low_rank_is_dense<MA, T>())
+        {
+            auto const&     ea = low_rank_storage<MA>::engine(a);
+
+            pa  = ea.data();
+            lda = static_cast<size_t>(ea.column_capacity());
+        }
+        else
+        {
+            ap  = low_rank_pack<T>(a);
+            pa  = ap.data();
+            lda = rank;
+        }
+
+        if constexpr (low_rank_is_dense<MB, T>())
+        {
+            auto const&     eb = low_rank_storage<MB>::engine(b);
+
+            pb  = eb.data();
+            ldb = static_cast<size_t>(eb.column_capacity());
+        }
+        else
+        {
+            bp  = low_rank_pack<T>(b);
+            pb  = bp.data();
+            ldb = cols;
+        }
+
+        gemm_assign_kernel(rows, cols, rank, pa, lda, pb, ldb, mr.engine().data(),
+                           static_cast<size_t>(mr.engine().column_capacity()));
+        return;
+    }
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            elem_type   er = elem_type(0);
+
+            for (size_t k = 0;  k < rank;  ++k)
+            {
+                er += a(static_cast<size_type_a>(i), static_cast<size_type_a>(k)) *
+                      b(static_cast<size_type_b>(k), static_cast<size_type_b>(j));
+            }
+            mr(static_cast<size_type_r>(i), static_cast<size_type_r>(j)) = er;
+        }
+    }
+}
+
+}       //- detail namespace
+//==================================================================================================
+//                        **** LOW-RANK ENGINE MULTIPLICATION TRAITS ****
+//==================================================================================================
+//  Engine promotion:  the product of two factored matrices is factored.  All other combinations
+//  yield dense engines.
+//==================================================================================================
+//
+template<class OT, class T1, class A1, class T2, class A2>
+struct matrix_multiplication_engine_traits<OT, low_rank_engine<T1, A1>, low_rank_engine<T2, A2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = low_rank_engine<element_type, alloc_type>;
+};
+
+//- Transposes of factored matrices are not factored, and their products with factored matrices
+//  are dense.
+//
+template<class OT, class T1, class A1, class T2, class A2, class MCT2>
+struct matrix_multiplication_engine_traits<OT, low_rank_engine<T1, A1>,
+                                               transpose_engine<low_rank_engine<T2, A2>, MCT2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+};
+
+template<class OT, class T1, class A1, class MCT1, class T2, class A2>
+struct matrix_multiplication_engine_traits<OT, transpose_engine<low_rank_engine<T1, A1>, MCT1>,
+                                               low_rank_engine<T2, A2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+};
+
+template<class OT, class T1, class A1, class MCT1, class T2, class A2, class MCT2>
+struct matrix_multiplication_engine_traits<OT, transpose_engine<low_rank_engine<T1, A1>, MCT1>,
+                                               transpose_engine<low_rank_engine<T2, A2>, MCT2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+};
+
+//--------------------------------------------------------------------------------------------------
+//  Arithmetic.
+//--------------------------------------------------------------------------------------------------
+//
+//- low_rank*vector:  U * (diag(s) * (V^T * x)).
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<low_rank_engine<T1, A1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, low_rank_engine<T1, A1>, ET2>;
+    using op_traits    = OT;
+    using result_type  = vector<engine_type, op_traits>;
+
+    static result_type  multiply(matrix<low_rank_engine<T1, A1>, OT1> const& m1,
+                                 vector<ET2, OT2> const& v2);
+};
+
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OT, matrix<low_rank_engine<T1, A1>, OT1>, vector<ET2, OT2>>::multiply
+(matrix<low_rank_engine<T1, A1>, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (low_rank*v)", m1, v2);
+
+    auto const&     eng = m1.engine();
+
+    if (static_cast<size_t>(v2.elements()) != eng.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    result_type     vr;
+
+    detail::low_rank_expand(vr, eng.left_factor(),
+                            detail::low_rank_contract(eng.right_factor(), eng.weights(), v2));
+    return vr;
+}
+
+//- vector*low_rank:  V * (diag(s) * (U^T * x)).
+//
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+struct matrix_multiplication_traits<OT, vector<ET1, OT1>, matrix<low_rank_engine<T2, A2>, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, ET1, low_rank_engine<T2, A2>>;
+    using op_traits    = OT;
+    using result_type  = vector<engine_type, op_traits>;
+
+    static result_type  multiply(vector<ET1, OT1> const& v1,
+                                 matrix<low_rank_engine<T2, A2>, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+inline auto
+matrix_multiplication_traits<OT, vector<ET1, OT1>, matrix<low_rank_engine<T2, A2>, OT2>>::multiply
+(vector<ET1, OT1> const& v1, matrix<low_rank_engine<T2, A2>, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (v*low_rank)", v1, m2);
+
+    auto const&     eng = m2.engine();
+
+    if (static_cast<size_t>(v1.elements()) != eng.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    result_type     vr;
+
+    detail::low_rank_expand(vr, eng.right_factor(),
+                            detail::low_rank_contract(eng.left_factor(), eng.weights(), v1));
+    return vr;
+}
+
+//- Products with other matrices go through detail::matrix_product_traits (see
+//  multiplication_traits.hpp); low-rank products are cheap for any operand, so only permutations
+//  take precedence.
+//
+namespace detail {
+
+template<class T, class A>
+struct structured_multiplication_priority<low_rank_engine<T, A>>
+:   public integral_constant<int, 3>
+{};
+
+//- low_rank*matrix:  U * (diag(s) * (V^T * B)).
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_product_traits<OT, matrix<low_rank_engine<T1, A1>, OT1>, matrix<ET2, OT2>,
+                             structured_side::left>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, low_rank_engine<T1, A1>, ET2>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    static result_type  multiply(matrix<low_rank_engine<T1, A1>, OT1> const& m1,
+                                 matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_product_traits<OT, matrix<low_rank_engine<T1, A1>, OT1>, matrix<ET2, OT2>,
+                      structured_side::left>::multiply
+(matrix<low_rank_engine<T1, A1>, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (low_rank*m)", m1, m2);
+
+    auto const&     eng = m1.engine();
+
+    if (static_cast<size_t>(m2.rows()) != eng.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    auto const      t = detail::low_rank_contract(eng.right_factor(), eng.weights(), m2);
+    result_type     mr;
+
+    detail::low_rank_expand(mr, eng.left_factor(), t);
+    return mr;
+}
+
+//- matrix*low_rank:  ((A * U) * diag(s)) * V^T; without dense storage in A, (A * U) * diag(s) is
+//  formed as (diag(s) * U^T * A^T)^T.
+//
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+struct matrix_product_traits<OT, matrix<ET1, OT1>, matrix<low_rank_engine<T2, A2>, OT2>,
+                             structured_side::right>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, ET1, low_rank_engine<T2, A2>>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    static result_type  multiply(matrix<ET1, OT1> const& m1,
+                                 matrix<low_rank_engine<T2, A2>, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+inline auto
+matrix_product_traits<OT, matrix<ET1, OT1>, matrix<low_rank_engine<T2, A2>, OT2>,
+                      structured_side::right>::multiply
+(matrix<ET1, OT1> const& m1, matrix<low_rank_engine<T2, A2>, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (m*low_rank)", m1, m2);
+
+    auto const&     eng = m2.engine();
+
+    if (static_cast<size_t>(m1.columns()) != eng.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    result_type     mr;
+
+    if constexpr (detail::low_rank_is_dense<matrix<ET1, OT1>, T2>())
+    {
+        auto const  w = detail::low_rank_contract(m1, eng.left_factor(), eng.weights());
+
+        detail::low_rank_expand(mr, w, detail::low_rank_t(eng.right_factor()));
+    }
+    else
+    {
+        auto const  t = detail::low_rank_contract(eng.left_factor(), eng.weights(), m1.t());
+
+        detail::low_rank_expand(mr, detail::low_rank_t(t), detail::low_rank_t(eng.right_factor()));
+    }
+    return mr;
+}
+
+//- low_rank*low_rank:  (U1 * (diag(s1) * V1^T * U2)) * diag(s2) * V2^T, which is again factored,
+//  with the rank of the right-hand operand.
+//
+template<class OT, class T1, class A1, class OT1, class T2, class A2, class OT2>
+struct matrix_product_traits<OT, matrix<low_rank_engine<T1, A1>, OT1>,
+                                 matrix<low_rank_engine<T2, A2>, OT2>, structured_side::left>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, low_rank_engine<T1, A1>,
+                                                            low_rank_engine<T2, A2>>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    static result_type  multiply(matrix<low_rank_engine<T1, A1>, OT1> const& m1,
+                                 matrix<low_rank_engine<T2, A2>, OT2> const& m2);
+};
+
+template<class OT, class T1, class A1, class OT1, class T2, class A2, class OT2>
+inline auto
+matrix_product_traits<OT, matrix<low_rank_engine<T1, A1>, OT1>,
+                          matrix<low_rank_engine<T2, A2>, OT2>, structured_side::left>::multiply
+(matrix<low_rank_engine<T1, A1>, OT1> const& m1, matrix<low_rank_engine<T2, A2>, OT2> const& m2)
+    -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (low_rank*low_rank)", m1, m2);
+
+    using factor_type = typename engine_type::factor_type;
+
+    auto const&     eng1 = m1.engine();
+    auto const&     eng2 = m2.engine();
+
+    if (eng1.columns() != eng2.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    auto const          t  = detail::low_rank_contract(eng1.right_factor(), eng1.weights(),
+                                                       eng2.left_factor());
+    matrix<factor_type> u;
+    result_type         mr;
+
+    detail::low_rank_expand(u, eng1.left_factor(), t);
+    mr.engine() = engine_type(u.engine(), eng2.weights(), eng2.right_factor());
+    return mr;
+}
+
+}       //- detail namespace
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_LOW_RANK_ENGINE_HPP_DEFINED
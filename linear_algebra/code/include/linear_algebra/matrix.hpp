@@ -25,6 +25,20 @@ class matrix
 
     static constexpr bool   has_cx_elem = detail::is_complex_v<typename ET::value_type>;
 
+    //- Views taken of a view of an engine having data() collapse to strided views of that
+    //  engine's storage, so that the cost of element access does not grow with view depth.
+    //
+    static constexpr bool   has_strided_views = detail::is_collapsible_view_v<ET>;
+
+    using view_root_type = detail::view_root_t<ET>;
+
+    template<class VET, class VCT>
+    using vector_view_t = vector<conditional_t<has_strided_views,
+                                               strided_vector_engine<view_root_type, VCT>, VET>, OT>;
+    template<class MET, class MCT>
+    using matrix_view_t = matrix<conditional_t<has_strided_views,
+                                               strided_matrix_engine<view_root_type, MCT>, MET>, OT>;
+
   public:
     //- Types
     //
@@ -37,15 +51,27 @@ class matrix
     using size_type       = typename engine_type::size_type;
     using size_tuple      = typename engine_type::size_tuple;
 
-    using column_type       = vector<column_engine<engine_type, possibly_writable_vector_tag>, OT>;
-    using const_column_type = vector<column_engine<engine_type, readable_vector_engine_tag>, OT>;
-    using row_type          = vector<row_engine<engine_type, possibly_writable_vector_tag>, OT>;
-    using const_row_type    = vector<row_engine<engine_type, readable_vector_engine_tag>, OT>;
-
-    using submatrix_type       = matrix<submatrix_engine<engine_type, possibly_writable_matrix_tag>, OT>;
-    using const_submatrix_type = matrix<submatrix_engine<engine_type, readable_matrix_engine_tag>, OT>;
-    using transpose_type       = matrix<transpose_engine<engine_type, possibly_writable_matrix_tag>, OT>;
-    using const_transpose_type = matrix<transpose_engine<engine_type, readable_matrix_engine_tag>, OT>;
+    using column_type          = vector_view_t<column_engine<engine_type, possibly_writable_vector_tag>,
+                                               possibly_writable_vector_tag>;
+    using const_column_type    = vector_view_t<column_engine<engine_type, readable_vector_engine_tag>,
+                                               readable_vector_engine_tag>;
+    using row_type             = vector_view_t<row_engine<engine_type, possibly_writable_vector_tag>,
+                                               possibly_writable_vector_tag>;
+    using const_row_type       = vector_view_t<row_engine<engine_type, readable_vector_engine_tag>,
+                                               readable_vector_engine_tag>;
+    using diagonal_type        = vector_view_t<diagonal_engine<engine_type, possibly_writable_vector_tag>,
+                                               possibly_writable_vector_tag>;
+    using const_diagonal_type  = vector_view_t<diagonal_engine<engine_type, readable_vector_engine_tag>,
+                                               readable_vector_engine_tag>;
+
+    using submatrix_type       = matrix_view_t<submatrix_engine<engine_type, possibly_writable_matrix_tag>,
+                                               possibly_writable_matrix_tag>;
+    using const_submatrix_type = matrix_view_t<submatrix_engine<engine_type, readable_matrix_engine_tag>,
+                                               readable_matrix_engine_tag>;
+    using transpose_type       = matrix_view_t<transpose_engine<engine_type, possibly_writable_matrix_tag>,
+                                               possibly_writable_matrix_tag>;
+    using const_transpose_type = matrix_view_t<transpose_engine<engine_type, readable_matrix_engine_tag>,
+                                               readable_matrix_engine_tag>;
     using hermitian_type       = conditional_t<has_cx_elem, matrix, transpose_type>;
     using const_hermitian_type = conditional_t<has_cx_elem, matrix, const_transpose_type>;
 
@@ -106,12 +132,14 @@ class matrix
     constexpr reference             operator ()(size_type i, size_type j);
     constexpr const_reference       operator ()(size_type i, size_type j) const;
 
-    //- Columns, rows, submatrices, and transposes
+    //- Columns, rows, diagonals, submatrices, and transposes
     //
     constexpr column_type           column(size_type j) noexcept;
     constexpr const_column_type     column(size_type j) const noexcept;
     constexpr row_type              row(size_type i) noexcept;
     constexpr const_row_type        row(size_type i) const noexcept;
+    constexpr diagonal_type         diagonal(difference_type k = 0) noexcept;
+    constexpr const_diagonal_type   diagonal(difference_type k = 0) const noexcept;
     constexpr submatrix_type        submatrix(size_type ri, size_type rn, size_type ci, size_type cn) noexcept;
     constexpr const_submatrix_type  submatrix(size_type ri, size_type rn, size_type ci, size_type cn) const noexcept;
     constexpr transpose_type        t() noexcept;
@@ -156,7 +184,7 @@ template<class ET2, class OT2> constexpr
 matrix<ET,OT>::matrix(matrix<ET2, OT2> const& rhs)
 :   m_engine()
 {
-    assign(rhs);
+    m_engine = rhs.m_engine;
 }
 
 template<class ET, class OT>
@@ -308,62 +336,146 @@ matrix<ET,OT>::operator ()(size_type i, size_type j) const
     return m_engine(i, j);
 }
 
-//- Columns, rows, submatrices, and transposes
+//- Columns, rows, diagonals, submatrices, and transposes
 //
 template<class ET, class OT> inline constexpr 
 typename matrix<ET,OT>::const_column_type
 matrix<ET,OT>::column(size_type j) const noexcept
 {
-    return const_column_type(detail::special_ctor_tag(), m_engine, j);
+    if constexpr (has_strided_views)
+    {
+        return const_column_type(detail::special_ctor_tag(), detail::make_strided_view(m_engine).column(j));
+    }
+    else
+    {
+        return const_column_type(detail::special_ctor_tag(), m_engine, j);
+    }
 }
 
 template<class ET, class OT> inline constexpr 
 typename matrix<ET,OT>::column_type
 matrix<ET,OT>::column(size_type j) noexcept
 {
-    return column_type(detail::special_ctor_tag(), m_engine, j);
+    if constexpr (has_strided_views)
+    {
+        return column_type(detail::special_ctor_tag(), detail::make_strided_view(m_engine).column(j));
+    }
+    else
+    {
+        return column_type(detail::special_ctor_tag(), m_engine, j);
+    }
 }
 
 template<class ET, class OT> inline constexpr 
 typename matrix<ET,OT>::row_type
 matrix<ET,OT>::row(size_type i) noexcept
 {
-    return row_type(detail::special_ctor_tag(), m_engine, i);
+    if constexpr (has_strided_views)
+    {
+        return row_type(detail::special_ctor_tag(), detail::make_strided_view(m_engine).row(i));
+    }
+    else
+    {
+        return row_type(detail::special_ctor_tag(), m_engine, i);
+    }
 }
 
 template<class ET, class OT> inline constexpr 
 typename matrix<ET,OT>::const_row_type
 matrix<ET,OT>::row(size_type i) const noexcept
 {
-    return const_row_type(detail::special_ctor_tag(), m_engine, i);
+    if constexpr (has_strided_views)
+    {
+        return const_row_type(detail::special_ctor_tag(), detail::make_strided_view(m_engine).row(i));
+    }
+    else
+    {
+        return const_row_type(detail::special_ctor_tag(), m_engine, i);
+    }
+}
+
+template<class ET, class OT> inline constexpr 
+typename matrix<ET,OT>::diagonal_type
+matrix<ET,OT>::diagonal(difference_type k) noexcept
+{
+    if constexpr (has_strided_views)
+    {
+        return diagonal_type(detail::special_ctor_tag(), detail::make_strided_view(m_engine).diagonal(k));
+    }
+    else
+    {
+        return diagonal_type(detail::special_ctor_tag(), m_engine, k);
+    }
+}
+
+template<class ET, class OT> inline constexpr 
+typename matrix<ET,OT>::const_diagonal_type
+matrix<ET,OT>::diagonal(difference_type k) const noexcept
+{
+    if constexpr (has_strided_views)
+    {
+        return const_diagonal_type(detail::special_ctor_tag(), detail::make_strided_view(m_engine).diagonal(k));
+    }
+    else
+    {
+        return const_diagonal_type(detail::special_ctor_tag(), m_engine, k);
+    }
 }
 
 template<class ET, class OT> inline constexpr 
 typename matrix<ET,OT>::submatrix_type
 matrix<ET,OT>::submatrix(size_type ri, size_type rn, size_type ci, size_type cn) noexcept
 {
-    return submatrix_type(detail::special_ctor_tag(), m_engine, ri, rn, ci, cn);
+    if constexpr (has_strided_views)
+    {
+        return submatrix_type(detail::special_ctor_tag(), detail::make_strided_view(m_engine).submatrix(ri, rn, ci, cn));
+    }
+    else
+    {
+        return submatrix_type(detail::special_ctor_tag(), m_engine, ri, rn, ci, cn);
+    }
 }
 
 template<class ET, class OT> inline constexpr 
 typename matrix<ET,OT>::const_submatrix_type
 matrix<ET,OT>::submatrix(size_type ri, size_type rn, size_type ci, size_type cn) const noexcept
 {
-    return const_submatrix_type(detail::special_ctor_tag(), m_engine, ri, rn, ci, cn);
+    if constexpr (has_strided_views)
+    {
+        return const_submatrix_type(detail::special_ctor_tag(), detail::make_strided_view(m_engine).submatrix(ri, rn, ci, cn));
+    }
+    else
+    {
+        return const_submatrix_type(detail::special_ctor_tag(), m_engine, ri, rn, ci, cn);
+    }
 }
 
 template<class ET, class OT> inline constexpr 
 typename matrix<ET,OT>::transpose_type
 matrix<ET,OT>::t() noexcept
 {
-    return transpose_type(detail::special_ctor_tag(), m_engine);
+    if constexpr (has_strided_views)
+    {
+        return transpose_type(detail::special_ctor_tag(), detail::make_strided_view(m_engine).transposed());
+    }
+    else
+    {
+        return transpose_type(detail::special_ctor_tag(), m_engine);
+    }
 }
 
 template<class ET, class OT> inline constexpr 
 typename matrix<ET,OT>::const_transpose_type
 matrix<ET,OT>::t() const noexcept
 {
-    return const_transpose_type(detail::special_ctor_tag(), m_engine);
+    if constexpr (has_strided_views)
+    {
+        return const_transpose_type(detail::special_ctor_tag(), detail::make_strided_view(m_engine).transposed());
+    }
+    else
+    {
+        return const_transpose_type(detail::special_ctor_tag(), m_engine);
+    }
 }
 
 template<class ET, class OT> inline constexpr 
@@ -376,7 +488,7 @@ matrix<ET,OT>::h()
     }
     else
     {
-        return hermitian_type(detail::special_ctor_tag(), m_engine);
+        return t();
     }
 }
 
@@ -390,7 +502,7 @@ matrix<ET,OT>::h() const
     }
     else
     {
-        return const_hermitian_type(detail::special_ctor_tag(), m_engine);
+        return t();
     }
 }
 
@@ -0,0 +1,940 @@
+//==================================================================================================
+//  File:       matrix_inverse.hpp
+//
+//  Summary:    This header defines the determinant and inverse of square matrices, and the
+//              solution of linear systems, including by mixed-precision iterative refinement.
+//
+//              General matrices are factored with a blocked, partially-pivoted LU decomposition
+//              whose trailing updates use the GEMM kernel.  Fixed-size 2x2, 3x3, and 4x4 matrices
+//              use closed-form adjugate expressions, and a 4x4 matrix whose last row is (0,0,0,1)
+//              is inverted as an affine transform.
+//
+//              The batch_*() functions process arrays of fixed-size matrices.  They transpose
+//              groups of matrices into structure-of-arrays form, so that each closed-form
+//              expression is evaluated for several matrices at once by straight-line, branch-
+//              free code that the compiler can vectorize; they report singular inputs by count
+//              rather than by throwing.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_MATRIX_INVERSE_HPP_DEFINED
+#define LINEAR_ALGEBRA_MATRIX_INVERSE_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Blocked LU factorization with partial pivoting, P*A = L*U, of the (n x n) row-major matrix at
+//  p_a, in place.  The row interchanged with row k is recorded in p_piv[k].  Returns the parity
+//  of the permutation (+1 or -1), or 0 if the matrix is exactly singular.
+//==================================================================================================
+//
+inline constexpr size_t     lu_block = 32;
+
+template<class T>
+int
+lu_factor(size_t n, T* p_a, size_t lda, size_t* p_piv)
+{
+    int             sign = 1;
+    bool            singular = false;
+    std::vector<T>  neg_l21;
+
+    for (size_t k0 = 0;  k0 < n;  k0 += lu_block)
+    {
+        size_t const    k1 = min(n, k0 + lu_block);
+        size_t const    kb = k1 - k0;
+
+        //- Factor the panel A(k0:n, k0:k1); row interchanges are applied across the full width.
+        //
+        for (size_t k = k0;  k < k1;  ++k)
+        {
+            size_t  p    = k;
+            T       amax = abs(p_a[k*lda + k]);
+
+            for (size_t i = k+1;  i < n;  ++i)
+            {
+                if (abs(p_a[i*lda + k]) > amax)
+                {
+                    amax = abs(p_a[i*lda + k]);
+                    p    = i;
+                }
+            }
+
+            p_piv[k] = p;
+
+            if (p != k)
+            {
+                std::swap_ranges(p_a + k*lda, p_a + k*lda + n, p_a + p*lda);
+                sign = -sign;
+            }
+
+            if (amax == T(0))
+            {
+                singular = true;
+                continue;
+            }
+
+            T const     rcp = T(1) / p_a[k*lda + k];
+
+            for (size_t i = k+1;  i < n;  ++i)
+            {
+                T const     lik = (p_a[i*lda + k] *= rcp);
+
+                for (size_t j = k+1;  j < k1;  ++j)
+                {
+                    p_a[i*lda + j] -= lik * p_a[k*lda + j];
+                }
+            }
+        }
+
+        if (k1 == n) break;
+
+        //- U12 = inv(L11) * A12.
+        //
+        for (size_t k = k0;  k < k1;  ++k)
+        {
+            for (size_t i = k+1;  i < k1;  ++i)
+            {
+                T const     lik = p_a[i*lda + k];
+
+                for (size_t j = k1;  j < n;  ++j)
+                {
+                    p_a[i*lda + j] -= lik * p_a[k*lda + j];
+                }
+            }
+        }
+
+        //- A22 -= L21 * U12.
+        //
+        size_t const    mr = n - k1;
+
+        neg_l21.resize(mr*kb);
+
+        for (size_t i = 0;  i < mr;  ++i)
+        {
+            for (size_t k = 0;  k < kb;  ++k)
+            {
+                neg_l21[i*kb + k] = -p_a[(k1 + i)*lda + k0 + k];
+            }
+        }
+        gemm_kernel(mr, mr, kb, neg_l21.data(), kb, p_a + k0*lda + k1, lda, p_a + k1*lda + k1, lda);
+    }
+
+    return singular ? 0 : sign;
+}
+
+//- Solves A*X = B in place for the (n x nrhs) row-major block at p_b, given the factors computed
+//  by lu_factor().  The operations are arranged row-wise, so that the innermost loops run over
+//  contiguous right-hand-side rows.
+//
+template<class T>
+void
+lu_solve(size_t n, T const* p_lu, size_t lda, size_t const* p_piv,
+         size_t nrhs, T* p_b, size_t ldb)
+{
+    for (size_t k = 0;  k < n;  ++k)
+    {
+        if (p_piv[k] != k)
+        {
+            std::swap_ranges(p_b + k*ldb, p_b + k*ldb + nrhs, p_b + p_piv[k]*ldb);
+        }
+    }
+
+    for (size_t i = 1;  i < n;  ++i)
+    {
+        T*  p_bi = p_b + i*ldb;
+
+        for (size_t k = 0;  k < i;  ++k)
+        {
+            T const     lik  = p_lu[i*lda + k];
+            T const*    p_bk = p_b + k*ldb;
+
+            for (size_t j = 0;  j < nrhs;  ++j)
+            {
+                p_bi[j] -= lik * p_bk[j];
+            }
+        }
+    }
+
+    for (size_t i = n;  i-- > 0;  )
+    {
+        T*  p_bi = p_b + i*ldb;
+
+        for (size_t k = i+1;  k < n;  ++k)
+        {
+            T const     uik  = p_lu[i*lda + k];
+            T const*    p_bk = p_b + k*ldb;
+
+            for (size_t j = 0;  j < nrhs;  ++j)
+            {
+                p_bi[j] -= uik * p_bk[j];
+            }
+        }
+
+        T const     rcp = T(1) / p_lu[i*lda + i];
+
+        for (size_t j = 0;  j < nrhs;  ++j)
+        {
+            p_bi[j] *= rcp;
+        }
+    }
+}
+
+//==================================================================================================
+//  Closed-form determinant/inverse kernels for W matrices at once, stored in structure-of-arrays
+//  form:  element (i,j) of matrix l is at p[(i*N + j)*W + l].  Every lane executes the same
+//  straight-line code, so each statement maps onto a single vector operation for W > 1.  The
+//  inverse kernels store the determinant of each matrix at p_det[l]; the inverse of a singular
+//  matrix is not finite.
+//==================================================================================================
+//
+inline constexpr size_t     batch_lanes = 8;
+
+template<class T, size_t W>
+void
+inverse2_kernel(T const* p_a, T* p_b, T* p_det)
+{
+    for (size_t l = 0;  l < W;  ++l)
+    {
+        T const     a00 = p_a[0*W + l], a01 = p_a[1*W + l];
+        T const     a10 = p_a[2*W + l], a11 = p_a[3*W + l];
+        T const     det = a00*a11 - a01*a10;
+        T const     rcp = T(1) / det;
+
+        p_b[0*W + l] =  a11 * rcp;
+        p_b[1*W + l] = -a01 * rcp;
+        p_b[2*W + l] = -a10 * rcp;
+        p_b[3*W + l] =  a00 * rcp;
+        p_det[l]     = det;
+    }
+}
+
+template<class T, size_t W>
+void
+inverse3_kernel(T const* p_a, T* p_b, T* p_det)
+{
+    for (size_t l = 0;  l < W;  ++l)
+    {
+        T const     a00 = p_a[0*W + l], a01 = p_a[1*W + l], a02 = p_a[2*W + l];
+        T const     a10 = p_a[3*W + l], a11 = p_a[4*W + l], a12 = p_a[5*W + l];
+        T const     a20 = p_a[6*W + l], a21 = p_a[7*W + l], a22 = p_a[8*W + l];
+
+        T const     c00 = a11*a22 - a12*a21;
+        T const     c01 = a12*a20 - a10*a22;
+        T const     c02 = a10*a21 - a11*a20;
+        T const     det = a00*c00 + a01*c01 + a02*c02;
+        T const     rcp = T(1) / det;
+
+        p_b[0*W + l] = c00 * rcp;
+        p_b[1*W + l] = (a02*a21 - a01*a22) * rcp;
+        p_b[2*W + l] = (a01*a12 - a02*a11) * rcp;
+        p_b[3*W + l] = c01 * rcp;
+        p_b[4*W + l] = (a00*a22 - a02*a20) * rcp;
+        p_b[5*W + l] = (a02*a10 - a00*a12) * rcp;
+        p_b[6*W + l] = c02 * rcp;
+        p_b[7*W + l] = (a01*a20 - a00*a21) * rcp;
+        p_b[8*W + l] = (a00*a11 - a01*a10) * rcp;
+        p_det[l]     = det;
+    }
+}
+
+//- The 4x4 kernel expands the determinant and adjugate in terms of the six 2x2 minors of the
+//  upper two rows (s0-s5) and the six of the lower two rows (c0-c5).
+//
+template<class T, size_t W>
+void
+inverse4_kernel(T const* p_a, T* p_b, T* p_det)
+{
+    for (size_t l = 0;  l < W;  ++l)
+    {
+        T const     a00 = p_a[ 0*W + l], a01 = p_a[ 1*W + l], a02 = p_a[ 2*W + l], a03 = p_a[ 3*W + l];
+        T const     a10 = p_a[ 4*W + l], a11 = p_a[ 5*W + l], a12 = p_a[ 6*W + l], a13 = p_a[ 7*W + l];
+        T const     a20 = p_a[ 8*W + l], a21 = p_a[ 9*W + l], a22 = p_a[10*W + l], a23 = p_a[11*W + l];
+        T const     a30 = p_a[12*W + l], a31 = p_a[13*W + l], a32 = p_a[14*W + l], a33 = p_a[15*W + l];
+
+        T const     s0 = a00*a11 - a10*a01;
+        T const     s1 = a00*a12 - a10*a02;
+        T const     s2 = a00*a13 - a10*a03;
+        T const     s3 = a01*a12 - a11*a02;
+        T const     s4 = a01*a13 - a11*a03;
+        T const     s5 = a02*a13 - a12*a03;
+
+        T const     c5 = a22*a33 - a32*a23;
+        T const     c4 = a21*a33 - a31*a23;
+        T const     c3 = a21*a32 - a31*a22;
+        T const     c2 = a20*a33 - a30*a23;
+        T const     c1 = a20*a32 - a30*a22;
+        T const     c0 = a20*a31 - a30*a21;
+
+        T const     det = s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+        T const     rcp = T(1) / det;
+
+        p_b[ 0*W + l] = ( a11*c5 - a12*c4 + a13*c3) * rcp;
+        p_b[ 1*W + l] = (-a01*c5 + a02*c4 - a03*c3) * rcp;
+        p_b[ 2*W + l] = ( a31*s5 - a32*s4 + a33*s3) * rcp;
+        p_b[ 3*W + l] = (-a21*s5 + a22*s4 - a23*s3) * rcp;
+        p_b[ 4*W + l] = (-a10*c5 + a12*c2 - a13*c1) * rcp;
+        p_b[ 5*W + l] = ( a00*c5 - a02*c2 + a03*c1) * rcp;
+        p_b[ 6*W + l] = (-a30*s5 + a32*s2 - a33*s1) * rcp;
+        p_b[ 7*W + l] = ( a20*s5 - a22*s2 + a23*s1) * rcp;
+        p_b[ 8*W + l] = ( a10*c4 - a11*c2 + a13*c0) * rcp;
+        p_b[ 9*W + l] = (-a00*c4 + a01*c2 - a03*c0) * rcp;
+        p_b[10*W + l] = ( a30*s4 - a31*s2 + a33*s0) * rcp;
+        p_b[11*W + l] = (-a20*s4 + a21*s2 - a23*s0) * rcp;
+        p_b[12*W + l] = (-a10*c3 + a11*c1 - a12*c0) * rcp;
+        p_b[13*W + l] = ( a00*c3 - a01*c1 + a02*c0) * rcp;
+        p_b[14*W + l] = (-a30*s3 + a31*s1 - a32*s0) * rcp;
+        p_b[15*W + l] = ( a20*s3 - a21*s1 + a22*s0) * rcp;
+        p_det[l]      = det;
+    }
+}
+
+//- Inverse of the affine 4x4 transform [R t; 0 1], which is [inv(R) -inv(R)*t; 0 1].  The last
+//  row of the input is not read.
+//
+template<class T, size_t W>
+void
+affine_inverse4_kernel(T const* p_a, T* p_b, T* p_det)
+{
+    for (size_t l = 0;  l < W;  ++l)
+    {
+        T const     a00 = p_a[0*W + l], a01 = p_a[1*W + l], a02 = p_a[ 2*W + l], t0 = p_a[ 3*W + l];
+        T const     a10 = p_a[4*W + l], a11 = p_a[5*W + l], a12 = p_a[ 6*W + l], t1 = p_a[ 7*W + l];
+        T const     a20 = p_a[8*W + l], a21 = p_a[9*W + l], a22 = p_a[10*W + l], t2 = p_a[11*W + l];
+
+        T const     c00 = a11*a22 - a12*a21;
+        T const     c01 = a12*a20 - a10*a22;
+        T const     c02 = a10*a21 - a11*a20;
+        T const     det = a00*c00 + a01*c01 + a02*c02;
+        T const     rcp = T(1) / det;
+
+        T const     b00 = c00 * rcp;
+        T const     b01 = (a02*a21 - a01*a22) * rcp;
+        T const     b02 = (a01*a12 - a02*a11) * rcp;
+        T const     b10 = c01 * rcp;
+        T const     b11 = (a00*a22 - a02*a20) * rcp;
+        T const     b12 = (a02*a10 - a00*a12) * rcp;
+        T const     b20 = c02 * rcp;
+        T const     b21 = (a01*a20 - a00*a21) * rcp;
+        T const     b22 = (a00*a11 - a01*a10) * rcp;
+
+        p_b[ 0*W + l] = b00;
+        p_b[ 1*W + l] = b01;
+        p_b[ 2*W + l] = b02;
+        p_b[ 3*W + l] = -(b00*t0 + b01*t1 + b02*t2);
+        p_b[ 4*W + l] = b10;
+        p_b[ 5*W + l] = b11;
+        p_b[ 6*W + l] = b12;
+        p_b[ 7*W + l] = -(b10*t0 + b11*t1 + b12*t2);
+        p_b[ 8*W + l] = b20;
+        p_b[ 9*W + l] = b21;
+        p_b[10*W + l] = b22;
+        p_b[11*W + l] = -(b20*t0 + b21*t1 + b22*t2);
+        p_b[12*W + l] = T(0);
+        p_b[13*W + l] = T(0);
+        p_b[14*W + l] = T(0);
+        p_b[15*W + l] = T(1);
+        p_det[l]      = det;
+    }
+}
+
+//- Determinants only, for W matrices at once.
+//
+template<class T, size_t N, size_t W>
+void
+determinant_kernel(T const* p_a, T* p_det)
+{
+    static_assert(N >= 2  &&  N <= 4);
+
+    for (size_t l = 0;  l < W;  ++l)
+    {
+        auto    a = [p_a, l](size_t i, size_t j) { return p_a[(i*N + j)*W + l]; };
+
+        if constexpr (N == 2)
+        {
+            p_det[l] = a(0,0)*a(1,1) - a(0,1)*a(1,0);
+        }
+        else if constexpr (N == 3)
+        {
+            p_det[l] = a(0,0)*(a(1,1)*a(2,2) - a(1,2)*a(2,1))
+                     + a(0,1)*(a(1,2)*a(2,0) - a(1,0)*a(2,2))
+                     + a(0,2)*(a(1,0)*a(2,1) - a(1,1)*a(2,0));
+        }
+        else
+        {
+            T const     s0 = a(0,0)*a(1,1) - a(1,0)*a(0,1);
+            T const     s1 = a(0,0)*a(1,2) - a(1,0)*a(0,2);
+            T const     s2 = a(0,0)*a(1,3) - a(1,0)*a(0,3);
+            T const     s3 = a(0,1)*a(1,2) - a(1,1)*a(0,2);
+            T const     s4 = a(0,1)*a(1,3) - a(1,1)*a(0,3);
+            T const     s5 = a(0,2)*a(1,3) - a(1,2)*a(0,3);
+            T const     c5 = a(2,2)*a(3,3) - a(3,2)*a(2,3);
+            T const     c4 = a(2,1)*a(3,3) - a(3,1)*a(2,3);
+            T const     c3 = a(2,1)*a(3,2) - a(3,1)*a(2,2);
+            T const     c2 = a(2,0)*a(3,3) - a(3,0)*a(2,3);
+            T const     c1 = a(2,0)*a(3,2) - a(3,0)*a(2,2);
+            T const     c0 = a(2,0)*a(3,1) - a(3,0)*a(2,1);
+
+            p_det[l] = s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+        }
+    }
+}
+
+//- Dispatches to the closed-form kernel for an (N x N) matrix.
+//
+template<class T, size_t N, size_t W>
+void
+inverse_kernel(T const* p_a, T* p_b, T* p_det)
+{
+    static_assert(N >= 2  &&  N <= 4);
+
+    if constexpr (N == 2)
+        inverse2_kernel<T, W>(p_a, p_b, p_det);
+    else if constexpr (N == 3)
+        inverse3_kernel<T, W>(p_a, p_b, p_det);
+    else
+        inverse4_kernel<T, W>(p_a, p_b, p_det);
+}
+
+//==================================================================================================
+//  Traits type that determines the result type of inverse():  owning engines are preserved, and
+//  all other engines produce a dr_matrix_engine.
+//==================================================================================================
+//
+template<class ET, class OT>
+struct inverse_result
+{
+    using elem_type = remove_cv_t<typename ET::element_type>;
+    using type      = matrix<dr_matrix_engine<elem_type, allocator<elem_type>>, OT>;
+};
+
+template<class T, size_t N, class OT>
+struct inverse_result<fs_matrix_engine<T, N, N>, OT>
+{
+    using type = matrix<fs_matrix_engine<T, N, N>, OT>;
+};
+
+template<class T, class AT, class OT>
+struct inverse_result<dr_matrix_engine<T, AT>, OT>
+{
+    using type = matrix<dr_matrix_engine<T, AT>, OT>;
+};
+
+template<class ET, class OT>
+using inverse_result_t = typename inverse_result<ET, OT>::type;
+
+//- Packs a fixed-size square matrix into a row-major array, and unpacks it again.
+//
+template<class T, size_t N, class OT>
+void
+pack_fs(matrix<fs_matrix_engine<T, N, N>, OT> const& m, T* p_dst, size_t stride)
+{
+    for (size_t i = 0;  i < N;  ++i)
+    {
+        for (size_t j = 0;  j < N;  ++j)
+        {
+            p_dst[(i*N + j)*stride] = m(i, j);
+        }
+    }
+}
+
+template<class T, size_t N, class OT>
+void
+unpack_fs(T const* p_src, size_t stride, matrix<fs_matrix_engine<T, N, N>, OT>& m)
+{
+    for (size_t i = 0;  i < N;  ++i)
+    {
+        for (size_t j = 0;  j < N;  ++j)
+        {
+            m(i, j) = p_src[(i*N + j)*stride];
+        }
+    }
+}
+
+}       //- detail namespace
+//==================================================================================================
+//                              **** DETERMINANT AND INVERSE ****
+//==================================================================================================
+//  General square matrices, via LU factorization.  inverse() throws runtime_error if the matrix
+//  is exactly singular.
+//==================================================================================================
+//
+template<class ET, class OT>
+auto
+determinant(matrix<ET, OT> const& m) -> remove_cv_t<typename ET::element_type>
+{
+    using elem_type = remove_cv_t<typename ET::element_type>;
+
+    static_assert(is_floating_point_v<elem_type>, "determinant requires floating-point elements");
+
+    if (m.rows() != m.columns())
+    {
+        throw runtime_error("non-square matrix");
+    }
+
+    size_t const    n = static_cast<size_t>(m.rows());
+
+    std::vector<elem_type>  a(n*n);
+    std::vector<size_t>     piv(n);
+
+    detail::copy_to_buffer(m, a.data(), false);
+
+    int const   sign = detail::lu_factor(n, a.data(), n, piv.data());
+    elem_type   det  = static_cast<elem_type>(sign);
+
+    for (size_t i = 0;  i < n  &&  sign != 0;  ++i)
+    {
+        det *= a[i*n + i];
+    }
+    return det;
+}
+
+template<class ET, class OT>
+auto
+inverse(matrix<ET, OT> const& m) -> detail::inverse_result_t<ET, OT>
+{
+    using result_type = detail::inverse_result_t<ET, OT>;
+    using elem_type   = typename result_type::element_type;
+    using size_type   = typename result_type::size_type;
+
+    static_assert(is_floating_point_v<elem_type>, "inverse requires floating-point elements");
+
+    if (m.rows() != m.columns())
+    {
+        throw runtime_error("non-square matrix");
+    }
+
+    size_t const    n = static_cast<size_t>(m.rows());
+
+    std::vector<elem_type>  a(n*n), b(n*n);
+    std::vector<size_t>     piv(n);
+
+    detail::copy_to_buffer(m, a.data(), false);
+
+    if (detail::lu_factor(n, a.data(), n, piv.data()) == 0)
+    {
+        throw runtime_error("singular matrix");
+    }
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        b[i*n + i] = elem_type(1);
+    }
+    detail::lu_solve(n, a.data(), n, piv.data(), n, b.data(), n);
+
+    result_type     mr;
+
+    if constexpr (result_requires_resize(mr))
+    {
+        mr.resize(static_cast<size_type>(n), static_cast<size_type>(n));
+    }
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        for (size_t j = 0;  j < n;  ++j)
+        {
+            mr(static_cast<size_type>(i), static_cast<size_type>(j)) = b[i*n + j];
+        }
+    }
+    return mr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  Fixed-size matrices.  2x2, 3x3 and 4x4 matrices use the closed-form kernels; a 4x4 matrix with
+//  last row (0,0,0,1) uses the cheaper and more accurate affine kernel.  Larger sizes use LU.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, size_t N, class OT>
+auto
+determinant(matrix<fs_matrix_engine<T, N, N>, OT> const& m) -> T
+{
+    static_assert(is_floating_point_v<T>, "determinant requires floating-point elements");
+
+    if constexpr (N == 1)
+    {
+        return m(0, 0);
+    }
+    else if constexpr (N == 2)
+    {
+        return m(0, 0)*m(1, 1) - m(0, 1)*m(1, 0);
+    }
+    else if constexpr (N == 3)
+    {
+        return m(0, 0)*(m(1, 1)*m(2, 2) - m(1, 2)*m(2, 1))
+             + m(0, 1)*(m(1, 2)*m(2, 0) - m(1, 0)*m(2, 2))
+             + m(0, 2)*(m(1, 0)*m(2, 1) - m(1, 1)*m(2, 0));
+    }
+    else
+    {
+        T       a[N*N];
+        size_t  piv[N];
+
+        detail::pack_fs(m, a, 1);
+
+        int const   sign = detail::lu_factor(N, a, N, piv);
+        T           det  = static_cast<T>(sign);
+
+        for (size_t i = 0;  i < N  &&  sign != 0;  ++i)
+        {
+            det *= a[i*N + i];
+        }
+        return det;
+    }
+}
+
+template<class T, size_t N, class OT>
+auto
+inverse(matrix<fs_matrix_engine<T, N, N>, OT> const& m) -> matrix<fs_matrix_engine<T, N, N>, OT>
+{
+    static_assert(is_floating_point_v<T>, "inverse requires floating-point elements");
+
+    matrix<fs_matrix_engine<T, N, N>, OT>   mr;
+    T                                       a[N*N], b[N*N], det;
+
+    detail::pack_fs(m, a, 1);
+
+    if constexpr (N == 1)
+    {
+        det  = a[0];
+        b[0] = T(1) / a[0];
+    }
+    else if constexpr (N == 4)
+    {
+        if (a[12] == T(0)  &&  a[13] == T(0)  &&  a[14] == T(0)  &&  a[15] == T(1))
+            detail::affine_inverse4_kernel<T, 1>(a, b, &det);
+        else
+            detail::inverse4_kernel<T, 1>(a, b, &det);
+    }
+    else if constexpr (N <= 3)
+    {
+        detail::inverse_kernel<T, N, 1>(a, b, &det);
+    }
+    else
+    {
+        size_t  piv[N];
+
+        det = static_cast<T>(detail::lu_factor(N, a, N, piv));
+
+        fill_n(b, N*N, T(0));
+        for (size_t i = 0;  i < N  &&  det != T(0);  ++i)
+        {
+            b[i*N + i] = T(1);
+        }
+        if (det != T(0))
+        {
+            detail::lu_solve(N, a, N, piv, N, b, N);
+        }
+    }
+
+    if (det == T(0))
+    {
+        throw runtime_error("singular matrix");
+    }
+
+    detail::unpack_fs(b, 1, mr);
+    return mr;
+}
+
+//- Inverse of the affine transform [R t; 0 1].  The last row of the operand is assumed to be
+//  (0,0,0,1) and is not read.
+//
+template<class T, class OT>
+auto
+affine_inverse(matrix<fs_matrix_engine<T, 4, 4>, OT> const& m) -> matrix<fs_matrix_engine<T, 4, 4>, OT>
+{
+    static_assert(is_floating_point_v<T>, "inverse requires floating-point elements");
+
+    matrix<fs_matrix_engine<T, 4, 4>, OT>   mr;
+    T                                       a[16], b[16], det;
+
+    detail::pack_fs(m, a, 1);
+    detail::affine_inverse4_kernel<T, 1>(a, b, &det);
+
+    if (det == T(0))
+    {
+        throw runtime_error("singular matrix");
+    }
+
+    detail::unpack_fs(b, 1, mr);
+    return mr;
+}
+
+//==================================================================================================
+//                              **** BATCHED SMALL MATRICES ****
+//==================================================================================================
+//  Inverts/takes the determinant of count fixed-size matrices at p_src, writing the results to
+//  p_dst (which may be the same as p_src).  The functions returning size_t return the number of
+//  singular matrices encountered; their inverses are not finite.
+//==================================================================================================
+//
+namespace detail {
+
+template<size_t N, bool Affine, class T, class OT>
+size_t
+batch_inverse_impl(matrix<fs_matrix_engine<T, N, N>, OT> const* p_src,
+                   matrix<fs_matrix_engine<T, N, N>, OT>* p_dst, size_t count)
+{
+    static_assert(is_floating_point_v<T>, "inverse requires floating-point elements");
+
+    constexpr size_t    W = batch_lanes;
+
+    T       a[N*N*W], b[N*N*W], det[W];
+    size_t  singular = 0;
+
+    for (size_t i0 = 0;  i0 < count;  i0 += W)
+    {
+        size_t const    nb = min(W, count - i0);
+
+        //- A partial final group is padded with identity matrices.
+        //
+        for (size_t l = 0;  l < W;  ++l)
+        {
+            if (l < nb)
+            {
+                pack_fs(p_src[i0 + l], a + l, W);
+            }
+            else
+            {
+                for (size_t k = 0;  k < N*N;  ++k)
+                {
+                    a[k*W + l] = (k % (N+1) == 0) ? T(1) : T(0);
+                }
+            }
+        }
+
+        if constexpr (Affine)
+            affine_inverse4_kernel<T, W>(a, b, det);
+        else
+            inverse_kernel<T, N, W>(a, b, det);
+
+        for (size_t l = 0;  l < nb;  ++l)
+        {
+            unpack_fs(b + l, W, p_dst[i0 + l]);
+            singular += (det[l] == T(0));
+        }
+    }
+    return singular;
+}
+
+}       //- detail namespace
+
+template<class T, size_t N, class OT>
+size_t
+batch_inverse(matrix<fs_matrix_engine<T, N, N>, OT> const* p_src,
+              matrix<fs_matrix_engine<T, N, N>, OT>* p_dst, size_t count)
+{
+    return detail::batch_inverse_impl<N, false>(p_src, p_dst, count);
+}
+
+template<class T, class OT>
+size_t
+batch_affine_inverse(matrix<fs_matrix_engine<T, 4, 4>, OT> const* p_src,
+                     matrix<fs_matrix_engine<T, 4, 4>, OT>* p_dst, size_t count)
+{
+    return detail::batch_inverse_impl<4, true>(p_src, p_dst, count);
+}
+
+template<class T, size_t N, class OT>
+void
+batch_determinant(matrix<fs_matrix_engine<T, N, N>, OT> const* p_src, T* p_det, size_t count)
+{
+    static_assert(is_floating_point_v<T>, "determinant requires floating-point elements");
+
+    if constexpr (N < 2  ||  N > 4)
+    {
+        for (size_t i = 0;  i < count;  ++i)
+        {
+            p_det[i] = determinant(p_src[i]);
+        }
+    }
+    else
+    {
+        constexpr size_t    W = detail::batch_lanes;
+
+        T   a[N*N*W], det[W];
+
+        for (size_t i0 = 0;  i0 < count;  i0 += W)
+        {
+            size_t const    nb = min(W, count - i0);
+
+            for (size_t l = 0;  l < nb;  ++l)
+            {
+                detail::pack_fs(p_src[i0 + l], a + l, W);
+            }
+            for (size_t l = nb;  l < W;  ++l)
+            {
+                for (size_t k = 0;  k < N*N;  ++k)
+                {
+                    a[k*W + l] = T(0);
+                }
+            }
+
+            detail::determinant_kernel<T, N, W>(a, det);
+            copy(det, det + nb, p_det + i0);
+        }
+    }
+}
+
+//==================================================================================================
+//                              **** LINEAR SYSTEMS ****
+//==================================================================================================
+//  solve() returns the solution of A*x = b, by LU factorization in the precision of A, and throws
+//  runtime_error if A is exactly singular.
+//
+//  mixed_precision_solve() factors A in the lower precision LT instead, which is about twice as
+//  fast, and recovers full accuracy by iterative refinement:  each step computes the residual
+//  r = b - A*x in the precision of A with the library's matrix-vector product, solves for a
+//  correction with the low-precision factors, and adds it to x.  Refinement stops once the
+//  residual is at the level of rounding error in A*x.  If the low-precision factors are singular,
+//  or the corrections fail to shrink by half at each step, A is refactored in full precision.
+//  The returned refinement_info reports which path was taken.
+//==================================================================================================
+//
+struct refinement_info
+{
+    size_t  iterations;     //- Refinement steps taken, including the initial solve
+    bool    refined;        //- False if the full-precision fallback was used
+};
+
+inline constexpr size_t     max_refinement_iterations = 30;
+
+template<class ET, class OT, class ET2, class OT2>
+auto
+solve(matrix<ET, OT> const& a, vector<ET2, OT2> const& b)
+    -> dyn_vector<remove_cv_t<typename ET::element_type>>
+{
+    using elem_type = remove_cv_t<typename ET::element_type>;
+    using size_type = typename dyn_vector<elem_type>::size_type;
+
+    static_assert(is_floating_point_v<elem_type>, "solve requires floating-point elements");
+
+    if (a.rows() != a.columns())
+    {
+        throw runtime_error("non-square matrix");
+    }
+    if (static_cast<size_t>(b.elements()) != static_cast<size_t>(a.rows()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_t const    n = static_cast<size_t>(a.rows());
+
+    std::vector<elem_type>  lu(n*n);
+    std::vector<size_t>     piv(n);
+    dyn_vector<elem_type>   x(static_cast<size_type>(n));
+
+    detail::copy_to_buffer(a, lu.data(), false);
+
+    if (detail::lu_factor(n, lu.data(), n, piv.data()) == 0)
+    {
+        throw runtime_error("singular matrix");
+    }
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        x(static_cast<size_type>(i)) = static_cast<elem_type>(b(static_cast<typename ET2::size_type>(i)));
+    }
+    detail::lu_solve(n, lu.data(), n, piv.data(), 1, x.engine().data(), 1);
+
+    return x;
+}
+
+template<class LT = float, class ET, class OT, class ET2, class OT2>
+auto
+mixed_precision_solve(matrix<ET, OT> const& a, vector<ET2, OT2> const& b)
+    -> tuple<dyn_vector<remove_cv_t<typename ET::element_type>>, refinement_info>
+{
+    using elem_type   = remove_cv_t<typename ET::element_type>;
+    using result_type = dyn_vector<elem_type>;
+    using size_type   = typename result_type::size_type;
+
+    static_assert(is_floating_point_v<elem_type>  &&  is_floating_point_v<LT>,
+                  "mixed_precision_solve requires floating-point elements");
+
+    if (a.rows() != a.columns())
+    {
+        throw runtime_error("non-square matrix");
+    }
+    if (static_cast<size_t>(b.elements()) != static_cast<size_t>(a.rows()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_t const    n = static_cast<size_t>(a.rows());
+
+    std::vector<LT>         lu(n*n), d(n);
+    std::vector<elem_type>  bb(n), r(n);
+    std::vector<size_t>     piv(n);
+    result_type             x(static_cast<size_type>(n));
+    refinement_info         info{0, false};
+
+    detail::copy_to_buffer(a, lu.data(), false);
+
+    //- The stopping criterion scales with ||A||, estimated here from the low-precision copy.
+    //
+    elem_type   anrm = 0;
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        elem_type   row = 0;
+
+        for (size_t j = 0;  j < n;  ++j)
+        {
+            row += abs(static_cast<elem_type>(lu[i*n + j]));
+        }
+        anrm = max(anrm, row);
+        r[i] = bb[i] = static_cast<elem_type>(b(static_cast<typename ET2::size_type>(i)));
+    }
+
+    if (detail::lu_factor(n, lu.data(), n, piv.data()) != 0)
+    {
+        elem_type const     tol   = anrm * numeric_limits<elem_type>::epsilon() * sqrt(elem_type(n));
+        elem_type           dprev = numeric_limits<elem_type>::infinity();
+
+        while (info.iterations < max_refinement_iterations)
+        {
+            for (size_t i = 0;  i < n;  ++i)
+            {
+                d[i] = static_cast<LT>(r[i]);
+            }
+            detail::lu_solve(n, lu.data(), n, piv.data(), 1, d.data(), 1);
+
+            elem_type   dnrm = 0;
+
+            for (size_t i = 0;  i < n;  ++i)
+            {
+                x(static_cast<size_type>(i)) += static_cast<elem_type>(d[i]);
+                dnrm = max(dnrm, abs(static_cast<elem_type>(d[i])));
+            }
+            ++info.iterations;
+
+            if (!(dnrm <= dprev / 2))
+            {
+                break;
+            }
+            dprev = dnrm;
+
+            auto const  ax = a * x;
+            elem_type   rnrm = 0;
+            elem_type   xnrm = 0;
+
+            for (size_t i = 0;  i < n;  ++i)
+            {
+                r[i] = bb[i] - static_cast<elem_type>(ax(i));
+                rnrm = max(rnrm, abs(r[i]));
+                xnrm = max(xnrm, abs(x(static_cast<size_type>(i))));
+            }
+            if (rnrm <= xnrm * tol)
+            {
+                info.refined = true;
+                break;
+            }
+        }
+    }
+
+    if (!info.refined)
+    {
+        x = solve(a, b);
+    }
+    return tuple<result_type, refinement_info>(std::move(x), info);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_MATRIX_INVERSE_HPP_DEFINED
@@ -974,8 +974,46 @@ struct matrix_multiplication_traits<OT, vector<ET1, OT1>, matrix<ET2, OT2>>
 //---------------
 //- matrix*matrix
 //
-template<class OT, class ET1, class OT1, class ET2, class OT2>
-struct matrix_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+namespace detail {
+//- Engines with exploitable structure (low-rank, Kronecker, permutation, Toeplitz, ...) compute
+//  their products with arbitrary matrices in specializations of matrix_product_traits for the
+//  side on which they appear, and specialize structured_multiplication_priority to a positive
+//  value.  When both operands are structured, the side whose engine has the higher priority (the
+//  left, on a tie) computes the product, so that specializations for different engines never
+//  compete.  Priorities rank how cheaply an engine multiplies an arbitrary operand.
+//
+template<class ET>
+struct structured_multiplication_priority
+:   public integral_constant<int, 0>
+{};
+
+template<class ET>
+inline constexpr int    structured_multiplication_priority_v =
+                            structured_multiplication_priority<ET>::value;
+
+enum class structured_side
+{
+    none,
+    left,
+    right
+};
+
+template<class ET1, class ET2>
+inline constexpr structured_side    structured_side_v =
+    (structured_multiplication_priority_v<ET1> == 0  &&  structured_multiplication_priority_v<ET2> == 0)
+        ? structured_side::none
+        : (structured_multiplication_priority_v<ET1> >= structured_multiplication_priority_v<ET2>)
+            ? structured_side::left
+            : structured_side::right;
+
+template<class OT, class OP1, class OP2, structured_side S>
+struct matrix_product_traits;
+
+//- The general product, computed element by element; also used for a structured side whose
+//  engine provides no specialization.
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2, structured_side S>
+struct matrix_product_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>, S>
 {
     using engine_type  = matrix_multiplication_engine_t<OT, ET1, ET2>;
     using op_traits    = OT;
@@ -988,5 +1026,13 @@ struct matrix_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
     static result_type  multiply(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
 };
 
+}       //- detail namespace
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+:   public detail::matrix_product_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>,
+                                         detail::structured_side_v<ET1, ET2>>
+{};
+
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_MULTIPLICATION_TRAITS_HPP_DEFINED
@@ -239,9 +239,9 @@ matrix_multiplication_traits<OTR, vector<ET1, OT1>, matrix<ET2, OT2>>::multiply
 //---------------
 //- matrix*matrix
 //
-template<class OTR, class ET1, class OT1, class ET2, class OT2>
+template<class OTR, class ET1, class OT1, class ET2, class OT2, detail::structured_side S>
 inline auto
-matrix_multiplication_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply
+detail::matrix_product_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>, S>::multiply
 (matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
 {
     PrintOperandTypes<result_type>("multiplication_traits (m*m)", m1, m2);
@@ -260,6 +260,26 @@ matrix_multiplication_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply
 		mr.resize(rows, cols);
 	}
 
+	//- Operands and results with dense row-major storage of one element type go to the blocked
+	//  kernel, which visits the inner dimension in the same order as the loop below.
+	//
+	using elem_type_r = remove_cv_t<typename result_type::element_type>;
+
+	if constexpr (detail::has_data_v<ET1>  &&  detail::has_data_v<ET2>  &&  detail::has_data_v<engine_type>  &&
+				  is_same_v<remove_cv_t<typename ET1::element_type>, elem_type_r>  &&
+				  is_same_v<remove_cv_t<typename ET2::element_type>, elem_type_r>)
+	{
+		auto const&		e1 = m1.engine();
+		auto const&		e2 = m2.engine();
+		auto&			er = mr.engine();
+
+		detail::gemm_assign_kernel(static_cast<size_t>(rows), static_cast<size_t>(cols), static_cast<size_t>(inner),
+								   static_cast<elem_type_r const*>(e1.data()), static_cast<size_t>(e1.column_capacity()),
+								   static_cast<elem_type_r const*>(e2.data()), static_cast<size_t>(e2.column_capacity()),
+								   er.data(), static_cast<size_t>(er.column_capacity()));
+		return mr;
+	}
+
 	for (ir = 0, i1 = 0;  ir < rows;  ++ir, ++i1)
 	{
 		for (jr = 0, j2 = 0;  jr < cols;  ++jr, ++j2)
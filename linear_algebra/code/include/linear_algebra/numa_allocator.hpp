@@ -0,0 +1,192 @@
+//==================================================================================================
+//  File:       numa_allocator.hpp
+//
+//  Summary:    This header defines an allocator for the dynamic engines that places large buffers
+//              across NUMA nodes by first touch.  Operating systems that use a first-touch policy
+//              (the default on Linux) back each page with memory local to the thread that first
+//              writes it, so a buffer that is value-initialized by a single thread lands entirely
+//              on one node.  This allocator instead initializes large buffers with one thread per
+//              hardware thread, so that pages are spread over the nodes on which those threads run:
+//
+//                - partitioned:  thread k initializes the k-th of P contiguous, page-aligned
+//                  ranges; for a row-major matrix, this matches a parallel kernel that assigns
+//                  each of P threads an equal block of rows.
+//
+//                - interleaved:  page p is initialized by thread p mod P, spreading every part of
+//                  the buffer over all nodes, for access patterns that are not partitioned by row.
+//
+//              Buffers are page-aligned, so that range boundaries coincide with page boundaries.
+//              Small buffers, and elements whose construction may throw, are initialized serially.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_NUMA_ALLOCATOR_HPP_DEFINED
+#define LINEAR_ALGEBRA_NUMA_ALLOCATOR_HPP_DEFINED
+
+namespace STD_LA {
+
+enum class numa_placement
+{
+    partitioned,
+    interleaved
+};
+
+template<class T, numa_placement P = numa_placement::partitioned>
+class numa_allocator
+{
+  public:
+    using value_type      = T;
+    using pointer         = T*;
+    using const_pointer   = T const*;
+    using size_type       = size_t;
+    using difference_type = ptrdiff_t;
+    using is_always_equal = true_type;
+
+    template<class U>
+    struct rebind
+    {
+        using other = numa_allocator<U, P>;
+    };
+
+    static constexpr numa_placement placement = P;
+    static constexpr size_type      page_size = 4096;
+
+    //- Buffers smaller than this are initialized by the calling thread.
+    //
+    static constexpr size_type      parallel_threshold = 256*page_size;
+
+    numa_allocator() noexcept = default;
+    template<class U>
+    numa_allocator(numa_allocator<U, P> const&) noexcept {}
+
+    pointer     allocate(size_type n);
+    void        deallocate(pointer p, size_type n) noexcept;
+
+    void        first_touch(pointer p, size_type n, const_pointer p_src) const;
+
+    static size_type                threads() noexcept;
+    static tuple<size_type, size_type>
+                                    partition(size_type n, size_type parts, size_type k) noexcept;
+
+  private:
+    static constexpr size_type  alignment = max(page_size, alignof(T));
+    static constexpr size_type  page_elements = max(size_type(1), page_size / sizeof(T));
+};
+
+template<class T1, numa_placement P1, class T2, numa_placement P2> inline
+bool
+operator ==(numa_allocator<T1, P1> const&, numa_allocator<T2, P2> const&) noexcept
+{
+    return true;
+}
+
+template<class T1, numa_placement P1, class T2, numa_placement P2> inline
+bool
+operator !=(numa_allocator<T1, P1> const&, numa_allocator<T2, P2> const&) noexcept
+{
+    return false;
+}
+
+template<class T, numa_placement P>
+typename numa_allocator<T,P>::pointer
+numa_allocator<T,P>::allocate(size_type n)
+{
+    if (n > numeric_limits<size_type>::max() / sizeof(T))
+    {
+        throw bad_array_new_length();
+    }
+    return static_cast<pointer>(::operator new(n*sizeof(T), align_val_t(alignment)));
+}
+
+template<class T, numa_placement P>
+void
+numa_allocator<T,P>::deallocate(pointer p, size_type) noexcept
+{
+    ::operator delete(p, align_val_t(alignment));
+}
+
+//- Value-initializes (if p_src is null) or copies the n elements at p, as described above.
+//
+template<class T, numa_placement P>
+void
+numa_allocator<T,P>::first_touch(pointer p, size_type n, const_pointer p_src) const
+{
+    auto    init = [p, p_src](size_type b, size_type e)
+                   {
+                       if (p_src == nullptr)
+                           uninitialized_value_construct(p + b, p + e);
+                       else
+                           uninitialized_copy(p_src + b, p_src + e, p + b);
+                   };
+
+    size_type const     nthr = threads();
+
+    if constexpr (is_nothrow_default_constructible_v<T>  &&  is_nothrow_copy_constructible_v<T>)
+    {
+        if (nthr > 1  &&  n*sizeof(T) >= parallel_threshold)
+        {
+            auto    work = [=](size_type k)
+                           {
+                               if constexpr (P == numa_placement::partitioned)
+                               {
+                                   auto const  [b, e] = partition(n, nthr, k);
+                                   init(b, e);
+                               }
+                               else
+                               {
+                                   for (size_type b = k*page_elements;  b < n;  b += nthr*page_elements)
+                                   {
+                                       init(b, min(n, b + page_elements));
+                                   }
+                               }
+                           };
+
+            std::vector<std::thread>    pool;
+
+            pool.reserve(nthr - 1);
+
+            for (size_type k = 1;  k < nthr;  ++k)
+            {
+                try
+                {
+                    pool.emplace_back(work, k);
+                }
+                catch (...)
+                {
+                    work(k);
+                }
+            }
+            work(0);
+
+            for (auto& t : pool)
+            {
+                t.join();
+            }
+            return;
+        }
+    }
+    init(0, n);
+}
+
+template<class T, numa_placement P> inline
+typename numa_allocator<T,P>::size_type
+numa_allocator<T,P>::threads() noexcept
+{
+    return max(size_type(1), static_cast<size_type>(std::thread::hardware_concurrency()));
+}
+
+//- Returns the half-open element range [b, e) of part k when n elements are divided into 'parts'
+//  contiguous ranges of whole pages, as nearly equal in size as possible.
+//
+template<class T, numa_placement P>
+tuple<typename numa_allocator<T,P>::size_type, typename numa_allocator<T,P>::size_type>
+numa_allocator<T,P>::partition(size_type n, size_type parts, size_type k) noexcept
+{
+    size_type const     pages = (n + page_elements - 1) / page_elements;
+    size_type const     b     = min(n, (pages*k / parts) * page_elements);
+    size_type const     e     = min(n, (pages*(k + 1) / parts) * page_elements);
+
+    return tuple<size_type, size_type>(b, e);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_NUMA_ALLOCATOR_HPP_DEFINED
@@ -0,0 +1,351 @@
+//==================================================================================================
+//  File:       out_of_core.hpp
+//
+//  Summary:    This header defines file-backed matrices and an out-of-core matrix product for
+//              operands too large to be held in memory.
+//
+//              A matrix file holds a 64-byte header (a tag, the element size, and the extents)
+//              followed by the elements in row-major order.  matrix_file<T> reads and writes
+//              rectangular blocks of such a file.
+//
+//              out_of_core_multiply() computes C = A*B tile by tile:  for each tile of C, it
+//              accumulates the products of the corresponding tiles of A and B with the dense GEMM
+//              kernel, then writes the tile of C back to its file.  Reading is double-buffered:
+//              while one pair of tiles is being multiplied, a reader thread loads the next pair;
+//              likewise, each finished tile of C is written by a writer thread while the next one
+//              is computed.  At most six tiles are resident at any time.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_OUT_OF_CORE_HPP_DEFINED
+#define LINEAR_ALGEBRA_OUT_OF_CORE_HPP_DEFINED
+
+#include <fstream>
+#include <future>
+#include <string>
+
+namespace STD_LA {
+//==================================================================================================
+//  File-backed matrix.
+//==================================================================================================
+//
+template<class T>
+class matrix_file
+{
+    static_assert(is_trivially_copyable_v<T>);
+
+  public:
+    using value_type = T;
+    using size_type  = size_t;
+
+    static constexpr uint64_t   tag         = 0x58495254414d414c;     //- "LAMATRIX"
+    static constexpr size_type  data_offset = 64;
+
+    matrix_file() = default;
+    matrix_file(matrix_file&&) = default;
+    matrix_file(matrix_file const&) = delete;
+
+    matrix_file&    operator =(matrix_file&&) = default;
+    matrix_file&    operator =(matrix_file const&) = delete;
+
+    static matrix_file  create(std::string const& path, size_type rows, size_type cols);
+    static matrix_file  open(std::string const& path);
+
+    size_type   rows() const noexcept;
+    size_type   columns() const noexcept;
+
+    void    read_block(size_type i0, size_type j0, size_type nr, size_type nc,
+                       T* p_dst, size_type ldd);
+    void    write_block(size_type i0, size_type j0, size_type nr, size_type nc,
+                        T const* p_src, size_type lds);
+
+  private:
+    std::fstream    m_file;
+    size_type       m_rows = 0;
+    size_type       m_cols = 0;
+
+    void    check_block(size_type i0, size_type j0, size_type nr, size_type nc) const;
+    void    seek(size_type i, size_type j);
+};
+
+//- Creates (or truncates) the file at 'path' and sizes it for a zero-filled rows x cols matrix.
+//
+template<class T>
+matrix_file<T>
+matrix_file<T>::create(std::string const& path, size_type rows, size_type cols)
+{
+    size_type const     max_elems = (numeric_limits<size_type>::max() - data_offset) / sizeof(T);
+
+    if (rows == 0  ||  cols == 0  ||  rows > max_elems / cols)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    matrix_file     mf;
+    uint64_t        hdr[data_offset / sizeof(uint64_t)] = { tag, sizeof(T), rows, cols };
+
+    mf.m_file.open(path, ios::in | ios::out | ios::binary | ios::trunc);
+    mf.m_rows = rows;
+    mf.m_cols = cols;
+    mf.m_file.write(reinterpret_cast<char const*>(hdr), sizeof(hdr));
+
+    //- Extend the file to its full size by writing its last element.
+    //
+    T const     zero{};
+
+    mf.seek(rows - 1, cols - 1);
+    mf.m_file.write(reinterpret_cast<char const*>(&zero), sizeof(T));
+
+    if (!mf.m_file)
+    {
+        throw runtime_error("unable to create matrix file");
+    }
+    return mf;
+}
+
+template<class T>
+matrix_file<T>
+matrix_file<T>::open(std::string const& path)
+{
+    matrix_file     mf;
+    uint64_t        hdr[data_offset / sizeof(uint64_t)] = {};
+
+    mf.m_file.open(path, ios::in | ios::out | ios::binary);
+    mf.m_file.read(reinterpret_cast<char*>(hdr), sizeof(hdr));
+
+    if (!mf.m_file)
+    {
+        throw runtime_error("unable to open matrix file");
+    }
+    if (hdr[0] != tag  ||  hdr[1] != sizeof(T)  ||  hdr[2] == 0  ||  hdr[3] == 0)
+    {
+        throw runtime_error("invalid matrix file");
+    }
+    mf.m_rows = static_cast<size_type>(hdr[2]);
+    mf.m_cols = static_cast<size_type>(hdr[3]);
+    return mf;
+}
+
+template<class T> inline
+typename matrix_file<T>::size_type
+matrix_file<T>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T> inline
+typename matrix_file<T>::size_type
+matrix_file<T>::columns() const noexcept
+{
+    return m_cols;
+}
+
+//- Reads the nr x nc block whose top-left element is (i0, j0) into the row-major array at p_dst,
+//  whose leading dimension is ldd.
+//
+template<class T>
+void
+matrix_file<T>::read_block(size_type i0, size_type j0, size_type nr, size_type nc,
+                           T* p_dst, size_type ldd)
+{
+    check_block(i0, j0, nr, nc);
+
+    for (size_type i = 0;  i < nr;  ++i)
+    {
+        seek(i0 + i, j0);
+        m_file.read(reinterpret_cast<char*>(p_dst + i*ldd), static_cast<streamsize>(nc*sizeof(T)));
+    }
+    if (!m_file)
+    {
+        throw runtime_error("unable to read matrix file");
+    }
+}
+
+template<class T>
+void
+matrix_file<T>::write_block(size_type i0, size_type j0, size_type nr, size_type nc,
+                            T const* p_src, size_type lds)
+{
+    check_block(i0, j0, nr, nc);
+
+    for (size_type i = 0;  i < nr;  ++i)
+    {
+        seek(i0 + i, j0);
+        m_file.write(reinterpret_cast<char const*>(p_src + i*lds),
+                     static_cast<streamsize>(nc*sizeof(T)));
+    }
+    if (!m_file.flush())
+    {
+        throw runtime_error("unable to write matrix file");
+    }
+}
+
+template<class T>
+void
+matrix_file<T>::check_block(size_type i0, size_type j0, size_type nr, size_type nc) const
+{
+    if (i0 > m_rows  ||  nr > m_rows - i0  ||  j0 > m_cols  ||  nc > m_cols - j0)
+    {
+        throw runtime_error("invalid size");
+    }
+}
+
+template<class T> inline
+void
+matrix_file<T>::seek(size_type i, size_type j)
+{
+    m_file.seekp(static_cast<streamoff>(data_offset + (i*m_cols + j)*sizeof(T)));
+}
+
+//==================================================================================================
+//  Conversions between matrices and matrix files.
+//==================================================================================================
+//
+template<class T, class ET, class OT>
+void
+write_matrix_file(std::string const& path, matrix<ET, OT> const& m)
+{
+    using size_type = typename matrix<ET, OT>::size_type;
+
+    size_t const        rows = static_cast<size_t>(m.rows());
+    size_t const        cols = static_cast<size_t>(m.columns());
+    auto                mf   = matrix_file<T>::create(path, rows, cols);
+    std::vector<T>      row(cols);
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            row[j] = static_cast<T>(m(static_cast<size_type>(i), static_cast<size_type>(j)));
+        }
+        mf.write_block(i, 0, 1, cols, row.data(), cols);
+    }
+}
+
+template<class T>
+auto
+read_matrix_file(std::string const& path)
+{
+    using engine_type = dr_matrix_engine<T, allocator<T>>;
+
+    auto                    mf = matrix_file<T>::open(path);
+    matrix<engine_type>     mr(mf.rows(), mf.columns());
+    auto&                   eng = mr.engine();
+
+    mf.read_block(0, 0, mf.rows(), mf.columns(), eng.data(), eng.column_capacity());
+    return mr;
+}
+
+//==================================================================================================
+//                              **** OUT-OF-CORE MULTIPLICATION ****
+//==================================================================================================
+//  Computes C = A*B, where C has already been created with the correct extents.  Tiles are
+//  'tile' x 'tile' elements, so memory use is about 6*tile*tile elements.
+//==================================================================================================
+//
+inline constexpr size_t     default_out_of_core_tile = 1024;
+
+template<class T>
+void
+out_of_core_multiply(matrix_file<T>& a, matrix_file<T>& b, matrix_file<T>& c,
+                     size_t tile = default_out_of_core_tile)
+{
+    size_t const    m = a.rows();
+    size_t const    k = a.columns();
+    size_t const    n = b.columns();
+
+    if (b.rows() != k  ||  c.rows() != m  ||  c.columns() != n  ||  tile == 0)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_t const    tk = (k + tile - 1) / tile;
+
+    //- One step is the product of tile (ti, kk) of A with tile (kk, tj) of B; steps are numbered
+    //  in the order ti, tj, kk, so that consecutive steps within a tile of C share its buffer.
+    //
+    struct buffers
+    {
+        std::vector<T>  a, b;
+    };
+
+    buffers         in[2];
+    std::vector<T>  out[2];
+
+    for (size_t s = 0;  s < 2;  ++s)
+    {
+        in[s].a.resize(tile*tile);
+        in[s].b.resize(tile*tile);
+        out[s].resize(tile*tile);
+    }
+
+    size_t const    tn    = (n + tile - 1) / tile;
+    size_t const    steps = ((m + tile - 1) / tile) * tn * tk;
+
+    auto    load = [&](size_t step, buffers& buf)
+                   {
+                       size_t const    kk = step % tk;
+                       size_t const    tj = (step / tk) % tn;
+                       size_t const    ti = step / (tk * tn);
+                       size_t const    mb = min(tile, m - ti*tile);
+                       size_t const    kb = min(tile, k - kk*tile);
+                       size_t const    nb = min(tile, n - tj*tile);
+
+                       a.read_block(ti*tile, kk*tile, mb, kb, buf.a.data(), kb);
+                       b.read_block(kk*tile, tj*tile, kb, nb, buf.b.data(), nb);
+                   };
+
+    std::future<void>   reader;
+    std::future<void>   writer;
+    size_t              ctile = 0;
+
+    load(0, in[0]);
+
+    for (size_t step = 0;  step < steps;  ++step)
+    {
+        if (step + 1 < steps)
+        {
+            reader = std::async(std::launch::async, load, step + 1, std::ref(in[(step + 1) % 2]));
+        }
+
+        size_t const        kk = step % tk;
+        size_t const        tj = (step / tk) % tn;
+        size_t const        ti = step / (tk * tn);
+        size_t const        mb = min(tile, m - ti*tile);
+        size_t const        kb = min(tile, k - kk*tile);
+        size_t const        nb = min(tile, n - tj*tile);
+        buffers const&      cur = in[step % 2];
+        std::vector<T>&     acc = out[ctile % 2];
+
+        if (kk == 0)
+        {
+            fill_n(acc.data(), mb*nb, T{});
+        }
+        detail::gemm_kernel(mb, nb, kb, cur.a.data(), kb, cur.b.data(), nb, acc.data(), nb);
+
+        //- The tile of C is complete; write it while the next one is computed.  The previous
+        //  write used the other buffer, and must finish before that buffer is reused.
+        //
+        if (kk + 1 == tk)
+        {
+            if (writer.valid())
+            {
+                writer.get();
+            }
+            writer = std::async(std::launch::async,
+                                [&c, &acc, ti, tj, mb, nb, tile]()
+                                { c.write_block(ti*tile, tj*tile, mb, nb, acc.data(), nb); });
+            ++ctile;
+        }
+        if (reader.valid())
+        {
+            reader.get();
+        }
+    }
+    if (writer.valid())
+    {
+        writer.get();
+    }
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_OUT_OF_CORE_HPP_DEFINED
@@ -0,0 +1,756 @@
+//==================================================================================================
+//  File:       permutation_engine.hpp
+//
+//  Summary:    This header defines a read-only matrix engine that represents an N x N permutation
+//              matrix by an index vector, P(i, j) = (j == idx[i]), so that row i of P*A is row
+//              idx[i] of A.  Products of a permutation matrix with vectors and matrices move whole
+//              elements or rows rather than multiplying, and the product of two permutations is
+//              again a permutation.
+//
+//              It also defines functions that permute the rows or columns of a matrix, or the
+//              elements of a vector, in place, by following the cycles of the permutation; each
+//              element is moved once, and at most one row of temporary storage is required.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_PERMUTATION_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_PERMUTATION_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Cycle decomposition.  The non-trivial cycles of idx are stored consecutively in 'cycles', each
+//  in the order c0, idx[c0], idx[idx[c0]], ..., with cycle k occupying [bounds[k], bounds[k+1]).
+//==================================================================================================
+//
+template<class IT>
+void
+permutation_cycles(IT const& idx, std::vector<size_t>& cycles, std::vector<size_t>& bounds)
+{
+    size_t const        n = idx.size();
+    std::vector<bool>   seen(n, false);
+
+    cycles.clear();
+    bounds.assign(1, 0);
+
+    for (size_t s = 0;  s < n;  ++s)
+    {
+        if (seen[s]  ||  idx[s] == s)
+        {
+            seen[s] = true;
+            continue;
+        }
+        for (size_t k = s;  !seen[k];  k = idx[k])
+        {
+            seen[k] = true;
+            cycles.push_back(k);
+        }
+        bounds.push_back(cycles.size());
+    }
+}
+
+//- Moves elements along the cycles computed by permutation_cycles().  In gather form the element
+//  at position idx[k] moves to position k; in scatter form the element at position k moves to
+//  position idx[k].  The callable 'save' copies an element to temporary storage, 'move' copies the
+//  element at its second argument to its first, and 'restore' copies the temporary to its argument.
+//
+template<class SAVE, class MOVE, class RESTORE>
+void
+permutation_follow(std::vector<size_t> const& cycles, std::vector<size_t> const& bounds,
+                   bool scatter, SAVE const& save, MOVE const& move, RESTORE const& restore)
+{
+    for (size_t c = 0;  c + 1 < bounds.size();  ++c)
+    {
+        size_t const    b = bounds[c];
+        size_t const    e = bounds[c + 1];
+
+        if (scatter)
+        {
+            save(cycles[e - 1]);
+            for (size_t t = e - 1;  t > b;  --t)
+            {
+                move(cycles[t], cycles[t - 1]);
+            }
+            restore(cycles[b]);
+        }
+        else
+        {
+            save(cycles[b]);
+            for (size_t t = b;  t + 1 < e;  ++t)
+            {
+                move(cycles[t], cycles[t + 1]);
+            }
+            restore(cycles[e - 1]);
+        }
+    }
+}
+
+}       //- detail namespace
+//==================================================================================================
+//  Permutation engine.
+//==================================================================================================
+//
+template<class T, class AT>
+class permutation_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using allocator_type  = AT;
+    using pointer         = element_type const*;
+    using const_pointer   = element_type const*;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    using index_type      = std::vector<size_type, detail::rebind_alloc_t<AT, size_type>>;
+
+    //- Construct/copy/destroy
+    //
+    ~permutation_engine() noexcept = default;
+
+    permutation_engine() = default;
+    permutation_engine(permutation_engine&&) noexcept = default;
+    permutation_engine(permutation_engine const&) = default;
+    explicit permutation_engine(size_type n);
+    explicit permutation_engine(index_type indices);
+
+    permutation_engine&     operator =(permutation_engine&&) noexcept = default;
+    permutation_engine&     operator =(permutation_engine const&) = default;
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    //- Element access
+    //
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    //- Index access
+    //
+    index_type const&   indices() const noexcept;
+    permutation_engine  inverse() const;
+
+    //- Modifiers
+    //
+    void    swap(permutation_engine& rhs) noexcept;
+
+  private:
+    index_type  m_idx;
+};
+
+//- Constructs the identity permutation of order n.
+//
+template<class T, class AT>
+permutation_engine<T,AT>::permutation_engine(size_type n)
+:   m_idx(n)
+{
+    iota(m_idx.begin(), m_idx.end(), size_type(0));
+}
+
+template<class T, class AT>
+permutation_engine<T,AT>::permutation_engine(index_type indices)
+:   m_idx(std::move(indices))
+{
+    std::vector<bool>   seen(m_idx.size(), false);
+
+    for (size_type k : m_idx)
+    {
+        if (k >= m_idx.size()  ||  seen[k])
+        {
+            throw runtime_error("invalid permutation");
+        }
+        seen[k] = true;
+    }
+}
+
+template<class T, class AT> inline
+typename permutation_engine<T,AT>::size_type
+permutation_engine<T,AT>::columns() const noexcept
+{
+    return m_idx.size();
+}
+
+template<class T, class AT> inline
+typename permutation_engine<T,AT>::size_type
+permutation_engine<T,AT>::rows() const noexcept
+{
+    return m_idx.size();
+}
+
+template<class T, class AT> inline
+typename permutation_engine<T,AT>::size_tuple
+permutation_engine<T,AT>::size() const noexcept
+{
+    return size_tuple(m_idx.size(), m_idx.size());
+}
+
+template<class T, class AT> inline
+typename permutation_engine<T,AT>::size_type
+permutation_engine<T,AT>::column_capacity() const noexcept
+{
+    return m_idx.size();
+}
+
+template<class T, class AT> inline
+typename permutation_engine<T,AT>::size_type
+permutation_engine<T,AT>::row_capacity() const noexcept
+{
+    return m_idx.size();
+}
+
+template<class T, class AT> inline
+typename permutation_engine<T,AT>::size_tuple
+permutation_engine<T,AT>::capacity() const noexcept
+{
+    return size_tuple(m_idx.size(), m_idx.size());
+}
+
+template<class T, class AT> inline
+typename permutation_engine<T,AT>::const_reference
+permutation_engine<T,AT>::operator ()(size_type i, size_type j) const
+{
+    return (m_idx[i] == j) ? value_type(1) : value_type(0);
+}
+
+template<class T, class AT> inline
+typename permutation_engine<T,AT>::index_type const&
+permutation_engine<T,AT>::indices() const noexcept
+{
+    return m_idx;
+}
+
+//- The inverse of a permutation matrix is its transpose.
+//
+template<class T, class AT>
+permutation_engine<T,AT>
+permutation_engine<T,AT>::inverse() const
+{
+    permutation_engine  inv;
+
+    inv.m_idx.resize(m_idx.size());
+
+    for (size_type i = 0;  i < m_idx.size();  ++i)
+    {
+        inv.m_idx[m_idx[i]] = i;
+    }
+    return inv;
+}
+
+template<class T, class AT> inline
+void
+permutation_engine<T,AT>::swap(permutation_engine& rhs) noexcept
+{
+    m_idx.swap(rhs.m_idx);
+}
+
+//==================================================================================================
+//                                  **** PERMUTATION MATRICES ****
+//==================================================================================================
+//  permutation_matrix() returns the permutation matrix P for which row i of P*A is row idx(i) of
+//  A.  pivot_permutation() returns the permutation matrix P that applies the row interchanges
+//  i <-> piv(i), for i = 0, 1, ..., in order, as recorded by a partially-pivoted factorization.
+//  The operation traits are those of the argument; the element type may be specified.
+//==================================================================================================
+//
+template<class T = int, class ET1, class OT1>
+auto
+permutation_matrix(vector<ET1, OT1> const& idx)
+{
+    using engine_type = permutation_engine<T, allocator<T>>;
+    using index_type  = typename engine_type::index_type;
+
+    size_t const    n = static_cast<size_t>(idx.elements());
+    index_type      indices(n);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        indices[i] = static_cast<size_t>(idx(static_cast<typename ET1::size_type>(i)));
+    }
+
+    matrix<engine_type, OT1>    mr;
+
+    mr.engine() = engine_type(std::move(indices));
+    return mr;
+}
+
+template<class T = int, class ET1, class OT1>
+auto
+pivot_permutation(vector<ET1, OT1> const& piv)
+{
+    using engine_type = permutation_engine<T, allocator<T>>;
+    using index_type  = typename engine_type::index_type;
+
+    size_t const    n = static_cast<size_t>(piv.elements());
+    index_type      indices(n);
+
+    iota(indices.begin(), indices.end(), size_t(0));
+
+    for (size_t k = 0;  k < n;  ++k)
+    {
+        size_t const    p = static_cast<size_t>(piv(static_cast<typename ET1::size_type>(k)));
+
+        if (p >= n)
+        {
+            throw runtime_error("invalid permutation");
+        }
+        detail::la_swap(indices[k], indices[p]);
+    }
+
+    matrix<engine_type, OT1>    mr;
+
+    mr.engine() = engine_type(std::move(indices));
+    return mr;
+}
+
+//==================================================================================================
+//                              **** IN-PLACE PERMUTATION ****
+//==================================================================================================
+//  permute_rows(m, p) replaces m by p*m, permute_columns(m, p) replaces m by m*p, and permute(v, p)
+//  replaces v by p*v.  When m exposes its storage via data(), whole rows are moved through raw
+//  pointers, and a column permutation is applied row by row, so that all accesses stay within
+//  one contiguous row.
+//==================================================================================================
+//
+template<class ET1, class OT1, class T2, class A2, class OT2>
+void
+permute_rows(matrix<ET1, OT1>& m, matrix<permutation_engine<T2, A2>, OT2> const& p)
+{
+    using elem_type = typename ET1::value_type;
+    using size_type = typename matrix<ET1, OT1>::size_type;
+
+    size_t const    rows = static_cast<size_t>(m.rows());
+    size_t const    cols = static_cast<size_t>(m.columns());
+
+    if (static_cast<size_t>(p.rows()) != rows)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    std::vector<size_t>     cycles, bounds;
+    std::vector<elem_type>  buf(cols);
+
+    detail::permutation_cycles(p.engine().indices(), cycles, bounds);
+
+    if constexpr (detail::has_data_v<ET1>)
+    {
+        detail::permutation_follow(cycles, bounds, false,
+            [&](size_t r)
+            {
+                auto    p_r = detail::row_data(m, r);
+                std::copy(p_r, p_r + cols, buf.data());
+            },
+            [&](size_t r1, size_t r2)
+            {
+                auto    p_r2 = detail::row_data(m, r2);
+                std::copy(p_r2, p_r2 + cols, detail::row_data(m, r1));
+            },
+            [&](size_t r)
+            {
+                std::copy(buf.data(), buf.data() + cols, detail::row_data(m, r));
+            });
+    }
+    else
+    {
+        auto    at = [&m](size_t i, size_t j) -> decltype(auto)
+                     { return m(static_cast<size_type>(i), static_cast<size_type>(j)); };
+
+        detail::permutation_follow(cycles, bounds, false,
+            [&](size_t r)
+            {
+                for (size_t j = 0;  j < cols;  ++j)
+                {
+                    buf[j] = at(r, j);
+                }
+            },
+            [&](size_t r1, size_t r2)
+            {
+                for (size_t j = 0;  j < cols;  ++j)
+                {
+                    at(r1, j) = at(r2, j);
+                }
+            },
+            [&](size_t r)
+            {
+                for (size_t j = 0;  j < cols;  ++j)
+                {
+                    at(r, j) = buf[j];
+                }
+            });
+    }
+}
+
+//- Column j of m*p is column k of m, where idx[k] = j; that is, column k moves to column idx[k].
+//
+template<class ET1, class OT1, class T2, class A2, class OT2>
+void
+permute_columns(matrix<ET1, OT1>& m, matrix<permutation_engine<T2, A2>, OT2> const& p)
+{
+    using elem_type = typename ET1::value_type;
+    using size_type = typename matrix<ET1, OT1>::size_type;
+
+    size_t const    rows = static_cast<size_t>(m.rows());
+    size_t const    cols = static_cast<size_t>(m.columns());
+
+    if (static_cast<size_t>(p.rows()) != cols)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    std::vector<size_t>     cycles, bounds;
+    elem_type               tmp;
+
+    detail::permutation_cycles(p.engine().indices(), cycles, bounds);
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        if constexpr (detail::has_data_v<ET1>)
+        {
+            auto    p_row = detail::row_data(m, i);
+
+            detail::permutation_follow(cycles, bounds, true,
+                [&](size_t k)             { tmp = p_row[k]; },
+                [&](size_t k1, size_t k2) { p_row[k1] = p_row[k2]; },
+                [&](size_t k)             { p_row[k] = tmp; });
+        }
+        else
+        {
+            size_type const     ii = static_cast<size_type>(i);
+
+            detail::permutation_follow(cycles, bounds, true,
+                [&](size_t k)             { tmp = m(ii, static_cast<size_type>(k)); },
+                [&](size_t k1, size_t k2) { m(ii, static_cast<size_type>(k1)) =
+                                                m(ii, static_cast<size_type>(k2)); },
+                [&](size_t k)             { m(ii, static_cast<size_type>(k)) = tmp; });
+        }
+    }
+}
+
+template<class ET1, class OT1, class T2, class A2, class OT2>
+void
+permute(vector<ET1, OT1>& v, matrix<permutation_engine<T2, A2>, OT2> const& p)
+{
+    using elem_type = typename ET1::value_type;
+    using size_type = typename vector<ET1, OT1>::size_type;
+
+    if (static_cast<size_t>(p.rows()) != static_cast<size_t>(v.elements()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    std::vector<size_t>     cycles, bounds;
+    elem_type               tmp;
+
+    detail::permutation_cycles(p.engine().indices(), cycles, bounds);
+    detail::permutation_follow(cycles, bounds, false,
+        [&](size_t k)             { tmp = v(static_cast<size_type>(k)); },
+        [&](size_t k1, size_t k2) { v(static_cast<size_type>(k1)) = v(static_cast<size_type>(k2)); },
+        [&](size_t k)             { v(static_cast<size_type>(k)) = tmp; });
+}
+
+//==================================================================================================
+//                          **** PERMUTATION MULTIPLICATION TRAITS ****
+//==================================================================================================
+//  Engine promotion:  the product of two permutations is a permutation.  Products involving
+//  the transpose of a permutation are computed by the default traits, and so are dense.
+//==================================================================================================
+//
+template<class OT, class T1, class A1, class T2, class A2>
+struct matrix_multiplication_engine_traits<OT, permutation_engine<T1, A1>, permutation_engine<T2, A2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = permutation_engine<element_type, alloc_type>;
+};
+
+template<class OT, class T1, class A1, class T2, class A2, class MCT2>
+struct matrix_multiplication_engine_traits<OT, permutation_engine<T1, A1>,
+                                               transpose_engine<permutation_engine<T2, A2>, MCT2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+};
+
+template<class OT, class T1, class A1, class MCT1, class T2, class A2>
+struct matrix_multiplication_engine_traits<OT, transpose_engine<permutation_engine<T1, A1>, MCT1>,
+                                               permutation_engine<T2, A2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+};
+
+template<class OT, class T1, class A1, class MCT1, class T2, class A2, class MCT2>
+struct matrix_multiplication_engine_traits<OT, transpose_engine<permutation_engine<T1, A1>, MCT1>,
+                                               transpose_engine<permutation_engine<T2, A2>, MCT2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+};
+
+//--------------------------------------------------------------------------------------------------
+//  Arithmetic.
+//--------------------------------------------------------------------------------------------------
+//
+//- permutation*vector:  y(i) = x(idx[i]).
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<permutation_engine<T1, A1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, permutation_engine<T1, A1>, ET2>;
+    using op_traits    = OT;
+    using result_type  = vector<engine_type, op_traits>;
+
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type
+    multiply(matrix<permutation_engine<T1, A1>, OT1> const& m1, vector<ET2, OT2> const& v2)
+    {
+        PrintOperandTypes<result_type>("multiplication_traits (perm*v)", m1, v2);
+
+        auto const&     idx = m1.engine().indices();
+        size_t const    n   = idx.size();
+
+        if (static_cast<size_t>(v2.elements()) != n)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        result_type     vr;
+
+        if constexpr (result_requires_resize(vr))
+        {
+            vr.resize(static_cast<size_type_r>(n));
+        }
+        for (size_t i = 0;  i < n;  ++i)
+        {
+            vr(static_cast<size_type_r>(i)) = v2(static_cast<size_type_2>(idx[i]));
+        }
+        return vr;
+    }
+};
+
+//- vector*permutation:  y(idx[k]) = x(k).
+//
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+struct matrix_multiplication_traits<OT, vector<ET1, OT1>, matrix<permutation_engine<T2, A2>, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, ET1, permutation_engine<T2, A2>>;
+    using op_traits    = OT;
+    using result_type  = vector<engine_type, op_traits>;
+
+    using size_type_1 = typename vector<ET1, OT1>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type
+    multiply(vector<ET1, OT1> const& v1, matrix<permutation_engine<T2, A2>, OT2> const& m2)
+    {
+        PrintOperandTypes<result_type>("multiplication_traits (v*perm)", v1, m2);
+
+        auto const&     idx = m2.engine().indices();
+        size_t const    n   = idx.size();
+
+        if (static_cast<size_t>(v1.elements()) != n)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        result_type     vr;
+
+        if constexpr (result_requires_resize(vr))
+        {
+            vr.resize(static_cast<size_type_r>(n));
+        }
+        for (size_t k = 0;  k < n;  ++k)
+        {
+            vr(static_cast<size_type_r>(idx[k])) = v1(static_cast<size_type_1>(k));
+        }
+        return vr;
+    }
+};
+
+//- Products with other matrices go through detail::matrix_product_traits (see
+//  multiplication_traits.hpp).  Permuting is only copying, so permutations take precedence over
+//  every other structured engine.
+//
+namespace detail {
+
+template<class T, class A>
+struct structured_multiplication_priority<permutation_engine<T, A>>
+:   public integral_constant<int, 4>
+{};
+
+//- permutation*matrix:  row i of the result is row idx[i] of the operand.
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_product_traits<OT, matrix<permutation_engine<T1, A1>, OT1>, matrix<ET2, OT2>,
+                             structured_side::left>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, permutation_engine<T1, A1>, ET2>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    using size_type_2 = typename matrix<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type
+    multiply(matrix<permutation_engine<T1, A1>, OT1> const& m1, matrix<ET2, OT2> const& m2)
+    {
+        PrintOperandTypes<result_type>("multiplication_traits (perm*m)", m1, m2);
+
+        auto const&     idx  = m1.engine().indices();
+        size_t const    rows = idx.size();
+        size_t const    cols = static_cast<size_t>(m2.columns());
+
+        if (static_cast<size_t>(m2.rows()) != rows)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        result_type     mr;
+
+        if constexpr (result_requires_resize(mr))
+        {
+            mr.resize(static_cast<size_type_r>(rows), static_cast<size_type_r>(cols));
+        }
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            if constexpr (detail::has_data_v<engine_type>  &&  detail::has_data_v<ET2>)
+            {
+                auto    p_src = detail::row_data(m2, idx[i]);
+
+                std::copy(p_src, p_src + cols, detail::row_data(mr, i));
+            }
+            else
+            {
+                size_type_2 const   i2 = static_cast<size_type_2>(idx[i]);
+
+                for (size_t j = 0;  j < cols;  ++j)
+                {
+                    mr(static_cast<size_type_r>(i), static_cast<size_type_r>(j)) =
+                        m2(i2, static_cast<size_type_2>(j));
+                }
+            }
+        }
+        return mr;
+    }
+};
+
+//- matrix*permutation:  column k of the operand becomes column idx[k] of the result; each row
+//  is scattered in turn.
+//
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+struct matrix_product_traits<OT, matrix<ET1, OT1>, matrix<permutation_engine<T2, A2>, OT2>,
+                             structured_side::right>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, ET1, permutation_engine<T2, A2>>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<ET1, OT1>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type
+    multiply(matrix<ET1, OT1> const& m1, matrix<permutation_engine<T2, A2>, OT2> const& m2)
+    {
+        PrintOperandTypes<result_type>("multiplication_traits (m*perm)", m1, m2);
+
+        auto const&     idx  = m2.engine().indices();
+        size_t const    rows = static_cast<size_t>(m1.rows());
+        size_t const    cols = idx.size();
+
+        if (static_cast<size_t>(m1.columns()) != cols)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        result_type     mr;
+
+        if constexpr (result_requires_resize(mr))
+        {
+            mr.resize(static_cast<size_type_r>(rows), static_cast<size_type_r>(cols));
+        }
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            if constexpr (detail::has_data_v<engine_type>  &&  detail::has_data_v<ET1>)
+            {
+                auto    p_src = detail::row_data(m1, i);
+                auto    p_dst = detail::row_data(mr, i);
+
+                for (size_t k = 0;  k < cols;  ++k)
+                {
+                    p_dst[idx[k]] = p_src[k];
+                }
+            }
+            else
+            {
+                size_type_1 const   i1 = static_cast<size_type_1>(i);
+                size_type_r const   ir = static_cast<size_type_r>(i);
+
+                for (size_t k = 0;  k < cols;  ++k)
+                {
+                    mr(ir, static_cast<size_type_r>(idx[k])) = m1(i1, static_cast<size_type_1>(k));
+                }
+            }
+        }
+        return mr;
+    }
+};
+
+//- permutation*permutation:  row i of the product is row idx1[i] of the right-hand operand,
+//  whose non-zero element lies in column idx2[idx1[i]].
+//
+template<class OT, class T1, class A1, class OT1, class T2, class A2, class OT2>
+struct matrix_product_traits<OT, matrix<permutation_engine<T1, A1>, OT1>,
+                                 matrix<permutation_engine<T2, A2>, OT2>, structured_side::left>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, permutation_engine<T1, A1>,
+                                                            permutation_engine<T2, A2>>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    static result_type
+    multiply(matrix<permutation_engine<T1, A1>, OT1> const& m1,
+             matrix<permutation_engine<T2, A2>, OT2> const& m2)
+    {
+        PrintOperandTypes<result_type>("multiplication_traits (perm*perm)", m1, m2);
+
+        auto const&     idx1 = m1.engine().indices();
+        auto const&     idx2 = m2.engine().indices();
+        size_t const    n    = idx1.size();
+
+        if (idx2.size() != n)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        typename engine_type::index_type    idx(n);
+
+        for (size_t i = 0;  i < n;  ++i)
+        {
+            idx[i] = idx2[idx1[i]];
+        }
+
+        result_type     mr;
+
+        mr.engine() = engine_type(std::move(idx));
+        return mr;
+    }
+};
+
+}       //- detail namespace
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_PERMUTATION_ENGINE_HPP_DEFINED
@@ -237,6 +237,48 @@ struct noe_tag_chooser<resizable_matrix_engine_tag, writable_vector_engine_tag>
     using tag_type = writable_vector_engine_tag;
 };
 
+//------
+//
+template<>
+struct noe_tag_chooser<readable_vector_engine_tag, readable_vector_engine_tag>
+{
+    using tag_type = readable_vector_engine_tag;
+};
+
+template<>
+struct noe_tag_chooser<readable_vector_engine_tag, writable_vector_engine_tag>
+{
+    using tag_type = readable_vector_engine_tag;
+};
+
+//------
+//
+template<>
+struct noe_tag_chooser<writable_vector_engine_tag, readable_vector_engine_tag>
+{
+    using tag_type = readable_vector_engine_tag;
+};
+
+template<>
+struct noe_tag_chooser<writable_vector_engine_tag, writable_vector_engine_tag>
+{
+    using tag_type = writable_vector_engine_tag;
+};
+
+//------
+//
+template<>
+struct noe_tag_chooser<resizable_vector_engine_tag, readable_vector_engine_tag>
+{
+    using tag_type = readable_vector_engine_tag;
+};
+
+template<>
+struct noe_tag_chooser<resizable_vector_engine_tag, writable_vector_engine_tag>
+{
+    using tag_type = writable_vector_engine_tag;
+};
+
 //- Variable template used as a convenience interface to noe_tag_chooser.
 //
 template<class ET, class VTT>
@@ -300,30 +342,102 @@ struct has_iteration<T, std::void_t<decltype(std::declval<T>().begin()),
 template<class ET> inline constexpr
 bool    has_iteration_v = has_iteration<ET>::value;
 
-//------
+//- Detection trait and convenience alias template for determining whether an engine exposes its
+//  contiguous, row-major element storage via data().  Matrix engines having it store row i at
+//  data() + i*column_capacity().
 //
-template<bool HasIter, class ET> 
+template<typename T, typename = void>
+struct has_data 
+:   std::false_type 
+{};
+
+template<typename T>
+struct has_data<T, std::void_t<decltype(std::declval<T&>().data())>>
+:   std::true_type 
+{};
+
+template<class ET> inline constexpr
+bool    has_data_v = has_data<ET>::value;
+
+//- Detection traits for determining whether a matrix engine describes its storage by row and
+//  column strides, or a vector engine by a stride, via row_stride()/column_stride() or stride().
+//
+template<class ET, class = void>
+struct has_strides
+:   std::false_type
+{};
+
+template<class ET>
+struct has_strides<ET, std::void_t<decltype(std::declval<ET const&>().row_stride()),
+                                   decltype(std::declval<ET const&>().column_stride())>>
+:   std::true_type
+{};
+
+template<class ET> inline constexpr
+bool    has_strides_v = has_strides<ET>::value;
+
+template<class ET, class = void>
+struct has_stride
+:   std::false_type
+{};
+
+template<class ET>
+struct has_stride<ET, std::void_t<decltype(std::declval<ET const&>().stride())>>
+:   std::true_type
+{};
+
+template<class ET> inline constexpr
+bool    has_stride_v = has_stride<ET>::value;
+
+//- Trait for determining whether a matrix engine is a transpose view of an engine that has data(),
+//  whose elements can therefore be copied with the blocked transpose kernel.
+//
+template<class ET>
+struct is_dense_transpose
+:   std::false_type
+{};
+
+template<class ET, class MCT>
+struct is_dense_transpose<transpose_engine<ET, MCT>>
+:   std::bool_constant<has_data_v<ET>>
+{};
+
+template<class ET> inline constexpr
+bool    is_dense_transpose_v = is_dense_transpose<ET>::value;
+
+//- Traits type that chooses a vector's iterator types:  raw pointers if the engine exposes
+//  contiguous storage via data(), else the engine's own iterators, if any, else the generic
+//  index-based iterators.
+//
+template<bool HasData, bool HasIter, class ET> 
 struct get_engine_iter;
 
+template<bool HasIter, class ET>
+struct get_engine_iter<true, HasIter, ET>
+{
+    using m_iter_type = typename ET::pointer;
+    using c_iter_type = typename ET::const_pointer;
+};
+
 template<class ET>
-struct get_engine_iter<true, ET>
+struct get_engine_iter<false, true, ET>
 {
     using m_iter_type = typename ET::iterator;
     using c_iter_type = typename ET::const_iterator;
 };
 
 template<class ET>
-struct get_engine_iter<false, ET>
+struct get_engine_iter<false, false, ET>
 {
     using m_iter_type = noe_iterator_t<ET, typename ET::engine_category, ET>;
     using c_iter_type = vector_const_iterator<ET>;
 };
 
-template<bool HasIter, class ET>
-using engine_m_iter_t = typename get_engine_iter<HasIter, ET>::m_iter_type;
+template<bool HasData, bool HasIter, class ET>
+using engine_m_iter_t = typename get_engine_iter<HasData, HasIter, ET>::m_iter_type;
 
-template<bool HasIter, class ET>
-using engine_c_iter_t = typename get_engine_iter<HasIter, ET>::c_iter_type;
+template<bool HasData, bool HasIter, class ET>
+using engine_c_iter_t = typename get_engine_iter<HasData, HasIter, ET>::c_iter_type;
 
 
 //==================================================================================================
@@ -360,8 +474,25 @@ struct non_void_traits_chooser<void, void, DEF>
 //  vector and matrix engines defined elsewhere.  Note that all memory thus allocated is default-
 //  constructed.  This means that elements lying in (currently) unused capacity are also
 //  initialized, which may or may not be what happens in the final version.
+//
+//  An allocator that places memory by first touch (e.g., numa_allocator) may take over element
+//  initialization by providing a member function first_touch(p, n, p_src), which value-
+//  initializes (if p_src is null) or copies n elements at p.
 //==================================================================================================
 //
+template<class AT, class = void>
+struct has_first_touch : false_type {};
+
+template<class AT>
+struct has_first_touch<AT, void_t<decltype(declval<AT&>().first_touch(
+                                    declval<typename allocator_traits<AT>::pointer>(), size_t(),
+                                    declval<typename allocator_traits<AT>::const_pointer>()))>>
+:   true_type
+{};
+
+template<class AT> inline constexpr
+bool    has_first_touch_v = has_first_touch<AT>::value;
+
 template<class AT>
 typename allocator_traits<AT>::pointer
 allocate(AT& alloc, size_t n)
@@ -370,7 +501,10 @@ allocate(AT& alloc, size_t n)
 
     try
     {
-        uninitialized_value_construct_n(p_dst, n);
+        if constexpr (has_first_touch_v<AT>)
+            alloc.first_touch(p_dst, n, nullptr);
+        else
+            uninitialized_value_construct_n(p_dst, n);
     }
     catch (...)
     {
@@ -388,7 +522,10 @@ allocate(AT& alloc, size_t n, typename allocator_traits<AT>::const_pointer p_src
 
     try
     {
-        uninitialized_copy_n(p_src, n, p_dst);
+        if constexpr (has_first_touch_v<AT>)
+            alloc.first_touch(p_dst, n, p_src);
+        else
+            uninitialized_copy_n(p_src, n, p_dst);
     }
     catch (...)
     {
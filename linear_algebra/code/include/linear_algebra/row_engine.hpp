@@ -66,6 +66,11 @@ class row_engine
     //
     constexpr reference     operator ()(size_type i) const;
 
+    //- Data access; rows of engines having data() are contiguous.
+    //
+    template<class ET2 = ET, enable_if_t<detail::has_data_v<ET2>, bool> = true>
+    constexpr pointer       data() const noexcept;
+
     //- Modifiers
     //
     constexpr void      swap(row_engine& rhs);
@@ -149,6 +154,17 @@ row_engine<ET, VCT>::operator ()(size_type j) const
     return (*mp_other)(m_row, j);
 }
 
+//-------------
+//- Data access
+//
+template<class ET, class VCT>
+template<class ET2, enable_if_t<detail::has_data_v<ET2>, bool>> constexpr 
+typename row_engine<ET, VCT>::pointer
+row_engine<ET, VCT>::data() const noexcept
+{
+    return mp_other->data() + m_row*mp_other->column_capacity();
+}
+
 //-----------
 //- Modifiers
 //
@@ -0,0 +1,285 @@
+//==================================================================================================
+//  File:       scatter_accumulator.hpp
+//
+//  Summary:    This header defines an accumulator through which many threads can add small
+//              contributions into one shared matrix, as in finite-element or histogram assembly,
+//              without serializing on a single lock.  Each thread adds through its own slot:
+//
+//                - privatized:  each slot accumulates into private (tile_size x tile_size) tiles,
+//                  allocated on first use, so that only the parts of the target a slot touches
+//                  cost memory; merge() then adds the tiles into the target in parallel, with
+//                  each thread responsible for a disjoint set of target tiles.
+//
+//                - locked:  contributions go straight into the target under one of a set of
+//                  mutexes striped by tile, so that only threads adding into the same tiles
+//                  contend; merge() has nothing to do.
+//
+//              Privatization suits contributions that are dense within the region a thread
+//              works on; striped locking suits sparse, scattered ones, or targets too large to
+//              privatize.  A slot must be used by only one thread at a time, and the target must
+//              not be resized or otherwise accessed until merge() returns.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SCATTER_ACCUMULATOR_HPP_DEFINED
+#define LINEAR_ALGEBRA_SCATTER_ACCUMULATOR_HPP_DEFINED
+
+#include <memory>
+#include <mutex>
+
+namespace STD_LA {
+
+enum class accumulation_mode
+{
+    privatized,
+    locked
+};
+
+template<class ET, class OT>
+class scatter_accumulator
+{
+    static_assert(is_writable_engine_v<ET>);
+
+  public:
+    using matrix_type = matrix<ET, OT>;
+    using value_type  = typename ET::value_type;
+    using size_type   = size_t;
+
+    static constexpr size_type  tile_size   = 64;
+    static constexpr size_type  max_stripes = 1024;
+
+    //- Merges of fewer privatized elements than this are done by the calling thread.
+    //
+    static constexpr size_type  parallel_threshold = size_type(1) << 18;
+
+    scatter_accumulator(matrix<ET, OT>& target, size_type slots,
+                        accumulation_mode mode = accumulation_mode::privatized);
+    scatter_accumulator(scatter_accumulator const&) = delete;
+    scatter_accumulator&    operator =(scatter_accumulator const&) = delete;
+
+    accumulation_mode   mode() const noexcept;
+    size_type           slots() const noexcept;
+
+    void    add(size_type slot, size_type i, size_type j, value_type const& v);
+    template<class IV, class JV, class MT>
+    void    add_block(size_type slot, IV const& rows, JV const& cols, MT const& block);
+
+    void    merge();
+
+  private:
+    using tile_pointer = std::unique_ptr<value_type[]>;
+
+    matrix_type*                            mp_target;
+    accumulation_mode                       m_mode;
+    size_type                               m_rows;
+    size_type                               m_cols;
+    size_type                               m_tile_cols;
+    size_type                               m_tiles;
+    std::vector<std::vector<tile_pointer>>  m_slot_tiles;
+    std::unique_ptr<std::mutex[]>           mp_stripes;
+    size_type                               m_stripes;
+
+    size_type   tile_index(size_type i, size_type j) const noexcept;
+    void        merge_tile(size_type t);
+};
+
+template<class ET, class OT>
+scatter_accumulator<ET, OT>::scatter_accumulator
+(matrix<ET, OT>& target, size_type slots, accumulation_mode mode)
+:   mp_target(&target)
+,   m_mode(mode)
+,   m_rows(static_cast<size_type>(target.rows()))
+,   m_cols(static_cast<size_type>(target.columns()))
+,   m_tile_cols((m_cols + tile_size - 1) / tile_size)
+,   m_tiles(((m_rows + tile_size - 1) / tile_size) * m_tile_cols)
+,   m_slot_tiles()
+,   mp_stripes()
+,   m_stripes(0)
+{
+    if (slots == 0)
+    {
+        throw runtime_error("invalid slot count");
+    }
+    if (mode == accumulation_mode::privatized)
+    {
+        m_slot_tiles.resize(slots);
+
+        for (auto& tiles : m_slot_tiles)
+        {
+            tiles.resize(m_tiles);
+        }
+    }
+    else
+    {
+        m_stripes  = max(size_type(1), min(m_tiles, max_stripes));
+        mp_stripes = std::make_unique<std::mutex[]>(m_stripes);
+        m_slot_tiles.resize(slots);
+    }
+}
+
+template<class ET, class OT> inline
+accumulation_mode
+scatter_accumulator<ET, OT>::mode() const noexcept
+{
+    return m_mode;
+}
+
+template<class ET, class OT> inline
+typename scatter_accumulator<ET, OT>::size_type
+scatter_accumulator<ET, OT>::slots() const noexcept
+{
+    return m_slot_tiles.size();
+}
+
+template<class ET, class OT>
+void
+scatter_accumulator<ET, OT>::add(size_type slot, size_type i, size_type j, value_type const& v)
+{
+    using target_size_type = typename matrix_type::size_type;
+
+    if (slot >= m_slot_tiles.size()  ||  i >= m_rows  ||  j >= m_cols)
+    {
+        throw runtime_error("invalid index");
+    }
+
+    size_type const     t = tile_index(i, j);
+
+    if (m_mode == accumulation_mode::locked)
+    {
+        std::lock_guard<std::mutex>     lock(mp_stripes[t % m_stripes]);
+
+        (*mp_target)(static_cast<target_size_type>(i), static_cast<target_size_type>(j)) += v;
+    }
+    else
+    {
+        tile_pointer&   p_tile = m_slot_tiles[slot][t];
+
+        if (!p_tile)
+        {
+            p_tile = std::make_unique<value_type[]>(tile_size*tile_size);
+        }
+        p_tile[(i % tile_size)*tile_size + (j % tile_size)] += v;
+    }
+}
+
+//- Adds block(r, c) at (rows[r], cols[c]), as when assembling an element matrix.
+//
+template<class ET, class OT>
+template<class IV, class JV, class MT>
+void
+scatter_accumulator<ET, OT>::add_block(size_type slot, IV const& rows, JV const& cols, MT const& block)
+{
+    using block_size_type = typename MT::size_type;
+
+    if (static_cast<size_type>(block.rows()) != static_cast<size_type>(rows.size())  ||
+        static_cast<size_type>(block.columns()) != static_cast<size_type>(cols.size()))
+    {
+        throw runtime_error("invalid size");
+    }
+    for (size_type r = 0;  r < static_cast<size_type>(rows.size());  ++r)
+    {
+        for (size_type c = 0;  c < static_cast<size_type>(cols.size());  ++c)
+        {
+            add(slot, static_cast<size_type>(rows[r]), static_cast<size_type>(cols[c]),
+                static_cast<value_type>(block(static_cast<block_size_type>(r),
+                                              static_cast<block_size_type>(c))));
+        }
+    }
+}
+
+//- Adds the privatized tiles into the target and releases them.  Target tiles are dealt to
+//  threads round-robin, so that no two threads write to the same elements.
+//
+template<class ET, class OT>
+void
+scatter_accumulator<ET, OT>::merge()
+{
+    if (m_mode == accumulation_mode::locked  ||  m_tiles == 0)
+    {
+        return;
+    }
+
+    size_type   used = 0;
+
+    for (auto const& tiles : m_slot_tiles)
+    {
+        for (auto const& p_tile : tiles)
+        {
+            used += (p_tile != nullptr);
+        }
+    }
+
+    size_type   nthr = 1;
+
+    if (is_nothrow_copy_assignable_v<value_type>  &&  used*tile_size*tile_size >= parallel_threshold)
+    {
+        nthr = max(size_type(1), min(static_cast<size_type>(std::thread::hardware_concurrency()),
+                                     m_tiles));
+    }
+
+    auto    work = [this, nthr](size_type k)
+                   {
+                       for (size_type t = k;  t < m_tiles;  t += nthr)
+                       {
+                           merge_tile(t);
+                       }
+                   };
+
+    if (nthr > 1)
+    {
+        detail::run_parallel_parts(nthr, work);
+    }
+    else
+    {
+        work(0);
+    }
+}
+
+template<class ET, class OT> inline
+typename scatter_accumulator<ET, OT>::size_type
+scatter_accumulator<ET, OT>::tile_index(size_type i, size_type j) const noexcept
+{
+    return (i / tile_size)*m_tile_cols + (j / tile_size);
+}
+
+template<class ET, class OT>
+void
+scatter_accumulator<ET, OT>::merge_tile(size_type t)
+{
+    using target_size_type = typename matrix_type::size_type;
+
+    size_type const     i0 = (t / m_tile_cols)*tile_size;
+    size_type const     j0 = (t % m_tile_cols)*tile_size;
+    size_type const     ni = min(tile_size, m_rows - i0);
+    size_type const     nj = min(tile_size, m_cols - j0);
+
+    for (auto& tiles : m_slot_tiles)
+    {
+        if (tile_pointer p_tile = std::move(tiles[t]))
+        {
+            if constexpr (detail::has_data_v<ET>)
+            {
+                auto&   eng = mp_target->engine();
+
+                detail::add_kernel(ni, nj, eng.data() + i0*eng.column_capacity() + j0,
+                                   static_cast<size_type>(eng.column_capacity()),
+                                   p_tile.get(), tile_size,
+                                   eng.data() + i0*eng.column_capacity() + j0,
+                                   static_cast<size_type>(eng.column_capacity()));
+            }
+            else
+            {
+                for (size_type i = 0;  i < ni;  ++i)
+                {
+                    for (size_type j = 0;  j < nj;  ++j)
+                    {
+                        (*mp_target)(static_cast<target_size_type>(i0 + i),
+                                     static_cast<target_size_type>(j0 + j)) += p_tile[i*tile_size + j];
+                    }
+                }
+            }
+        }
+    }
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_SCATTER_ACCUMULATOR_HPP_DEFINED
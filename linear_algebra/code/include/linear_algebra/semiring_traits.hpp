@@ -0,0 +1,403 @@
+//==================================================================================================
+//  File:       semiring_traits.hpp
+//
+//  Summary:    This header defines an operation traits type, and its associated multiplication
+//              traits, that compute vector*vector, matrix*vector, vector*matrix, and matrix*matrix
+//              products over a user-selected semiring; i.e., with the "+" and "*" of the inner
+//              product replaced by the semiring's add() and multiply() operations.
+//
+//              Usage (single-source shortest paths, one relaxation step per product):
+//                  using tropical = semiring_operation_traits<min_plus_semiring>;
+//                  matrix<dr_matrix_engine<double, allocator<double>>, tropical>  adj;
+//                  vector<dr_vector_engine<double, allocator<double>>, tropical>  dist;
+//                  dist = adj.t() * dist;
+//
+//              A semiring is a type with static member function templates zero<T>(), add(a, b),
+//              and multiply(a, b), where zero<T>() is the identity of add() and annihilates
+//              multiply().  The product kernels skip elements of the left operand (and of vector
+//              operands) that are equal to zero<T>(), so products involving mostly-empty
+//              adjacency matrices and frontiers do correspondingly less work.
+//
+//              Products with scalars, and the other arithmetic operations, are inherited from the
+//              library's standard traits.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SEMIRING_TRAITS_HPP_DEFINED
+#define LINEAR_ALGEBRA_SEMIRING_TRAITS_HPP_DEFINED
+
+namespace STD_LA {
+//==================================================================================================
+//                                      **** SEMIRINGS ****
+//==================================================================================================
+//- The ordinary arithmetic semiring (+, *).
+//
+struct plus_times_semiring
+{
+    template<class T>
+    static constexpr T  zero()                      { return T(0); }
+
+    template<class T>
+    static constexpr T  add(T a, T b)               { return a + b; }
+
+    template<class T>
+    static constexpr T  multiply(T a, T b)          { return a * b; }
+};
+
+//- The tropical semiring (min, +), used for shortest paths.  Its zero is +infinity, or the
+//  largest representable value for types without an infinity; adding anything to zero yields
+//  zero, so that integer element types do not overflow.
+//
+struct min_plus_semiring
+{
+    template<class T>
+    static constexpr T  zero()
+    {
+        if constexpr (numeric_limits<T>::has_infinity)
+            return numeric_limits<T>::infinity();
+        else
+            return (numeric_limits<T>::max)();
+    }
+
+    template<class T>
+    static constexpr T  add(T a, T b)               { return (b < a) ? b : a; }
+
+    template<class T>
+    static constexpr T  multiply(T a, T b)
+    {
+        return (a == zero<T>()  ||  b == zero<T>()) ? zero<T>() : T(a + b);
+    }
+};
+
+//- The (max, *) semiring over non-negative values, used for most-reliable paths.
+//
+struct max_times_semiring
+{
+    template<class T>
+    static constexpr T  zero()                      { return T(0); }
+
+    template<class T>
+    static constexpr T  add(T a, T b)               { return (a < b) ? b : a; }
+
+    template<class T>
+    static constexpr T  multiply(T a, T b)          { return a * b; }
+};
+
+//- The Boolean semiring (or, and), used for breadth-first search and reachability.
+//
+struct or_and_semiring
+{
+    template<class T>
+    static constexpr T  zero()                      { return T(0); }
+
+    template<class T>
+    static constexpr T  add(T a, T b)               { return T(a  ||  b); }
+
+    template<class T>
+    static constexpr T  multiply(T a, T b)          { return T(a  &&  b); }
+};
+
+//- The (+, min) semiring over non-negative values, used for counting bottleneck-weighted paths.
+//
+struct plus_min_semiring
+{
+    template<class T>
+    static constexpr T  zero()                      { return T(0); }
+
+    template<class T>
+    static constexpr T  add(T a, T b)               { return a + b; }
+
+    template<class T>
+    static constexpr T  multiply(T a, T b)          { return (b < a) ? b : a; }
+};
+
+//==================================================================================================
+//                              **** SEMIRING OPERATION TRAITS ****
+//==================================================================================================
+//  Operation traits type that selects semiring multiplication.  Since semiring operations need
+//  not involve the built-in "*", the element type of a product is the common type of the
+//  operands' element types (so that, e.g., a product of Boolean matrices is Boolean).
+//==================================================================================================
+//
+template<class T1, class T2>
+struct semiring_element_traits
+{
+    using element_type = common_type_t<T1, T2>;
+};
+
+template<class SR>
+struct semiring_operation_traits : public matrix_operation_traits
+{
+    using semiring_type = SR;
+
+    template<class T1, class T2>
+    using element_multiplication_traits = semiring_element_traits<T1, T2>;
+
+    template<class OTR, class OP1, class OP2>
+    using multiplication_traits = semiring_multiplication_traits<OTR, OP1, OP2>;
+};
+
+//==================================================================================================
+//                            **** SEMIRING MULTIPLICATION TRAITS ****
+//==================================================================================================
+//  Products with scalars are handled by the standard multiplication traits.
+//==================================================================================================
+//
+template<class OT, class OP1, class OP2>
+struct semiring_multiplication_traits
+:   public matrix_multiplication_traits<OT, OP1, OP2>
+{};
+
+//---------------
+//- vector*vector
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct semiring_multiplication_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>
+:   public matrix_multiplication_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>
+{
+    using base_traits  = matrix_multiplication_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>;
+    using semiring     = typename OT::semiring_type;
+    using result_type  = typename base_traits::result_type;
+
+    using size_type_1 = typename base_traits::size_type_1;
+    using size_type_2 = typename base_traits::size_type_2;
+
+    static result_type  multiply(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+auto
+semiring_multiplication_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>::multiply
+(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2) -> result_type
+{
+    using elem_type = result_type;
+
+    PrintOperandTypes<result_type>("semiring_multiplication_traits (v*v)", v1, v2);
+
+    if (v1.elements() != v2.elements())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_type_1 const   elems = v1.elements();
+    elem_type const     zero  = semiring::template zero<elem_type>();
+    elem_type           r     = zero;
+
+    for (size_type_1 i = 0;  i < elems;  ++i)
+    {
+        elem_type const     x = static_cast<elem_type>(v1(i));
+
+        if (x != zero)
+        {
+            r = semiring::add(r, semiring::multiply(x, static_cast<elem_type>(v2(static_cast<size_type_2>(i)))));
+        }
+    }
+    return r;
+}
+
+//---------------
+//- matrix*vector
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct semiring_multiplication_traits<OT, matrix<ET1, OT1>, vector<ET2, OT2>>
+:   public matrix_multiplication_traits<OT, matrix<ET1, OT1>, vector<ET2, OT2>>
+{
+    using base_traits  = matrix_multiplication_traits<OT, matrix<ET1, OT1>, vector<ET2, OT2>>;
+    using semiring     = typename OT::semiring_type;
+    using engine_type  = typename base_traits::engine_type;
+    using op_traits    = typename base_traits::op_traits;
+    using result_type  = typename base_traits::result_type;
+
+    using size_type_1 = typename base_traits::size_type_1;
+    using size_type_2 = typename base_traits::size_type_2;
+    using size_type_r = typename base_traits::size_type_r;
+
+    static result_type  multiply(matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+auto
+semiring_multiplication_traits<OT, matrix<ET1, OT1>, vector<ET2, OT2>>::multiply
+(matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    using elem_type = typename result_type::element_type;
+
+    PrintOperandTypes<result_type>("semiring_multiplication_traits (m*v)", m1, v2);
+
+    if (m1.columns() != v2.elements())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_type_1 const   rows = m1.rows();
+    size_type_1 const   cols = m1.columns();
+    elem_type const     zero = semiring::template zero<elem_type>();
+    result_type         vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(static_cast<size_type_r>(rows));
+    }
+
+    for (size_type_1 i = 0;  i < rows;  ++i)
+    {
+        elem_type   r = zero;
+
+        for (size_type_1 j = 0;  j < cols;  ++j)
+        {
+            elem_type const     x = static_cast<elem_type>(v2(static_cast<size_type_2>(j)));
+
+            if (x != zero)
+            {
+                r = semiring::add(r, semiring::multiply(static_cast<elem_type>(m1(i, j)), x));
+            }
+        }
+        vr(static_cast<size_type_r>(i)) = r;
+    }
+    return vr;
+}
+
+//---------------
+//- vector*matrix
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct semiring_multiplication_traits<OT, vector<ET1, OT1>, matrix<ET2, OT2>>
+:   public matrix_multiplication_traits<OT, vector<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using base_traits  = matrix_multiplication_traits<OT, vector<ET1, OT1>, matrix<ET2, OT2>>;
+    using semiring     = typename OT::semiring_type;
+    using engine_type  = typename base_traits::engine_type;
+    using op_traits    = typename base_traits::op_traits;
+    using result_type  = typename base_traits::result_type;
+
+    using size_type_1 = typename base_traits::size_type_1;
+    using size_type_2 = typename base_traits::size_type_2;
+    using size_type_r = typename base_traits::size_type_r;
+
+    static result_type  multiply(vector<ET1, OT1> const& v1, matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+auto
+semiring_multiplication_traits<OT, vector<ET1, OT1>, matrix<ET2, OT2>>::multiply
+(vector<ET1, OT1> const& v1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    using elem_type = typename result_type::element_type;
+
+    PrintOperandTypes<result_type>("semiring_multiplication_traits (v*m)", v1, m2);
+
+    if (v1.elements() != m2.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_type_2 const   rows = m2.rows();
+    size_type_2 const   cols = m2.columns();
+    elem_type const     zero = semiring::template zero<elem_type>();
+    result_type         vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(static_cast<size_type_r>(cols));
+    }
+    for (size_type_2 j = 0;  j < cols;  ++j)
+    {
+        vr(static_cast<size_type_r>(j)) = zero;
+    }
+
+    //- Row-wise accumulation, so that each non-zero element of the vector (e.g., each vertex of
+    //  a BFS frontier) costs one pass over a single row of the matrix.
+    //
+    for (size_type_2 i = 0;  i < rows;  ++i)
+    {
+        elem_type const     x = static_cast<elem_type>(v1(static_cast<size_type_1>(i)));
+
+        if (x != zero)
+        {
+            for (size_type_2 j = 0;  j < cols;  ++j)
+            {
+                elem_type&  r = vr(static_cast<size_type_r>(j));
+                r = semiring::add(r, semiring::multiply(x, static_cast<elem_type>(m2(i, j))));
+            }
+        }
+    }
+    return vr;
+}
+
+//---------------
+//- matrix*matrix
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct semiring_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+:   public matrix_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using base_traits  = matrix_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>;
+    using semiring     = typename OT::semiring_type;
+    using engine_type  = typename base_traits::engine_type;
+    using op_traits    = typename base_traits::op_traits;
+    using result_type  = typename base_traits::result_type;
+
+    using size_type_1 = typename base_traits::size_type_1;
+    using size_type_2 = typename base_traits::size_type_2;
+    using size_type_r = typename base_traits::size_type_r;
+
+    static result_type  multiply(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+auto
+semiring_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    using elem_type = typename result_type::element_type;
+
+    PrintOperandTypes<result_type>("semiring_multiplication_traits (m*m)", m1, m2);
+
+    if (m1.columns() != m2.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_type_1 const   rows  = m1.rows();
+    size_type_1 const   inner = m1.columns();
+    size_type_2 const   cols  = m2.columns();
+    elem_type const     zero  = semiring::template zero<elem_type>();
+    result_type         mr;
+
+    if constexpr (result_requires_resize(mr))
+    {
+        mr.resize(static_cast<size_type_r>(rows), static_cast<size_type_r>(cols));
+    }
+
+    //- The i-k-j loop order streams rows of both the right operand and the result, and skips
+    //  all of the work for each zero element of the left operand.
+    //
+    for (size_type_1 i = 0;  i < rows;  ++i)
+    {
+        size_type_r const   ir = static_cast<size_type_r>(i);
+
+        for (size_type_2 j = 0;  j < cols;  ++j)
+        {
+            mr(ir, static_cast<size_type_r>(j)) = zero;
+        }
+
+        for (size_type_1 k = 0;  k < inner;  ++k)
+        {
+            elem_type const     a = static_cast<elem_type>(m1(i, k));
+
+            if (a != zero)
+            {
+                size_type_2 const   k2 = static_cast<size_type_2>(k);
+
+                for (size_type_2 j = 0;  j < cols;  ++j)
+                {
+                    elem_type&  r = mr(ir, static_cast<size_type_r>(j));
+                    r = semiring::add(r, semiring::multiply(a, static_cast<elem_type>(m2(k2, j))));
+                }
+            }
+        }
+    }
+    return mr;
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_SEMIRING_TRAITS_HPP_DEFINED
@@ -0,0 +1,649 @@
+//==================================================================================================
+//  File:       shm_engines.hpp
+//
+//  Summary:    This header defines vector and matrix engines whose elements are stored in a named
+//              POSIX shared-memory segment, so that several processes can use one copy of a large
+//              vector or matrix.  A loader process creates the segment, fills it through a
+//              writable engine, and then publishes it; other processes open the published segment
+//              read-only, by way of an engine whose element type is const-qualified.
+//
+//              Each segment begins with a small header recording the element size, the extents,
+//              and whether the segment has been published; opening a segment that has not yet
+//              been published, or whose header does not match the requested element type, throws.
+//              Elements are stored densely in row-major order, so the engines provide data().
+//
+//              The engines own their mappings, and so are movable but not copyable.  Destroying
+//              an engine unmaps the segment but does not remove its name; remove_shared() does.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SHM_ENGINES_HPP_DEFINED
+#define LINEAR_ALGEBRA_SHM_ENGINES_HPP_DEFINED
+
+#if defined(__unix__)  ||  defined(__APPLE__)
+
+#include <atomic>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define LA_HAS_SHM_ENGINES
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  A mapping of a shared-memory segment laid out as a header followed, at a fixed offset, by
+//  the elements.
+//==================================================================================================
+//
+struct shm_header
+{
+    atomic<uint64_t>    state;
+    uint64_t            element_size;
+    uint64_t            rows;
+    uint64_t            columns;
+};
+
+class shm_segment
+{
+  public:
+    static constexpr uint64_t   created   = 0x4c41534d43524541;     //- "LASMCREA"
+    static constexpr uint64_t   published = 0x4c41534d5055424c;     //- "LASMPUBL"
+    static constexpr size_t     data_offset = 64;
+
+    ~shm_segment() noexcept;
+
+    shm_segment() noexcept = default;
+    shm_segment(shm_segment&& rhs) noexcept;
+    shm_segment(shm_segment const&) = delete;
+
+    shm_segment&    operator =(shm_segment&& rhs) noexcept;
+    shm_segment&    operator =(shm_segment const&) = delete;
+
+    static shm_segment  create(char const* name, size_t element_size, size_t rows, size_t cols);
+    static shm_segment  open(char const* name, size_t element_size, bool writable);
+
+    void*           data() const noexcept;
+    shm_header*     header() const noexcept;
+    size_t          rows() const noexcept;
+    size_t          columns() const noexcept;
+
+    void    swap(shm_segment& rhs) noexcept;
+
+  private:
+    void*   mp_map = nullptr;
+    size_t  m_size = 0;
+};
+
+inline
+shm_segment::~shm_segment() noexcept
+{
+    if (mp_map != nullptr)
+    {
+        ::munmap(mp_map, m_size);
+    }
+}
+
+inline
+shm_segment::shm_segment(shm_segment&& rhs) noexcept
+{
+    swap(rhs);
+}
+
+inline shm_segment&
+shm_segment::operator =(shm_segment&& rhs) noexcept
+{
+    shm_segment     tmp(std::move(rhs));
+
+    swap(tmp);
+    return *this;
+}
+
+//- Creates a new segment, which must not already exist; its elements are zero.
+//
+inline shm_segment
+shm_segment::create(char const* name, size_t element_size, size_t rows, size_t cols)
+{
+    size_t const    max_elems = (numeric_limits<size_t>::max() - data_offset) / element_size;
+
+    if (rows == 0  ||  cols == 0  ||  rows > max_elems / cols)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_t const    size = data_offset + rows*cols*element_size;
+    int const       fd   = ::shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+
+    if (fd < 0)
+    {
+        throw runtime_error("unable to create shared memory segment");
+    }
+
+    void*   p_map = MAP_FAILED;
+
+    if (::ftruncate(fd, static_cast<off_t>(size)) == 0)
+    {
+        p_map = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+
+    if (p_map == MAP_FAILED)
+    {
+        ::shm_unlink(name);
+        throw runtime_error("unable to create shared memory segment");
+    }
+
+    shm_segment     seg;
+    shm_header*     p_hdr = ::new (p_map) shm_header{};
+
+    seg.mp_map = p_map;
+    seg.m_size = size;
+    p_hdr->element_size = element_size;
+    p_hdr->rows         = rows;
+    p_hdr->columns      = cols;
+    p_hdr->state.store(created, memory_order_release);
+    return seg;
+}
+
+//- Opens an existing, published segment whose elements have the given size.
+//
+inline shm_segment
+shm_segment::open(char const* name, size_t element_size, bool writable)
+{
+    int const   fd = ::shm_open(name, writable ? O_RDWR : O_RDONLY, 0);
+
+    if (fd < 0)
+    {
+        throw runtime_error("unable to open shared memory segment");
+    }
+
+    struct stat     st;
+    void*           p_map = MAP_FAILED;
+    size_t          size  = 0;
+
+    if (::fstat(fd, &st) == 0  &&  static_cast<size_t>(st.st_size) >= data_offset)
+    {
+        size  = static_cast<size_t>(st.st_size);
+        p_map = ::mmap(nullptr, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ,
+                       MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+
+    if (p_map == MAP_FAILED)
+    {
+        throw runtime_error("unable to open shared memory segment");
+    }
+
+    shm_segment     seg;
+
+    seg.mp_map = p_map;
+    seg.m_size = size;
+
+    shm_header const*   p_hdr = seg.header();
+
+    if (p_hdr->state.load(memory_order_acquire) != published)
+    {
+        throw runtime_error("shared memory segment not published");
+    }
+    if (p_hdr->element_size != element_size  ||
+        p_hdr->rows == 0  ||  p_hdr->columns == 0  ||
+        (size - data_offset) / element_size / p_hdr->columns < p_hdr->rows)
+    {
+        throw runtime_error("invalid shared memory segment");
+    }
+    return seg;
+}
+
+inline void*
+shm_segment::data() const noexcept
+{
+    return static_cast<char*>(mp_map) + data_offset;
+}
+
+inline shm_header*
+shm_segment::header() const noexcept
+{
+    return static_cast<shm_header*>(mp_map);
+}
+
+inline size_t
+shm_segment::rows() const noexcept
+{
+    return (mp_map != nullptr) ? static_cast<size_t>(header()->rows) : 0;
+}
+
+inline size_t
+shm_segment::columns() const noexcept
+{
+    return (mp_map != nullptr) ? static_cast<size_t>(header()->columns) : 0;
+}
+
+inline void
+shm_segment::swap(shm_segment& rhs) noexcept
+{
+    detail::la_swap(mp_map, rhs.mp_map);
+    detail::la_swap(m_size, rhs.m_size);
+}
+
+}       //- detail namespace
+//==================================================================================================
+//  Shared-memory vector engine.
+//==================================================================================================
+//
+template<class T>
+class shm_vector_engine
+{
+    static_assert(is_trivially_copyable_v<T>);
+
+  public:
+    using engine_category = conditional_t<is_const_v<T>, readable_vector_engine_tag,
+                                                         writable_vector_engine_tag>;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+
+    //- Construct/copy/destroy
+    //
+    ~shm_vector_engine() noexcept = default;
+
+    shm_vector_engine() noexcept = default;
+    shm_vector_engine(shm_vector_engine&&) noexcept = default;
+    shm_vector_engine(shm_vector_engine const&) = delete;
+    explicit shm_vector_engine(detail::shm_segment&& seg) noexcept;
+
+    shm_vector_engine&  operator =(shm_vector_engine&&) noexcept = default;
+    shm_vector_engine&  operator =(shm_vector_engine const&) = delete;
+    template<class ET2>
+    shm_vector_engine&  operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    size_type   capacity() const noexcept;
+    size_type   elements() const noexcept;
+
+    //- Element access
+    //
+    reference           operator ()(size_type i);
+    const_reference     operator ()(size_type i) const;
+
+    //- Data access
+    //
+    pointer             data() noexcept;
+    const_pointer       data() const noexcept;
+
+    //- Publication
+    //
+    void    publish() noexcept;
+
+    //- Modifiers
+    //
+    void    swap(shm_vector_engine& rhs) noexcept;
+    void    swap_elements(size_type i, size_type j) noexcept;
+
+  private:
+    detail::shm_segment     m_seg;
+};
+
+template<class T> inline
+shm_vector_engine<T>::shm_vector_engine(detail::shm_segment&& seg) noexcept
+:   m_seg(std::move(seg))
+{}
+
+template<class T>
+template<class ET2>
+shm_vector_engine<T>&
+shm_vector_engine<T>::operator =(ET2 const& rhs)
+{
+    using src_size_type = typename ET2::size_type;
+
+    if (static_cast<size_type>(rhs.elements()) != elements())
+    {
+        throw runtime_error("invalid size");
+    }
+    for (size_type i = 0;  i < elements();  ++i)
+    {
+        data()[i] = static_cast<value_type>(rhs(static_cast<src_size_type>(i)));
+    }
+    return *this;
+}
+
+template<class T> inline
+typename shm_vector_engine<T>::size_type
+shm_vector_engine<T>::capacity() const noexcept
+{
+    return m_seg.rows()*m_seg.columns();
+}
+
+template<class T> inline
+typename shm_vector_engine<T>::size_type
+shm_vector_engine<T>::elements() const noexcept
+{
+    return m_seg.rows()*m_seg.columns();
+}
+
+template<class T> inline
+typename shm_vector_engine<T>::reference
+shm_vector_engine<T>::operator ()(size_type i)
+{
+    return data()[i];
+}
+
+template<class T> inline
+typename shm_vector_engine<T>::const_reference
+shm_vector_engine<T>::operator ()(size_type i) const
+{
+    return data()[i];
+}
+
+template<class T> inline
+typename shm_vector_engine<T>::pointer
+shm_vector_engine<T>::data() noexcept
+{
+    return static_cast<pointer>(m_seg.data());
+}
+
+template<class T> inline
+typename shm_vector_engine<T>::const_pointer
+shm_vector_engine<T>::data() const noexcept
+{
+    return static_cast<const_pointer>(m_seg.data());
+}
+
+//- Marks the segment as ready to be opened by other processes; all preceding writes to its
+//  elements are visible to a process that subsequently opens it.
+//
+template<class T> inline
+void
+shm_vector_engine<T>::publish() noexcept
+{
+    static_assert(!is_const_v<T>);
+    m_seg.header()->state.store(detail::shm_segment::published, memory_order_release);
+}
+
+template<class T> inline
+void
+shm_vector_engine<T>::swap(shm_vector_engine& rhs) noexcept
+{
+    m_seg.swap(rhs.m_seg);
+}
+
+template<class T> inline
+void
+shm_vector_engine<T>::swap_elements(size_type i, size_type j) noexcept
+{
+    detail::la_swap(data()[i], data()[j]);
+}
+
+//==================================================================================================
+//  Shared-memory matrix engine.
+//==================================================================================================
+//
+template<class T>
+class shm_matrix_engine
+{
+    static_assert(is_trivially_copyable_v<T>);
+
+  public:
+    using engine_category = conditional_t<is_const_v<T>, readable_matrix_engine_tag,
+                                                         writable_matrix_engine_tag>;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    //- Construct/copy/destroy
+    //
+    ~shm_matrix_engine() noexcept = default;
+
+    shm_matrix_engine() noexcept = default;
+    shm_matrix_engine(shm_matrix_engine&&) noexcept = default;
+    shm_matrix_engine(shm_matrix_engine const&) = delete;
+    explicit shm_matrix_engine(detail::shm_segment&& seg) noexcept;
+
+    shm_matrix_engine&  operator =(shm_matrix_engine&&) noexcept = default;
+    shm_matrix_engine&  operator =(shm_matrix_engine const&) = delete;
+    template<class ET2>
+    shm_matrix_engine&  operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    //- Element access
+    //
+    reference           operator ()(size_type i, size_type j);
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    //- Data access
+    //
+    pointer             data() noexcept;
+    const_pointer       data() const noexcept;
+
+    //- Publication
+    //
+    void    publish() noexcept;
+
+    //- Modifiers
+    //
+    void    swap(shm_matrix_engine& rhs) noexcept;
+    void    swap_columns(size_type c1, size_type c2) noexcept;
+    void    swap_rows(size_type r1, size_type r2) noexcept;
+
+  private:
+    detail::shm_segment     m_seg;
+};
+
+template<class T> inline
+shm_matrix_engine<T>::shm_matrix_engine(detail::shm_segment&& seg) noexcept
+:   m_seg(std::move(seg))
+{}
+
+template<class T>
+template<class ET2>
+shm_matrix_engine<T>&
+shm_matrix_engine<T>::operator =(ET2 const& rhs)
+{
+    using src_size_type = typename ET2::size_type;
+
+    if (static_cast<size_type>(rhs.rows()) != rows()  ||
+        static_cast<size_type>(rhs.columns()) != columns())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    pointer const   p_dst = data();
+    size_type const cols  = columns();
+
+    for (size_type i = 0;  i < rows();  ++i)
+    {
+        for (size_type j = 0;  j < cols;  ++j)
+        {
+            p_dst[i*cols + j] = static_cast<value_type>(rhs(static_cast<src_size_type>(i),
+                                                            static_cast<src_size_type>(j)));
+        }
+    }
+    return *this;
+}
+
+template<class T> inline
+typename shm_matrix_engine<T>::size_type
+shm_matrix_engine<T>::columns() const noexcept
+{
+    return m_seg.columns();
+}
+
+template<class T> inline
+typename shm_matrix_engine<T>::size_type
+shm_matrix_engine<T>::rows() const noexcept
+{
+    return m_seg.rows();
+}
+
+template<class T> inline
+typename shm_matrix_engine<T>::size_tuple
+shm_matrix_engine<T>::size() const noexcept
+{
+    return size_tuple(m_seg.rows(), m_seg.columns());
+}
+
+template<class T> inline
+typename shm_matrix_engine<T>::size_type
+shm_matrix_engine<T>::column_capacity() const noexcept
+{
+    return m_seg.columns();
+}
+
+template<class T> inline
+typename shm_matrix_engine<T>::size_type
+shm_matrix_engine<T>::row_capacity() const noexcept
+{
+    return m_seg.rows();
+}
+
+template<class T> inline
+typename shm_matrix_engine<T>::size_tuple
+shm_matrix_engine<T>::capacity() const noexcept
+{
+    return size_tuple(m_seg.rows(), m_seg.columns());
+}
+
+template<class T> inline
+typename shm_matrix_engine<T>::reference
+shm_matrix_engine<T>::operator ()(size_type i, size_type j)
+{
+    return data()[i*m_seg.columns() + j];
+}
+
+template<class T> inline
+typename shm_matrix_engine<T>::const_reference
+shm_matrix_engine<T>::operator ()(size_type i, size_type j) const
+{
+    return data()[i*m_seg.columns() + j];
+}
+
+template<class T> inline
+typename shm_matrix_engine<T>::pointer
+shm_matrix_engine<T>::data() noexcept
+{
+    return static_cast<pointer>(m_seg.data());
+}
+
+template<class T> inline
+typename shm_matrix_engine<T>::const_pointer
+shm_matrix_engine<T>::data() const noexcept
+{
+    return static_cast<const_pointer>(m_seg.data());
+}
+
+template<class T> inline
+void
+shm_matrix_engine<T>::publish() noexcept
+{
+    static_assert(!is_const_v<T>);
+    m_seg.header()->state.store(detail::shm_segment::published, memory_order_release);
+}
+
+template<class T> inline
+void
+shm_matrix_engine<T>::swap(shm_matrix_engine& rhs) noexcept
+{
+    m_seg.swap(rhs.m_seg);
+}
+
+template<class T>
+void
+shm_matrix_engine<T>::swap_columns(size_type c1, size_type c2) noexcept
+{
+    if (c1 != c2)
+    {
+        for (size_type i = 0;  i < rows();  ++i)
+        {
+            detail::la_swap((*this)(i, c1), (*this)(i, c2));
+        }
+    }
+}
+
+template<class T>
+void
+shm_matrix_engine<T>::swap_rows(size_type r1, size_type r2) noexcept
+{
+    if (r1 != r2)
+    {
+        std::swap_ranges(data() + r1*columns(), data() + (r1 + 1)*columns(), data() + r2*columns());
+    }
+}
+
+//==================================================================================================
+//                              **** SHARED VECTORS AND MATRICES ****
+//==================================================================================================
+//  create_shared_vector() and create_shared_matrix() create a new segment with the given name
+//  and return a writable, zero-filled object that uses it; publish() on its engine makes it
+//  available to open_shared_vector() and open_shared_matrix(), which return read-only objects.
+//  remove_shared() removes the name; existing mappings remain valid until they are destroyed.
+//==================================================================================================
+//
+template<class T, class OT = matrix_operation_traits>
+auto
+create_shared_vector(char const* name, size_t elems)
+{
+    vector<shm_vector_engine<T>, OT>    vr;
+
+    vr.engine() = shm_vector_engine<T>(detail::shm_segment::create(name, sizeof(T), 1, elems));
+    return vr;
+}
+
+template<class T, class OT = matrix_operation_traits>
+auto
+open_shared_vector(char const* name)
+{
+    vector<shm_vector_engine<T const>, OT>  vr;
+
+    vr.engine() = shm_vector_engine<T const>(detail::shm_segment::open(name, sizeof(T), false));
+    return vr;
+}
+
+template<class T, class OT = matrix_operation_traits>
+auto
+create_shared_matrix(char const* name, size_t rows, size_t cols)
+{
+    matrix<shm_matrix_engine<T>, OT>    mr;
+
+    mr.engine() = shm_matrix_engine<T>(detail::shm_segment::create(name, sizeof(T), rows, cols));
+    return mr;
+}
+
+template<class T, class OT = matrix_operation_traits>
+auto
+open_shared_matrix(char const* name)
+{
+    matrix<shm_matrix_engine<T const>, OT>  mr;
+
+    mr.engine() = shm_matrix_engine<T const>(detail::shm_segment::open(name, sizeof(T), false));
+    return mr;
+}
+
+inline bool
+remove_shared(char const* name) noexcept
+{
+    return ::shm_unlink(name) == 0;
+}
+
+}       //- STD_LA namespace
+#endif  //- __unix__ || __APPLE__
+#endif  //- LINEAR_ALGEBRA_SHM_ENGINES_HPP_DEFINED
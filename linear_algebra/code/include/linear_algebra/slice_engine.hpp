@@ -0,0 +1,219 @@
+//==================================================================================================
+//  File:       slice_engine.hpp
+//
+//  Summary:    This header defines an engine that acts as a strided "view" of a vector.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SLICE_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_SLICE_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+//==================================================================================================
+//  Vector slice engine, meant to act as a "view" of every S-th element of a vector, starting at
+//  some given element.  If S is zero, the stride is specified at run time instead.
+//
+//  If the wrapped engine exposes its storage via data(), then the slice indexes that storage
+//  directly, so that element access is a single strided load (with a constant stride, when S
+//  is non-zero) rather than a call through the wrapped engine.
+//==================================================================================================
+//
+template<class ET, class VCT, size_t S>
+class slice_engine
+{
+    static_assert(is_vector_engine_v<ET>);
+    static_assert(is_vector_engine_tag<VCT>);
+
+    static constexpr bool   has_direct_access = detail::has_data_v<ET>;
+
+  public:
+    //- Types
+    //
+    using engine_category = VCT;
+    using element_type    = typename ET::element_type;
+    using value_type      = typename ET::value_type;
+    using pointer         = detail::noe_pointer_t<ET, VCT>;
+    using const_pointer   = typename ET::const_pointer;
+    using reference       = detail::noe_reference_t<ET, VCT>;
+    using const_reference = typename ET::const_reference;
+    using difference_type = typename ET::difference_type;
+    using size_type       = typename ET::size_type;
+
+#ifdef LA_USE_VECTOR_ENGINE_ITERATORS
+    using iterator        = detail::noe_iterator_t<ET, VCT, slice_engine>;
+    using const_iterator  = detail::vector_const_iterator<slice_engine>;
+#endif
+
+    //- Construct/copy/destroy
+    //
+    ~slice_engine() noexcept = default;
+
+    constexpr slice_engine() noexcept;
+    constexpr slice_engine(slice_engine&&) noexcept = default;
+    constexpr slice_engine(slice_engine const&) noexcept = default;
+
+    constexpr slice_engine&     operator =(slice_engine&&) noexcept = default;
+    constexpr slice_engine&     operator =(slice_engine const&) noexcept = default;
+
+#ifdef LA_USE_VECTOR_ENGINE_ITERATORS
+    //- Iterators
+    //
+    constexpr iterator          begin() const noexcept;
+    constexpr iterator          end() const noexcept;
+    constexpr const_iterator    cbegin() const noexcept;
+    constexpr const_iterator    cend() const noexcept;
+#endif
+
+    //- Capacity
+    //
+    constexpr size_type     capacity() const noexcept;
+    constexpr size_type     elements() const noexcept;
+    constexpr size_type     stride() const noexcept;
+
+    //- Element access
+    //
+    constexpr reference     operator ()(size_type i) const;
+
+    //- Modifiers
+    //
+    constexpr void      swap(slice_engine& rhs);
+
+  private:
+    template<class ET2, class OT2>  friend class vector;
+    using referent_type = detail::noe_referent_t<ET, VCT>;
+
+    referent_type*  mp_other;
+    pointer         mp_data;
+    size_type       m_start;
+    size_type       m_elems;
+    size_type       m_stride;
+
+    constexpr slice_engine(referent_type& eng, size_type start, size_type elems, size_type stride);
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class ET, class VCT, size_t S> constexpr
+slice_engine<ET, VCT, S>::slice_engine() noexcept
+:   mp_other(nullptr)
+,   mp_data(nullptr)
+,   m_start(0)
+,   m_elems(0)
+,   m_stride(S)
+{}
+
+#ifdef LA_USE_VECTOR_ENGINE_ITERATORS
+//-----------
+//- Iterators
+//
+template<class ET, class VCT, size_t S> constexpr
+typename slice_engine<ET, VCT, S>::iterator
+slice_engine<ET, VCT, S>::begin() const noexcept
+{
+    return iterator(this, 0, m_elems);
+}
+
+template<class ET, class VCT, size_t S> constexpr
+typename slice_engine<ET, VCT, S>::iterator
+slice_engine<ET, VCT, S>::end() const noexcept
+{
+    return iterator(this, m_elems, m_elems);
+}
+
+template<class ET, class VCT, size_t S> constexpr
+typename slice_engine<ET, VCT, S>::const_iterator
+slice_engine<ET, VCT, S>::cbegin() const noexcept
+{
+    return const_iterator(this, 0, m_elems);
+}
+
+template<class ET, class VCT, size_t S> constexpr
+typename slice_engine<ET, VCT, S>::const_iterator
+slice_engine<ET, VCT, S>::cend() const noexcept
+{
+    return const_iterator(this, m_elems, m_elems);
+}
+
+#endif
+//----------
+//- Capacity
+//
+template<class ET, class VCT, size_t S> constexpr
+typename slice_engine<ET, VCT, S>::size_type
+slice_engine<ET, VCT, S>::capacity() const noexcept
+{
+    return m_elems;
+}
+
+template<class ET, class VCT, size_t S> constexpr
+typename slice_engine<ET, VCT, S>::size_type
+slice_engine<ET, VCT, S>::elements() const noexcept
+{
+    return m_elems;
+}
+
+template<class ET, class VCT, size_t S> constexpr
+typename slice_engine<ET, VCT, S>::size_type
+slice_engine<ET, VCT, S>::stride() const noexcept
+{
+    if constexpr (S != 0)
+    {
+        return static_cast<size_type>(S);
+    }
+    else
+    {
+        return m_stride;
+    }
+}
+
+//----------------
+//- Element access
+//
+template<class ET, class VCT, size_t S> constexpr
+typename slice_engine<ET, VCT, S>::reference
+slice_engine<ET, VCT, S>::operator ()(size_type i) const
+{
+    if constexpr (has_direct_access)
+    {
+        return mp_data[i*stride()];
+    }
+    else
+    {
+        return (*mp_other)(m_start + i*stride());
+    }
+}
+
+//-----------
+//- Modifiers
+//
+template<class ET, class VCT, size_t S> constexpr
+void
+slice_engine<ET, VCT, S>::swap(slice_engine& rhs)
+{
+    std::swap(mp_other, rhs.mp_other);
+    std::swap(mp_data, rhs.mp_data);
+    std::swap(m_start, rhs.m_start);
+    std::swap(m_elems, rhs.m_elems);
+    std::swap(m_stride, rhs.m_stride);
+}
+
+//------------------------
+//- Private implementation
+//
+template<class ET, class VCT, size_t S> constexpr
+slice_engine<ET, VCT, S>::slice_engine
+(referent_type& eng, size_type start, size_type elems, size_type stride)
+:   mp_other(&eng)
+,   mp_data(nullptr)
+,   m_start(start)
+,   m_elems(elems)
+,   m_stride((S != 0) ? static_cast<size_type>(S) : stride)
+{
+    if constexpr (has_direct_access)
+    {
+        mp_data = eng.data() + start;
+    }
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_SLICE_ENGINE_HPP_DEFINED
@@ -0,0 +1,974 @@
+//==================================================================================================
+//  File:       spectral_decompositions.hpp
+//
+//  Summary:    This header defines the symmetric eigenvalue decomposition and the singular value
+//              decomposition of dense matrices.  Both work on a contiguous row-major copy of the
+//              operand, so any readable matrix engine may be used as input; results are returned
+//              as dyn_vector/dyn_matrix objects.
+//
+//              Eigensystem:    A = Z * diag(w) * Z',   w ascending, Z orthogonal.
+//              SVD:            A = U * diag(s) * V',   s descending, U (m x p), V (n x p), where
+//                                                      p = min(m, n).
+//
+//              The symmetric solver reduces A to tridiagonal form with Householder reflectors,
+//              and the SVD reduces A to upper bidiagonal form (Golub-Kahan).  Both reductions are
+//              blocked, in the manner of LAPACK's xSYTRD and xGEBRD:  a panel of columns is
+//              reduced with matrix-vector products, which also build the matrices that express
+//              the panel's reflectors as a low-rank update, and the trailing matrix is then
+//              updated once per panel by the GEMM kernel.  The reflectors are accumulated in
+//              blocks using the compact WY representation and the GEMM kernel.  The reduced
+//              problems are then solved by implicitly-shifted QR iteration, with a Wilkinson
+//              shift, which accumulates its plane rotations into the vectors.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SPECTRAL_DECOMPOSITIONS_HPP_DEFINED
+#define LINEAR_ALGEBRA_SPECTRAL_DECOMPOSITIONS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Applies the plane rotation [c s; -s c] to columns j and k of the row-major (rows x ?) block
+//  at p_q:  q(:,j) <- c*q(:,j) + s*q(:,k),  q(:,k) <- c*q(:,k) - s*q(:,j).  A null p_q is allowed,
+//  in which case nothing is done.
+//==================================================================================================
+//
+template<class T>
+void
+rotate_columns(T* p_q, size_t ldq, size_t rows, size_t j, size_t k, T c, T s)
+{
+    if (p_q == nullptr) return;
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        T const     qj = p_q[i*ldq + j];
+        T const     qk = p_q[i*ldq + k];
+
+        p_q[i*ldq + j] = c*qj + s*qk;
+        p_q[i*ldq + k] = c*qk - s*qj;
+    }
+}
+
+//- Computes c and s such that [c s; -s c] * [x; z] = [r; 0], and returns r.
+//
+template<class T>
+T
+make_rotation(T x, T z, T& c, T& s)
+{
+    T const     r = hypot(x, z);
+
+    if (r == T(0))
+    {
+        c = T(1);
+        s = T(0);
+    }
+    else
+    {
+        c = x / r;
+        s = z / r;
+    }
+    return r;
+}
+
+//==================================================================================================
+//  Computes y = A*x for the symmetric (n x n) matrix A, of which only the lower triangle of the
+//  row-major block at p_a is read.  Each row is read once, with unit stride:  its part left of the
+//  diagonal contributes both to its own element of y (as a row) and to those before it (as the
+//  mirrored column).
+//==================================================================================================
+//
+template<class T>
+void
+symv_lower(size_t n, T const* p_a, size_t lda, T const* p_x, T* p_y)
+{
+    fill_n(p_y, n, T{});
+
+    for (size_t r = 0;  r < n;  ++r)
+    {
+        T const*    p_ar = p_a + r*lda;
+        T const     xr   = p_x[r];
+        T           sum  = p_ar[r] * xr;
+
+        for (size_t c = 0;  c < r;  ++c)
+        {
+            sum    += p_ar[c] * p_x[c];
+            p_y[c] += p_ar[c] * xr;
+        }
+        p_y[r] += sum;
+    }
+}
+
+//==================================================================================================
+//  Householder reduction of the symmetric (n x n) row-major matrix at p_a to tridiagonal form,
+//  A = Q * T * Q'.  On return the diagonal of T is at p_d (n elements), the off-diagonal at p_e
+//  (n-1 elements), and if p_q is not null Q is stored at p_q (n x n, row-major).  Only the lower
+//  triangle of A is referenced, and it is destroyed.
+//
+//  The reduction is blocked.  For each panel of nb columns, reflector k is stored in column k of
+//  A below the diagonal, and a matrix W is built such that applying the panel's reflectors to the
+//  trailing matrix is the symmetric rank-2nb update A22 <- A22 - V*W' - W*V'.  Within the panel,
+//  each column, and each product with A22, is corrected for the reflectors before it; the
+//  trailing matrix itself is only updated, by the GEMM kernel, once the panel is complete.
+//==================================================================================================
+//
+template<class T>
+void
+tridiagonalize(size_t n, T* p_a, T* p_d, T* p_e, T* p_q)
+{
+    size_t const    nr = (n > 1) ? n - 1 : 0;
+    std::vector<T>  tau(nr), v(n), y(n), t(2*householder_block), w, wt, vt;
+
+    for (size_t j0 = 0;  j0 < nr;  j0 += householder_block)
+    {
+        size_t const    nb = min(householder_block, nr - j0);
+
+        //- Row r of W is at w[(r - j0)*nb], and row r of V is at p_a[r*n + j0].
+        //
+        w.assign((n - j0)*nb, T{});
+
+        for (size_t i = 0;  i < nb;  ++i)
+        {
+            size_t const    k   = j0 + i;
+            size_t const    len = n - k - 1;
+            T const* const  p_vk = p_a + k*n + j0;
+            T const* const  p_wk = w.data() + (k - j0)*nb;
+
+            //- Bring column k up to date with the panel's previous reflectors.
+            //
+            for (size_t r = k;  r < n;  ++r)
+            {
+                T const*    p_vr = p_a + r*n + j0;
+                T const*    p_wr = w.data() + (r - j0)*nb;
+                T           sum  = 0;
+
+                for (size_t l = 0;  l < i;  ++l)
+                {
+                    sum += p_vr[l]*p_wk[l] + p_wr[l]*p_vk[l];
+                }
+                p_a[r*n + k] -= sum;
+            }
+
+            T* const    p_x = p_a + (k+1)*n + k;
+
+            p_e[k] = make_householder(len, p_x, n, tau[k]);
+
+            if (tau[k] == T(0)) continue;
+
+            for (size_t r = 0;  r < len;  ++r)
+            {
+                v[r] = p_x[r*n];
+            }
+
+            //- y = A22*v - V*(W'*v) - W*(V'*v), where A22 has not yet been updated for this panel.
+            //
+            symv_lower(len, p_a + (k+1)*n + (k+1), n, v.data(), y.data());
+
+            fill_n(t.data(), 2*i, T{});
+
+            for (size_t r = 0;  r < len;  ++r)
+            {
+                T const*    p_vr = p_a + (k+1+r)*n + j0;
+                T const*    p_wr = w.data() + (k+1+r - j0)*nb;
+
+                for (size_t l = 0;  l < i;  ++l)
+                {
+                    t[l]     += p_wr[l] * v[r];
+                    t[i + l] += p_vr[l] * v[r];
+                }
+            }
+
+            T   yv = 0;
+
+            for (size_t r = 0;  r < len;  ++r)
+            {
+                T const*    p_vr = p_a + (k+1+r)*n + j0;
+                T const*    p_wr = w.data() + (k+1+r - j0)*nb;
+                T           sum  = 0;
+
+                for (size_t l = 0;  l < i;  ++l)
+                {
+                    sum += p_vr[l]*t[l] + p_wr[l]*t[i + l];
+                }
+                y[r] -= sum;
+                yv   += y[r] * v[r];
+            }
+
+            //- w = tau*y - (tau^2/2)(y'v)*v, so that H*A22*H = A22 - v*w' - w*v'.
+            //
+            T const     alpha = -tau[k] * tau[k] * yv / T(2);
+
+            for (size_t r = 0;  r < len;  ++r)
+            {
+                w[(k+1+r - j0)*nb + i] = tau[k]*y[r] + alpha*v[r];
+            }
+        }
+
+        //- Update the lower triangle of the trailing matrix, A22 <- A22 - V*W' - W*V', a block of
+        //  rows at a time; each block is updated up to the end of its diagonal block.
+        //
+        size_t const    t0 = j0 + nb;
+        size_t const    mt = n - t0;
+
+        wt.resize(nb*mt);
+        vt.resize(nb*mt);
+
+        for (size_t r = 0;  r < mt;  ++r)
+        {
+            for (size_t l = 0;  l < nb;  ++l)
+            {
+                wt[l*mt + r] = -w[(t0 + r - j0)*nb + l];
+                vt[l*mt + r] = -p_a[(t0 + r)*n + j0 + l];
+            }
+        }
+        for (size_t i0 = 0;  i0 < mt;  i0 += gemm_row_block)
+        {
+            size_t const    i1 = min(mt, i0 + gemm_row_block);
+            T* const        p_c = p_a + (t0 + i0)*n + t0;
+
+            gemm_kernel(i1 - i0, i1, nb, p_a + (t0 + i0)*n + j0, n, wt.data(), mt, p_c, n);
+            gemm_kernel(i1 - i0, i1, nb, w.data() + (t0 + i0 - j0)*nb, nb, vt.data(), mt, p_c, n);
+        }
+    }
+
+    for (size_t k = 0;  k < n;  ++k)
+    {
+        p_d[k] = p_a[k*n + k];
+    }
+
+    if (p_q != nullptr  &&  n > 0)
+    {
+        //- Reflector k is in column k of A, below the diagonal.
+        //
+        std::vector<T>  vq(n*nr);
+
+        for (size_t k = 0;  k < nr;  ++k)
+        {
+            for (size_t r = k+1;  r < n;  ++r)
+            {
+                vq[r*nr + k] = p_a[r*n + k];
+            }
+        }
+        form_householder_product(n, n, nr, 1, vq.data(), nr, tau.data(), p_q, n);
+    }
+}
+
+//==================================================================================================
+//  Implicit symmetric QR iteration with Wilkinson shifts on the tridiagonal matrix (p_d, p_e).
+//  On return the eigenvalues are at p_d, unsorted.  Each rotation is also applied to the columns
+//  of the (rows x n) block at p_q, if it is not null.  Returns false if the iteration fails to
+//  converge.
+//==================================================================================================
+//
+template<class T>
+bool
+tridiagonal_qr(size_t n, T* p_d, T* p_e, T* p_q, size_t rows)
+{
+    T const         eps      = numeric_limits<T>::epsilon();
+    size_t const    max_iter = 30*n;
+    size_t          iter     = 0;
+
+    auto    negligible = [&](size_t i)
+    {
+        return abs(p_e[i]) <= eps*(abs(p_d[i]) + abs(p_d[i+1]));
+    };
+
+    for (size_t hi = (n > 0) ? n-1 : 0;  hi > 0;  )
+    {
+        if (negligible(hi-1))
+        {
+            p_e[hi-1] = T(0);
+            --hi;
+            continue;
+        }
+
+        size_t  lo = hi - 1;
+
+        while (lo > 0  &&  !negligible(lo-1))
+        {
+            --lo;
+        }
+
+        if (++iter > max_iter) return false;
+
+        //- Wilkinson shift:  the eigenvalue of the trailing 2x2 block closest to d(hi).
+        //
+        T const     dd = (p_d[hi-1] - p_d[hi]) / T(2);
+        T const     eh = p_e[hi-1];
+        T const     mu = p_d[hi] - eh*eh / (dd + ((dd >= T(0)) ? hypot(dd, eh) : -hypot(dd, eh)));
+
+        //- Chase the bulge from the top of the block to the bottom.
+        //
+        T   x = p_d[lo] - mu;
+        T   z = p_e[lo];
+        T   c, s;
+
+        for (size_t k = lo;  k < hi;  ++k)
+        {
+            T const     r = make_rotation(x, z, c, s);
+
+            if (k > lo) p_e[k-1] = r;
+
+            T const     a = p_d[k];
+            T const     b = p_e[k];
+            T const     d = p_d[k+1];
+
+            p_d[k]   = c*c*a + T(2)*c*s*b + s*s*d;
+            p_d[k+1] = s*s*a - T(2)*c*s*b + c*c*d;
+            p_e[k]   = c*s*(d - a) + (c*c - s*s)*b;
+
+            if (k + 1 < hi)
+            {
+                x = p_e[k];
+                z = s*p_e[k+1];
+                p_e[k+1] *= c;
+            }
+
+            rotate_columns(p_q, n, rows, k, k+1, c, s);
+        }
+    }
+    return true;
+}
+
+//==================================================================================================
+//  Golub-Kahan reduction of the (m x n) row-major matrix at p_a, m >= n, to upper bidiagonal
+//  form, A = U * B * V'.  On return the diagonal of B is at p_d (n elements), the superdiagonal
+//  at p_e (n-1 elements), and if p_u/p_v are not null the first n columns of U are stored at p_u
+//  (m x n) and V at p_v (n x n).  A is destroyed.
+//
+//  The reduction is blocked.  For each panel of nb columns, left reflector k is stored in column k
+//  of A from the diagonal down, and right reflector k in row k of A right of the diagonal; the
+//  matrices X and Y are built such that applying the panel's reflectors to the trailing matrix is
+//  the update A22 <- A22 - V*Y' - X*U', where the columns of V and the rows of U are the
+//  reflectors.  Within the panel, each column and row, and each product with A22, is corrected
+//  for the reflectors before it; the trailing matrix itself is only updated, by the GEMM kernel,
+//  once the panel is complete.
+//==================================================================================================
+//
+template<class T>
+void
+bidiagonalize(size_t m, size_t n, T* p_a, T* p_d, T* p_e, T* p_u, T* p_v)
+{
+    std::vector<T>  tu(n), tv(n), uk(householder_block), t(2*householder_block), x, y, yt, xn;
+
+    for (size_t j0 = 0;  j0 < n;  j0 += householder_block)
+    {
+        size_t const    nb = min(householder_block, n - j0);
+
+        //- Row r of X is at x[(r - j0)*nb], row c of Y at y[(c - j0)*nb]; V(r, l) = A(r, j0+l),
+        //  and U(l, c) = A(j0+l, c).
+        //
+        x.assign((m - j0)*nb, T{});
+        y.assign((n - j0)*nb, T{});
+
+        for (size_t i = 0;  i < nb;  ++i)
+        {
+            size_t const    k = j0 + i;
+            T* const        p_ak = p_a + k*n;
+
+            //- Bring column k up to date:  A(k:m, k) -= V*Y(k, :)' + X*U(:, k).
+            //
+            T const* const  p_yk = y.data() + (k - j0)*nb;
+
+            for (size_t l = 0;  l < i;  ++l)
+            {
+                uk[l] = p_a[(j0 + l)*n + k];
+            }
+            for (size_t r = k;  r < m;  ++r)
+            {
+                T const*    p_vr = p_a + r*n + j0;
+                T const*    p_xr = x.data() + (r - j0)*nb;
+                T           sum  = 0;
+
+                for (size_t l = 0;  l < i;  ++l)
+                {
+                    sum += p_vr[l]*p_yk[l] + p_xr[l]*uk[l];
+                }
+                p_a[r*n + k] -= sum;
+            }
+
+            //- Left reflector:  annihilate A(k+1:m, k).
+            //
+            p_d[k] = make_householder(m - k, p_ak + k, n, tu[k]);
+
+            if (k + 1 == n) break;
+
+            size_t const    nt = n - k - 1;
+
+            //- Y(k+1:n, i) = tu * (A22'*v - Y*(V'*v) - U'*(X'*v)), over rows k:m.
+            //
+            T* const    p_yi = y.data() + (k+1 - j0)*nb + i;
+
+            fill_n(t.data(), 2*i, T{});
+
+            for (size_t r = k;  r < m;  ++r)
+            {
+                T const*    p_ar = p_a + r*n;
+                T const*    p_xr = x.data() + (r - j0)*nb;
+                T const     vr   = p_ar[k];
+
+                for (size_t c = 0;  c < nt;  ++c)
+                {
+                    p_yi[c*nb] += p_ar[k+1 + c] * vr;
+                }
+                for (size_t l = 0;  l < i;  ++l)
+                {
+                    t[l]     += p_ar[j0 + l] * vr;
+                    t[i + l] += p_xr[l] * vr;
+                }
+            }
+            for (size_t l = 0;  l < i;  ++l)
+            {
+                T const*    p_ul = p_a + (j0 + l)*n + k+1;
+
+                for (size_t c = 0;  c < nt;  ++c)
+                {
+                    p_yi[c*nb] -= p_yi[c*nb - i + l] * t[l] + p_ul[c] * t[i + l];
+                }
+            }
+            for (size_t c = 0;  c < nt;  ++c)
+            {
+                p_yi[c*nb] *= tu[k];
+            }
+
+            //- Bring row k up to date:  A(k, k+1:n) -= Y*V(k, :)' + U'*X(k, :)', where the
+            //  current column of V, whose element in row k is 1, is included.
+            //
+            T const* const  p_xk = x.data() + (k - j0)*nb;
+
+            for (size_t c = 0;  c < nt;  ++c)
+            {
+                T const*    p_yc = y.data() + (k+1 + c - j0)*nb;
+                T           sum  = 0;
+
+                for (size_t l = 0;  l <= i;  ++l)
+                {
+                    sum += p_yc[l] * p_ak[j0 + l];
+                }
+                p_ak[k+1 + c] -= sum;
+            }
+            for (size_t l = 0;  l < i;  ++l)
+            {
+                T const*    p_ul = p_a + (j0 + l)*n + k+1;
+                T const     xkl  = p_xk[l];
+
+                for (size_t c = 0;  c < nt;  ++c)
+                {
+                    p_ak[k+1 + c] -= p_ul[c] * xkl;
+                }
+            }
+
+            //- Right reflector:  annihilate A(k, k+2:n).
+            //
+            T* const    p_uk = p_ak + k+1;
+
+            p_e[k] = make_householder(nt, p_uk, 1, tv[k]);
+
+            //- X(k+1:m, i) = tv * (A22*u - V*(Y'*u) - X*(U*u)), over columns k+1:n.
+            //
+            fill_n(t.data(), 2*i + 1, T{});
+
+            for (size_t c = 0;  c < nt;  ++c)
+            {
+                T const*    p_yc = y.data() + (k+1 + c - j0)*nb;
+
+                for (size_t l = 0;  l <= i;  ++l)
+                {
+                    t[l] += p_yc[l] * p_uk[c];
+                }
+            }
+            for (size_t l = 0;  l < i;  ++l)
+            {
+                T const*    p_ul = p_a + (j0 + l)*n + k+1;
+                T           sum  = 0;
+
+                for (size_t c = 0;  c < nt;  ++c)
+                {
+                    sum += p_ul[c] * p_uk[c];
+                }
+                t[i+1 + l] = sum;
+            }
+            for (size_t r = k+1;  r < m;  ++r)
+            {
+                T const*    p_ar = p_a + r*n;
+                T*          p_xr = x.data() + (r - j0)*nb;
+                T           sum  = 0;
+
+                for (size_t c = 0;  c < nt;  ++c)
+                {
+                    sum += p_ar[k+1 + c] * p_uk[c];
+                }
+                for (size_t l = 0;  l <= i;  ++l)
+                {
+                    sum -= p_ar[j0 + l] * t[l];
+                }
+                for (size_t l = 0;  l < i;  ++l)
+                {
+                    sum -= p_xr[l] * t[i+1 + l];
+                }
+                p_xr[i] = tv[k] * sum;
+            }
+        }
+
+        //- Update the trailing matrix, A22 <- A22 - V*Y' - X*U.
+        //
+        size_t const    t0 = j0 + nb;
+
+        if (t0 < n)
+        {
+            size_t const    mt = m - t0;
+            size_t const    nt = n - t0;
+
+            yt.resize(nb*nt);
+            xn.resize(mt*nb);
+
+            for (size_t c = 0;  c < nt;  ++c)
+            {
+                for (size_t l = 0;  l < nb;  ++l)
+                {
+                    yt[l*nt + c] = -y[(t0 + c - j0)*nb + l];
+                }
+            }
+            for (size_t r = 0;  r < mt;  ++r)
+            {
+                for (size_t l = 0;  l < nb;  ++l)
+                {
+                    xn[r*nb + l] = -x[(t0 + r - j0)*nb + l];
+                }
+            }
+
+            T* const    p_c = p_a + t0*n + t0;
+
+            gemm_kernel(mt, nt, nb, p_a + t0*n + j0, n, yt.data(), nt, p_c, n);
+            gemm_kernel(mt, nt, nb, xn.data(), nb, p_a + j0*n + t0, n, p_c, n);
+        }
+    }
+
+    if (p_u != nullptr)
+    {
+        std::vector<T>  vu(m*n);
+
+        for (size_t k = 0;  k < n;  ++k)
+        {
+            for (size_t r = k;  r < m;  ++r)
+            {
+                vu[r*n + k] = p_a[r*n + k];
+            }
+        }
+        form_householder_product(m, n, n, 0, vu.data(), n, tu.data(), p_u, n);
+    }
+    if (p_v != nullptr)
+    {
+        std::vector<T>  vv(n*n);
+
+        for (size_t k = 0;  k + 1 < n;  ++k)
+        {
+            for (size_t c = k+1;  c < n;  ++c)
+            {
+                vv[c*n + k] = p_a[k*n + c];
+            }
+        }
+        form_householder_product(n, n, (n > 1) ? n-1 : 0, 1, vv.data(), n, tv.data(), p_v, n);
+    }
+}
+
+//==================================================================================================
+//  Implicit-shift QR iteration (Golub-Kahan SVD step) on the upper bidiagonal matrix (p_d, p_e).
+//  On return the singular values are at p_d, unsorted and possibly negative.  Left rotations are
+//  applied to the columns of the (urows x n) block at p_u, and right rotations to the columns of
+//  the (n x n) block at p_v, when these are not null.  Returns false if the iteration fails to
+//  converge.
+//==================================================================================================
+//
+template<class T>
+bool
+bidiagonal_qr(size_t n, T* p_d, T* p_e, T* p_u, size_t urows, T* p_v)
+{
+    T const         eps      = numeric_limits<T>::epsilon();
+    size_t const    max_iter = 30*n;
+    size_t          iter     = 0;
+    T               anorm    = 0;
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        anorm = max(anorm, abs(p_d[i]) + ((i + 1 < n) ? abs(p_e[i]) : T(0)));
+    }
+
+    T const     tol = eps * anorm;
+
+    auto    negligible = [&](size_t i)
+    {
+        return abs(p_e[i]) <= eps*(abs(p_d[i]) + abs(p_d[i+1]));
+    };
+
+    for (size_t hi = (n > 0) ? n-1 : 0;  hi > 0;  )
+    {
+        if (negligible(hi-1))
+        {
+            p_e[hi-1] = T(0);
+            --hi;
+            continue;
+        }
+
+        size_t  lo = hi - 1;
+
+        while (lo > 0  &&  !negligible(lo-1))
+        {
+            --lo;
+        }
+
+        if (++iter > max_iter) return false;
+
+        T   c, s, f;
+
+        //- A zero on the diagonal splits the problem once the superdiagonal element in its row
+        //  (or, for the last row, in its column) has been chased out with plane rotations.
+        //
+        size_t  iz = lo;
+
+        while (iz <= hi  &&  abs(p_d[iz]) > tol)
+        {
+            ++iz;
+        }
+
+        if (iz < hi)
+        {
+            p_d[iz] = T(0);
+            f = p_e[iz];
+            p_e[iz] = T(0);
+
+            for (size_t j = iz+1;  j <= hi;  ++j)
+            {
+                p_d[j] = make_rotation(p_d[j], f, c, s);
+                if (j < hi)
+                {
+                    f = -s*p_e[j];
+                    p_e[j] *= c;
+                }
+                rotate_columns(p_u, n, urows, j, iz, c, s);
+            }
+            continue;
+        }
+        else if (iz == hi)
+        {
+            p_d[hi] = T(0);
+            f = p_e[hi-1];
+            p_e[hi-1] = T(0);
+
+            for (size_t j = hi;  j-- > lo;  )
+            {
+                p_d[j] = make_rotation(p_d[j], f, c, s);
+                if (j > lo)
+                {
+                    f = -s*p_e[j-1];
+                    p_e[j-1] *= c;
+                }
+                rotate_columns(p_v, n, n, j, hi, c, s);
+            }
+            continue;
+        }
+
+        //- Wilkinson shift from the trailing 2x2 block of B'B.
+        //
+        T const     dm  = p_d[hi-1];
+        T const     em  = p_e[hi-1];
+        T const     t11 = dm*dm + ((hi - 1 > lo) ? p_e[hi-2]*p_e[hi-2] : T(0));
+        T const     t12 = dm*em;
+        T const     t22 = p_d[hi]*p_d[hi] + em*em;
+        T const     dd  = (t11 - t22) / T(2);
+        T const     den = dd + ((dd >= T(0)) ? hypot(dd, t12) : -hypot(dd, t12));
+        T const     mu  = (den != T(0)) ? t22 - t12*t12/den : t22;
+
+        //- Chase the bulge, alternating right (V) and left (U) rotations.
+        //
+        T   y = p_d[lo]*p_d[lo] - mu;
+        T   z = p_d[lo]*p_e[lo];
+
+        for (size_t k = lo;  k < hi;  ++k)
+        {
+            T   r = make_rotation(y, z, c, s);
+
+            if (k > lo) p_e[k-1] = r;
+
+            T   a = p_d[k];
+            T   b = p_e[k];
+
+            p_d[k]    = c*a + s*b;
+            p_e[k]    = c*b - s*a;
+            z         = s*p_d[k+1];
+            p_d[k+1] *= c;
+            rotate_columns(p_v, n, n, k, k+1, c, s);
+
+            p_d[k] = make_rotation(p_d[k], z, c, s);
+
+            a = p_e[k];
+            b = p_d[k+1];
+            p_e[k]   = c*a + s*b;
+            p_d[k+1] = c*b - s*a;
+
+            if (k + 1 < hi)
+            {
+                y = p_e[k];
+                z = s*p_e[k+1];
+                p_e[k+1] *= c;
+            }
+            rotate_columns(p_u, n, urows, k, k+1, c, s);
+        }
+    }
+    return true;
+}
+
+//- Copies a readable matrix into a row-major buffer, optionally transposed.
+//
+template<class T, class ET, class OT>
+void
+copy_to_buffer(matrix<ET, OT> const& m, T* p_dst, bool transposed)
+{
+    using size_type = typename matrix<ET, OT>::size_type;
+
+    size_t const    rows = static_cast<size_t>(m.rows());
+    size_t const    cols = static_cast<size_t>(m.columns());
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            T const     x = static_cast<T>(m(static_cast<size_type>(i), static_cast<size_type>(j)));
+
+            if (transposed)
+                p_dst[j*rows + i] = x;
+            else
+                p_dst[i*cols + j] = x;
+        }
+    }
+}
+
+}       //- detail namespace
+//==================================================================================================
+//                              **** SYMMETRIC EIGENSYSTEM ****
+//==================================================================================================
+//  Computes the eigenvalues, in ascending order, and the corresponding orthonormal eigenvectors,
+//  stored as columns, of the real symmetric matrix m.  Only the lower triangle of m is read.
+//==================================================================================================
+//
+template<class ET, class OT>
+auto
+symmetric_eigensystem(matrix<ET, OT> const& m)
+    -> tuple<dyn_vector<remove_cv_t<typename ET::element_type>>,
+             dyn_matrix<remove_cv_t<typename ET::element_type>>>
+{
+    using elem_type = remove_cv_t<typename ET::element_type>;
+    using vec_type  = dyn_vector<elem_type>;
+    using mat_type  = dyn_matrix<elem_type>;
+    using size_type = typename mat_type::size_type;
+
+    static_assert(is_floating_point_v<elem_type>, "eigensystem requires floating-point elements");
+
+    if (m.rows() != m.columns())
+    {
+        throw runtime_error("non-square matrix");
+    }
+
+    size_t const    n = static_cast<size_t>(m.rows());
+
+    std::vector<elem_type>  a(n*n), q(n*n), d(n), e(n);
+
+    detail::copy_to_buffer(m, a.data(), false);
+
+    detail::tridiagonalize(n, a.data(), d.data(), e.data(), q.data());
+
+    if (!detail::tridiagonal_qr(n, d.data(), e.data(), q.data(), n))
+    {
+        throw runtime_error("eigenvalue iteration failed to converge");
+    }
+
+    std::vector<size_t>     idx(n);
+
+    iota(idx.begin(), idx.end(), size_t(0));
+    sort(idx.begin(), idx.end(), [&](size_t i, size_t j){ return d[i] < d[j]; });
+
+    vec_type    w(static_cast<size_type>(n));
+    mat_type    z(static_cast<size_type>(n), static_cast<size_type>(n));
+
+    for (size_t j = 0;  j < n;  ++j)
+    {
+        w(static_cast<size_type>(j)) = d[idx[j]];
+
+        for (size_t i = 0;  i < n;  ++i)
+        {
+            z(static_cast<size_type>(i), static_cast<size_type>(j)) = q[i*n + idx[j]];
+        }
+    }
+
+    return {std::move(w), std::move(z)};
+}
+
+//- Eigenvalues only, in ascending order.  The reflectors are never accumulated, so this is
+//  considerably cheaper than computing the full eigensystem.
+//
+template<class ET, class OT>
+auto
+symmetric_eigenvalues(matrix<ET, OT> const& m) -> dyn_vector<remove_cv_t<typename ET::element_type>>
+{
+    using elem_type = remove_cv_t<typename ET::element_type>;
+    using vec_type  = dyn_vector<elem_type>;
+    using size_type = typename vec_type::size_type;
+
+    static_assert(is_floating_point_v<elem_type>, "eigenvalues require floating-point elements");
+
+    if (m.rows() != m.columns())
+    {
+        throw runtime_error("non-square matrix");
+    }
+
+    size_t const    n = static_cast<size_t>(m.rows());
+
+    std::vector<elem_type>  a(n*n), d(n), e(n);
+
+    detail::copy_to_buffer(m, a.data(), false);
+
+    detail::tridiagonalize(n, a.data(), d.data(), e.data(), static_cast<elem_type*>(nullptr));
+
+    if (!detail::tridiagonal_qr(n, d.data(), e.data(), static_cast<elem_type*>(nullptr), n))
+    {
+        throw runtime_error("eigenvalue iteration failed to converge");
+    }
+
+    sort(d.begin(), d.end());
+
+    vec_type    w(static_cast<size_type>(n));
+
+    for (size_t j = 0;  j < n;  ++j)
+    {
+        w(static_cast<size_type>(j)) = d[j];
+    }
+    return w;
+}
+
+//==================================================================================================
+//                            **** SINGULAR VALUE DECOMPOSITION ****
+//==================================================================================================
+//  Computes the thin SVD of the (m x n) matrix a:  returns (U, s, V), where s holds the p =
+//  min(m, n) singular values in descending order, and the columns of U (m x p) and V (n x p) are
+//  the corresponding left and right singular vectors.  Wide matrices are handled by decomposing
+//  the transpose.
+//==================================================================================================
+//
+template<class ET, class OT>
+auto
+singular_value_decomposition(matrix<ET, OT> const& a)
+    -> tuple<dyn_matrix<remove_cv_t<typename ET::element_type>>,
+             dyn_vector<remove_cv_t<typename ET::element_type>>,
+             dyn_matrix<remove_cv_t<typename ET::element_type>>>
+{
+    using elem_type = remove_cv_t<typename ET::element_type>;
+    using vec_type  = dyn_vector<elem_type>;
+    using mat_type  = dyn_matrix<elem_type>;
+    using size_type = typename mat_type::size_type;
+
+    static_assert(is_floating_point_v<elem_type>, "SVD requires floating-point elements");
+
+    size_t const    rows = static_cast<size_t>(a.rows());
+    size_t const    cols = static_cast<size_t>(a.columns());
+    bool const      wide = rows < cols;
+    size_t const    m    = wide ? cols : rows;
+    size_t const    n    = wide ? rows : cols;
+
+    std::vector<elem_type>  b(m*n), u(m*n), v(n*n), d(n), e(n);
+
+    detail::copy_to_buffer(a, b.data(), wide);
+    detail::bidiagonalize(m, n, b.data(), d.data(), e.data(), u.data(), v.data());
+
+    if (!detail::bidiagonal_qr(n, d.data(), e.data(), u.data(), m, v.data()))
+    {
+        throw runtime_error("SVD iteration failed to converge");
+    }
+
+    for (size_t j = 0;  j < n;  ++j)
+    {
+        if (d[j] < elem_type(0))
+        {
+            d[j] = -d[j];
+            for (size_t i = 0;  i < n;  ++i)
+            {
+                v[i*n + j] = -v[i*n + j];
+            }
+        }
+    }
+
+    std::vector<size_t>     idx(n);
+
+    iota(idx.begin(), idx.end(), size_t(0));
+    sort(idx.begin(), idx.end(), [&](size_t i, size_t j){ return d[i] > d[j]; });
+
+    //- For a wide matrix, A' = U*S*V', so the roles of U and V are exchanged.
+    //
+    std::vector<elem_type> const&   left  = wide ? v : u;
+    std::vector<elem_type> const&   right = wide ? u : v;
+
+    vec_type    sv(static_cast<size_type>(n));
+    mat_type    mu(static_cast<size_type>(rows), static_cast<size_type>(n));
+    mat_type    mv(static_cast<size_type>(cols), static_cast<size_type>(n));
+
+    for (size_t j = 0;  j < n;  ++j)
+    {
+        sv(static_cast<size_type>(j)) = d[idx[j]];
+
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            mu(static_cast<size_type>(i), static_cast<size_type>(j)) = left[i*n + idx[j]];
+        }
+        for (size_t i = 0;  i < cols;  ++i)
+        {
+            mv(static_cast<size_type>(i), static_cast<size_type>(j)) = right[i*n + idx[j]];
+        }
+    }
+
+    return {std::move(mu), std::move(sv), std::move(mv)};
+}
+
+//- Singular values only, in descending order.
+//
+template<class ET, class OT>
+auto
+singular_values(matrix<ET, OT> const& a) -> dyn_vector<remove_cv_t<typename ET::element_type>>
+{
+    using elem_type = remove_cv_t<typename ET::element_type>;
+    using vec_type  = dyn_vector<elem_type>;
+    using size_type = typename vec_type::size_type;
+
+    static_assert(is_floating_point_v<elem_type>, "SVD requires floating-point elements");
+
+    size_t const    rows = static_cast<size_t>(a.rows());
+    size_t const    cols = static_cast<size_t>(a.columns());
+    bool const      wide = rows < cols;
+    size_t const    m    = wide ? cols : rows;
+    size_t const    n    = wide ? rows : cols;
+
+    std::vector<elem_type>  b(m*n), d(n), e(n);
+
+    detail::copy_to_buffer(a, b.data(), wide);
+    detail::bidiagonalize(m, n, b.data(), d.data(), e.data(),
+                          static_cast<elem_type*>(nullptr), static_cast<elem_type*>(nullptr));
+
+    if (!detail::bidiagonal_qr(n, d.data(), e.data(), static_cast<elem_type*>(nullptr), m,
+                               static_cast<elem_type*>(nullptr)))
+    {
+        throw runtime_error("SVD iteration failed to converge");
+    }
+
+    for (auto& x : d)
+    {
+        x = abs(x);
+    }
+    sort(d.begin(), d.end(), [](elem_type x, elem_type y){ return x > y; });
+
+    vec_type    sv(static_cast<size_type>(n));
+
+    for (size_t j = 0;  j < n;  ++j)
+    {
+        sv(static_cast<size_type>(j)) = d[j];
+    }
+    return sv;
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_SPECTRAL_DECOMPOSITIONS_HPP_DEFINED
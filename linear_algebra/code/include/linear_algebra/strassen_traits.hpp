@@ -0,0 +1,294 @@
+//==================================================================================================
+//  File:       strassen_traits.hpp
+//
+//  Summary:    This header defines an operation traits type, and its associated multiplication
+//              traits, that compute large matrix*matrix products with the recursive Winograd
+//              variant of Strassen's algorithm.  All other operations, and products that are too
+//              small to benefit, are forwarded to the library's standard traits.
+//
+//              Usage:
+//                  using fast_ops = strassen_operation_traits<128>;
+//                  matrix<dr_matrix_engine<double, allocator<double>>, fast_ops>  a, b;
+//                  auto    c = a * b;
+//
+//              Error bounds:  Strassen-type algorithms do not satisfy the component-wise bound
+//              |C - fl(AB)| <= k*u*|A||B| that holds for the classical algorithm.  They satisfy
+//              only a norm-wise bound.  With n the (padded) dimension, n0 the cutoff at which the
+//              recursion switches to the classical kernel, u the unit roundoff, and ||X|| the
+//              largest absolute element of X, the Winograd variant used here satisfies (Higham,
+//              "Accuracy and Stability of Numerical Algorithms", 2nd ed., section 23.2.2):
+//
+//                  ||C - fl(AB)|| <= [ (n/n0)^log2(18) * (n0^2 + 6*n0) - 6*n ] * u * ||A|| ||B||
+//
+//              to first order in u; log2(18) is approximately 4.17.  Each halving of the cutoff
+//              therefore loosens the bound by roughly a factor of 18/4, so the cutoff should not
+//              be set lower than is needed for speed.  Products of matrices whose rows/columns
+//              are badly scaled can lose accuracy relative to the classical algorithm and should
+//              be equilibrated first, or computed with the default operation traits.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_STRASSEN_TRAITS_HPP_DEFINED
+#define LINEAR_ALGEBRA_STRASSEN_TRAITS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Traits type to extract the recursion cutoff from an operation traits type.  Operation traits
+//  types that do not provide a nested 'strassen_cutoff' member get the default value.
+//==================================================================================================
+//
+inline constexpr size_t     default_strassen_cutoff = 128;
+
+template<class OT, class = void>
+struct strassen_cutoff
+:   public integral_constant<size_t, default_strassen_cutoff>
+{};
+
+template<class OT>
+struct strassen_cutoff<OT, void_t<decltype(OT::strassen_cutoff)>>
+:   public integral_constant<size_t, OT::strassen_cutoff>
+{};
+
+template<class OT> inline constexpr
+size_t  strassen_cutoff_v = strassen_cutoff<OT>::value;
+
+//==================================================================================================
+//  Returns the number of workspace elements needed by strassen_winograd() for a product of the
+//  given (padded) dimensions, recursing to the given depth.
+//==================================================================================================
+//
+inline size_t
+strassen_workspace_size(size_t m, size_t n, size_t k, size_t depth)
+{
+    size_t  total = 0;
+
+    for (;  depth > 0;  --depth)
+    {
+        m /= 2;
+        n /= 2;
+        k /= 2;
+        total += m*k + k*n + 2*m*n;
+    }
+    return total;
+}
+
+//==================================================================================================
+//  Recursive Strassen-Winograd product:  C(m x n) = A(m x k) * B(k x n).  All dimensions must be
+//  divisible by 2^depth.  Each level of the recursion uses four temporaries,
+//
+//      X (m/2 x k/2),  Y (k/2 x n/2),  Z (m/2 x n/2),  W (m/2 x n/2),
+//
+//  carved from the front of the workspace pointed to by p_ws; deeper levels use the remainder.
+//  The schedule below computes the seven products and fifteen additions of the Winograd variant
+//  while writing directly into the quadrants of C.
+//==================================================================================================
+//
+template<class T>
+void
+strassen_winograd(size_t m, size_t n, size_t k,
+                  T const* p_a, size_t lda,
+                  T const* p_b, size_t ldb,
+                  T*       p_c, size_t ldc,
+                  size_t depth, T* p_ws)
+{
+    if (depth == 0)
+    {
+        gemm_assign_kernel(m, n, k, p_a, lda, p_b, ldb, p_c, ldc);
+        return;
+    }
+
+    size_t const    mh = m/2;
+    size_t const    nh = n/2;
+    size_t const    kh = k/2;
+
+    T const*    a11 = p_a;
+    T const*    a12 = p_a + kh;
+    T const*    a21 = p_a + mh*lda;
+    T const*    a22 = p_a + mh*lda + kh;
+    T const*    b11 = p_b;
+    T const*    b12 = p_b + nh;
+    T const*    b21 = p_b + kh*ldb;
+    T const*    b22 = p_b + kh*ldb + nh;
+    T*          c11 = p_c;
+    T*          c12 = p_c + nh;
+    T*          c21 = p_c + mh*ldc;
+    T*          c22 = p_c + mh*ldc + nh;
+
+    T*  p_x    = p_ws;
+    T*  p_y    = p_x + mh*kh;
+    T*  p_z    = p_y + kh*nh;
+    T*  p_w    = p_z + mh*nh;
+    T*  p_next = p_w + mh*nh;
+
+    size_t const    d = depth - 1;
+
+    sub_kernel(mh, kh, a11, lda, a21, lda, p_x, kh);                //- X = S3 = A11 - A21
+    sub_kernel(kh, nh, b22, ldb, b12, ldb, p_y, nh);                //- Y = T3 = B22 - B12
+    strassen_winograd(mh, nh, kh, p_x, kh, p_y, nh, c21, ldc, d, p_next);      //- C21 = P7
+
+    add_kernel(mh, kh, a21, lda, a22, lda, p_x, kh);                //- X = S1 = A21 + A22
+    sub_kernel(kh, nh, b12, ldb, b11, ldb, p_y, nh);                //- Y = T1 = B12 - B11
+    strassen_winograd(mh, nh, kh, p_x, kh, p_y, nh, c22, ldc, d, p_next);      //- C22 = P5
+
+    sub_kernel(mh, kh, p_x, kh, a11, lda, p_x, kh);                 //- X = S2 = S1 - A11
+    sub_kernel(kh, nh, b22, ldb, p_y, nh, p_y, nh);                 //- Y = T2 = B22 - T1
+    strassen_winograd(mh, nh, kh, p_x, kh, p_y, nh, p_z, nh, d, p_next);       //- Z = P6
+
+    sub_kernel(mh, kh, a12, lda, p_x, kh, p_x, kh);                 //- X = S4 = A12 - S2
+    strassen_winograd(mh, nh, kh, p_x, kh, b22, ldb, c12, ldc, d, p_next);     //- C12 = P3
+
+    sub_kernel(kh, nh, p_y, nh, b21, ldb, p_y, nh);                 //- Y = T4 = T2 - B21
+    strassen_winograd(mh, nh, kh, a22, lda, p_y, nh, p_w, nh, d, p_next);      //- W = P4
+
+    strassen_winograd(mh, nh, kh, a11, lda, b11, ldb, c11, ldc, d, p_next);    //- C11 = P1
+
+    add_kernel(mh, nh, p_z, nh, c11, ldc, p_z, nh);                 //- Z   = U2 = P1 + P6
+    add_kernel(mh, nh, c21, ldc, p_z, nh, c21, ldc);                //- C21 = U3 = U2 + P7
+    add_kernel(mh, nh, p_z, nh, c22, ldc, p_z, nh);                 //- Z   = U4 = U2 + P5
+    add_kernel(mh, nh, c21, ldc, c22, ldc, c22, ldc);               //- C22 = U7 = U3 + P5
+    sub_kernel(mh, nh, c21, ldc, p_w, nh, c21, ldc);                //- C21 = U6 = U3 - P4
+    add_kernel(mh, nh, p_z, nh, c12, ldc, c12, ldc);                //- C12 = U5 = U4 + P3
+
+    strassen_winograd(mh, nh, kh, a12, lda, b21, ldb, p_w, nh, d, p_next);     //- W = P2
+    add_kernel(mh, nh, c11, ldc, p_w, nh, c11, ldc);                //- C11 = U1 = P1 + P2
+}
+
+}       //- detail namespace
+//==================================================================================================
+//                              **** STRASSEN OPERATION TRAITS ****
+//==================================================================================================
+//  Operation traits type that selects Strassen-Winograd multiplication.  The template parameter
+//  is the recursion cutoff: once the smallest dimension of a sub-product is at or below this
+//  value, the blocked classical kernel is used.  Everything else is inherited from the default
+//  operation traits.
+//==================================================================================================
+//
+template<size_t CO = detail::default_strassen_cutoff>
+struct strassen_operation_traits : public matrix_operation_traits
+{
+    static_assert(CO >= 1);
+
+    static constexpr size_t     strassen_cutoff = CO;
+
+    template<class OTR, class OP1, class OP2>
+    using multiplication_traits = strassen_multiplication_traits<OTR, OP1, OP2>;
+};
+
+//==================================================================================================
+//                            **** STRASSEN MULTIPLICATION TRAITS ****
+//==================================================================================================
+//  All cases other than matrix*matrix are handled by the standard multiplication traits.
+//==================================================================================================
+//
+template<class OT, class OP1, class OP2>
+struct strassen_multiplication_traits
+:   public matrix_multiplication_traits<OT, OP1, OP2>
+{};
+
+//---------------
+//- matrix*matrix
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct strassen_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+:   public matrix_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using base_traits  = matrix_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>;
+    using engine_type  = typename base_traits::engine_type;
+    using op_traits    = typename base_traits::op_traits;
+    using result_type  = typename base_traits::result_type;
+
+    using size_type_1 = typename base_traits::size_type_1;
+    using size_type_2 = typename base_traits::size_type_2;
+    using size_type_r = typename base_traits::size_type_r;
+
+    static result_type  multiply(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+auto
+strassen_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    using elem_type = typename result_type::element_type;
+
+    size_t const    rows   = static_cast<size_t>(m1.rows());
+    size_t const    cols   = static_cast<size_t>(m2.columns());
+    size_t const    inner  = static_cast<size_t>(m1.columns());
+    size_t const    cutoff = detail::strassen_cutoff_v<OT>;
+    size_t const    min_dim = min(rows, min(cols, inner));
+
+    //- Products that are too small to recurse even once go to the classical algorithm.
+    //
+    if (min_dim <= cutoff)
+    {
+        return base_traits::multiply(m1, m2);
+    }
+
+    PrintOperandTypes<result_type>("strassen_multiplication_traits (m*m)", m1, m2);
+
+    //- Recurse until the smallest dimension is at or below the cutoff, and pad every dimension
+    //  up to a multiple of 2^depth.  The padding is zero-filled and does not affect the result.
+    //
+    size_t  depth = 0;
+
+    while (((min_dim + (size_t(1) << depth) - 1) >> depth) > cutoff)
+    {
+        ++depth;
+    }
+
+    size_t const    mult = size_t(1) << depth;
+    size_t const    mp   = ((rows  + mult - 1) / mult) * mult;
+    size_t const    np   = ((cols  + mult - 1) / mult) * mult;
+    size_t const    kp   = ((inner + mult - 1) / mult) * mult;
+
+    //- All storage used by the algorithm, including the padded copies of the operands and the
+    //  product, comes from a single arena.
+    //
+    size_t const            ws_size = detail::strassen_workspace_size(mp, np, kp, depth);
+    std::vector<elem_type>  arena(mp*kp + kp*np + mp*np + ws_size);
+
+    elem_type*  p_a  = arena.data();
+    elem_type*  p_b  = p_a + mp*kp;
+    elem_type*  p_c  = p_b + kp*np;
+    elem_type*  p_ws = p_c + mp*np;
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        for (size_t k = 0;  k < inner;  ++k)
+        {
+            p_a[i*kp + k] = static_cast<elem_type>(m1(static_cast<size_type_1>(i),
+                                                      static_cast<size_type_1>(k)));
+        }
+    }
+
+    for (size_t k = 0;  k < inner;  ++k)
+    {
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            p_b[k*np + j] = static_cast<elem_type>(m2(static_cast<size_type_2>(k),
+                                                      static_cast<size_type_2>(j)));
+        }
+    }
+
+    detail::strassen_winograd(mp, np, kp, p_a, kp, p_b, np, p_c, np, depth, p_ws);
+
+    result_type     mr;
+
+    if constexpr (result_requires_resize(mr))
+    {
+        mr.resize(static_cast<size_type_r>(rows), static_cast<size_type_r>(cols));
+    }
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            mr(static_cast<size_type_r>(i), static_cast<size_type_r>(j)) = p_c[i*np + j];
+        }
+    }
+
+    return mr;
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_STRASSEN_TRAITS_HPP_DEFINED
@@ -0,0 +1,497 @@
+//==================================================================================================
+//  File:       strided_engines.hpp
+//
+//  Summary:    This header defines engines that act as flat, strided "views" of the storage of
+//              an owning engine.  They are the result of taking a view of a view.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_STRIDED_ENGINES_HPP_DEFINED
+#define LINEAR_ALGEBRA_STRIDED_ENGINES_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Description of a strided (rows x cols) view of dense storage:  element (i, j) is located at
+//  p + i*rs + j*cs.  Every view-of-a-view can be described this way, and the member functions
+//  below compute the description of a further view in O(1).
+//==================================================================================================
+//
+template<class P>
+struct strided_view
+{
+    P           p;
+    size_t      rows;
+    size_t      cols;
+    ptrdiff_t   rs;
+    ptrdiff_t   cs;
+
+    constexpr strided_view  transposed() const noexcept;
+    constexpr strided_view  submatrix(size_t ri, size_t rn, size_t ci, size_t cn) const noexcept;
+    constexpr strided_view  row(size_t i) const noexcept;
+    constexpr strided_view  column(size_t j) const noexcept;
+    constexpr strided_view  diagonal(ptrdiff_t k) const noexcept;
+};
+
+//- Views of rows, columns, and diagonals are described as (1 x n) views, whose column stride is
+//  the vector stride.
+//
+template<class P> constexpr
+strided_view<P>
+strided_view<P>::transposed() const noexcept
+{
+    return strided_view{p, cols, rows, cs, rs};
+}
+
+template<class P> constexpr
+strided_view<P>
+strided_view<P>::submatrix(size_t ri, size_t rn, size_t ci, size_t cn) const noexcept
+{
+    return strided_view{p + (ptrdiff_t(ri)*rs + ptrdiff_t(ci)*cs), rn, cn, rs, cs};
+}
+
+template<class P> constexpr
+strided_view<P>
+strided_view<P>::row(size_t i) const noexcept
+{
+    return strided_view{p + ptrdiff_t(i)*rs, 1, cols, 0, cs};
+}
+
+template<class P> constexpr
+strided_view<P>
+strided_view<P>::column(size_t j) const noexcept
+{
+    return strided_view{p + ptrdiff_t(j)*cs, 1, rows, 0, rs};
+}
+
+template<class P> constexpr
+strided_view<P>
+strided_view<P>::diagonal(ptrdiff_t k) const noexcept
+{
+    size_t const    r0 = (k < 0) ? size_t(-k) : 0;
+    size_t const    c0 = (k > 0) ? size_t(k) : 0;
+
+    if (r0 >= rows  ||  c0 >= cols)
+    {
+        return strided_view{p, 1, 0, 0, rs + cs};
+    }
+    return strided_view{p + (ptrdiff_t(r0)*rs + ptrdiff_t(c0)*cs), 1, min(rows - r0, cols - c0),
+                        0, rs + cs};
+}
+
+//- Computes the strided description of a view engine whose elements are references into dense
+//  storage, using only its public interface.
+//
+template<class ET>
+constexpr auto
+make_strided_view(ET& eng) -> strided_view<decltype(&eng(0, 0))>
+{
+    using view_type = strided_view<decltype(&eng(0, 0))>;
+
+    view_type   sv{nullptr, static_cast<size_t>(eng.rows()), static_cast<size_t>(eng.columns()), 0, 0};
+
+    if (sv.rows != 0  &&  sv.cols != 0)
+    {
+        sv.p = &eng(0, 0);
+        if (sv.rows > 1) sv.rs = &eng(1, 0) - sv.p;
+        if (sv.cols > 1) sv.cs = &eng(0, 1) - sv.p;
+    }
+    return sv;
+}
+
+//==================================================================================================
+//  Traits that determine whether a matrix engine is a view (of any depth) of an owning engine
+//  that has data(), so that views taken of it can be collapsed to strided engines, and if so,
+//  the type of that owning engine.
+//==================================================================================================
+//
+template<class ET>
+struct strided_view_traits
+{
+    static constexpr bool   is_collapsible = false;
+    using root_type = ET;
+};
+
+template<class ET, class MCT>
+struct strided_view_traits<transpose_engine<ET, MCT>>
+{
+    static constexpr bool   is_collapsible = has_data_v<ET> || strided_view_traits<ET>::is_collapsible;
+    using root_type = typename strided_view_traits<ET>::root_type;
+};
+
+template<class ET, class MCT>
+struct strided_view_traits<submatrix_engine<ET, MCT>>
+{
+    static constexpr bool   is_collapsible = has_data_v<ET> || strided_view_traits<ET>::is_collapsible;
+    using root_type = typename strided_view_traits<ET>::root_type;
+};
+
+template<class ET, class MCT>
+struct strided_view_traits<strided_matrix_engine<ET, MCT>>
+{
+    static constexpr bool   is_collapsible = true;
+    using root_type = ET;
+};
+
+template<class ET> inline constexpr
+bool    is_collapsible_view_v = strided_view_traits<ET>::is_collapsible;
+
+template<class ET>
+using view_root_t = typename strided_view_traits<ET>::root_type;
+
+}       //- detail namespace
+//==================================================================================================
+//  Strided matrix engine, meant to act as a "view" of any rectangular, regularly-strided portion
+//  of the storage of the owning engine ET.  Element access costs one multiply-add per index,
+//  regardless of how many views were composed to produce it.
+//==================================================================================================
+//
+template<class ET, class MCT>
+class strided_matrix_engine
+{
+    static_assert(is_matrix_engine_v<ET>);
+    static_assert(is_matrix_engine_tag<MCT>);
+
+  public:
+    //- Types
+    //
+    using engine_category = MCT;
+    using element_type    = typename ET::element_type;
+    using value_type      = typename ET::value_type;
+    using pointer         = detail::noe_pointer_t<ET, MCT>;
+    using const_pointer   = typename ET::const_pointer;
+    using reference       = detail::noe_reference_t<ET, MCT>;
+    using const_reference = typename ET::const_reference;
+    using difference_type = typename ET::difference_type;
+    using size_type       = typename ET::size_type;
+    using size_tuple      = typename ET::size_tuple;
+
+    //- Construct/copy/destroy
+    //
+    ~strided_matrix_engine() noexcept = default;
+
+    constexpr strided_matrix_engine();
+    constexpr strided_matrix_engine(strided_matrix_engine&&) noexcept = default;
+    constexpr strided_matrix_engine(strided_matrix_engine const&) = default;
+
+    constexpr strided_matrix_engine&    operator =(strided_matrix_engine&&) noexcept = default;
+    constexpr strided_matrix_engine&    operator =(strided_matrix_engine const&) = default;
+
+    //- Capacity
+    //
+    constexpr size_type     columns() const noexcept;
+    constexpr size_type     rows() const noexcept;
+    constexpr size_tuple    size() const noexcept;
+
+    constexpr size_type     column_capacity() const noexcept;
+    constexpr size_type     row_capacity() const noexcept;
+    constexpr size_tuple    capacity() const noexcept;
+
+    constexpr difference_type   row_stride() const noexcept;
+    constexpr difference_type   column_stride() const noexcept;
+
+    //- Element access
+    //
+    constexpr reference     operator ()(size_type i, size_type j) const;
+
+    //- Modifiers
+    //
+    constexpr void      swap(strided_matrix_engine& rhs);
+
+  private:
+    template<class ET2, class OT2>  friend class matrix;
+
+    pointer             mp_data;
+    size_type           m_rows;
+    size_type           m_cols;
+    difference_type     m_rstride;
+    difference_type     m_cstride;
+
+    template<class P>
+    constexpr strided_matrix_engine(detail::strided_view<P> const& sv);
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class ET, class MCT> constexpr
+strided_matrix_engine<ET, MCT>::strided_matrix_engine()
+:   mp_data(nullptr)
+,   m_rows(0)
+,   m_cols(0)
+,   m_rstride(0)
+,   m_cstride(0)
+{}
+
+//----------
+//- Capacity
+//
+template<class ET, class MCT> constexpr
+typename strided_matrix_engine<ET, MCT>::size_type
+strided_matrix_engine<ET, MCT>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class ET, class MCT> constexpr
+typename strided_matrix_engine<ET, MCT>::size_type
+strided_matrix_engine<ET, MCT>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class ET, class MCT> constexpr
+typename strided_matrix_engine<ET, MCT>::size_tuple
+strided_matrix_engine<ET, MCT>::size() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class ET, class MCT> constexpr
+typename strided_matrix_engine<ET, MCT>::size_type
+strided_matrix_engine<ET, MCT>::column_capacity() const noexcept
+{
+    return m_cols;
+}
+
+template<class ET, class MCT> constexpr
+typename strided_matrix_engine<ET, MCT>::size_type
+strided_matrix_engine<ET, MCT>::row_capacity() const noexcept
+{
+    return m_rows;
+}
+
+template<class ET, class MCT> constexpr
+typename strided_matrix_engine<ET, MCT>::size_tuple
+strided_matrix_engine<ET, MCT>::capacity() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class ET, class MCT> constexpr
+typename strided_matrix_engine<ET, MCT>::difference_type
+strided_matrix_engine<ET, MCT>::row_stride() const noexcept
+{
+    return m_rstride;
+}
+
+template<class ET, class MCT> constexpr
+typename strided_matrix_engine<ET, MCT>::difference_type
+strided_matrix_engine<ET, MCT>::column_stride() const noexcept
+{
+    return m_cstride;
+}
+
+//----------------
+//- Element access
+//
+template<class ET, class MCT> constexpr
+typename strided_matrix_engine<ET, MCT>::reference
+strided_matrix_engine<ET, MCT>::operator ()(size_type i, size_type j) const
+{
+    return mp_data[static_cast<difference_type>(i)*m_rstride + static_cast<difference_type>(j)*m_cstride];
+}
+
+//-----------
+//- Modifiers
+//
+template<class ET, class MCT> constexpr
+void
+strided_matrix_engine<ET, MCT>::swap(strided_matrix_engine& rhs)
+{
+    std::swap(mp_data, rhs.mp_data);
+    std::swap(m_rows, rhs.m_rows);
+    std::swap(m_cols, rhs.m_cols);
+    std::swap(m_rstride, rhs.m_rstride);
+    std::swap(m_cstride, rhs.m_cstride);
+}
+
+//------------------------
+//- Private implementation
+//
+template<class ET, class MCT>
+template<class P> constexpr
+strided_matrix_engine<ET, MCT>::strided_matrix_engine(detail::strided_view<P> const& sv)
+:   mp_data(sv.p)
+,   m_rows(static_cast<size_type>(sv.rows))
+,   m_cols(static_cast<size_type>(sv.cols))
+,   m_rstride(static_cast<difference_type>(sv.rs))
+,   m_cstride(static_cast<difference_type>(sv.cs))
+{}
+
+
+//==================================================================================================
+//  Strided vector engine, meant to act as a "view" of a row, column, or diagonal of a strided
+//  matrix view.
+//==================================================================================================
+//
+template<class ET, class VCT>
+class strided_vector_engine
+{
+    static_assert(is_matrix_engine_v<ET>);
+    static_assert(is_vector_engine_tag<VCT>);
+
+  public:
+    //- Types
+    //
+    using engine_category = VCT;
+    using element_type    = typename ET::element_type;
+    using value_type      = typename ET::value_type;
+    using pointer         = detail::noe_pointer_t<ET, VCT>;
+    using const_pointer   = typename ET::const_pointer;
+    using reference       = detail::noe_reference_t<ET, VCT>;
+    using const_reference = typename ET::const_reference;
+    using difference_type = typename ET::difference_type;
+    using size_type       = typename ET::size_type;
+
+#ifdef LA_USE_VECTOR_ENGINE_ITERATORS
+    using iterator        = detail::noe_iterator_t<ET, VCT, strided_vector_engine>;
+    using const_iterator  = detail::vector_const_iterator<strided_vector_engine>;
+#endif
+
+    //- Construct/copy/destroy
+    //
+    ~strided_vector_engine() noexcept = default;
+
+    constexpr strided_vector_engine() noexcept;
+    constexpr strided_vector_engine(strided_vector_engine&&) noexcept = default;
+    constexpr strided_vector_engine(strided_vector_engine const&) noexcept = default;
+
+    constexpr strided_vector_engine&    operator =(strided_vector_engine&&) noexcept = default;
+    constexpr strided_vector_engine&    operator =(strided_vector_engine const&) noexcept = default;
+
+#ifdef LA_USE_VECTOR_ENGINE_ITERATORS
+    //- Iterators
+    //
+    constexpr iterator          begin() const noexcept;
+    constexpr iterator          end() const noexcept;
+    constexpr const_iterator    cbegin() const noexcept;
+    constexpr const_iterator    cend() const noexcept;
+#endif
+
+    //- Capacity
+    //
+    constexpr size_type         capacity() const noexcept;
+    constexpr size_type         elements() const noexcept;
+    constexpr difference_type   stride() const noexcept;
+
+    //- Element access
+    //
+    constexpr reference     operator ()(size_type i) const;
+
+    //- Modifiers
+    //
+    constexpr void      swap(strided_vector_engine& rhs);
+
+  private:
+    template<class ET2, class OT2>  friend class vector;
+
+    pointer             mp_data;
+    size_type           m_elems;
+    difference_type     m_stride;
+
+    template<class P>
+    constexpr strided_vector_engine(detail::strided_view<P> const& sv);
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class ET, class VCT> constexpr
+strided_vector_engine<ET, VCT>::strided_vector_engine() noexcept
+:   mp_data(nullptr)
+,   m_elems(0)
+,   m_stride(0)
+{}
+
+#ifdef LA_USE_VECTOR_ENGINE_ITERATORS
+//-----------
+//- Iterators
+//
+template<class ET, class VCT> constexpr
+typename strided_vector_engine<ET, VCT>::iterator
+strided_vector_engine<ET, VCT>::begin() const noexcept
+{
+    return iterator(this, 0, m_elems);
+}
+
+template<class ET, class VCT> constexpr
+typename strided_vector_engine<ET, VCT>::iterator
+strided_vector_engine<ET, VCT>::end() const noexcept
+{
+    return iterator(this, m_elems, m_elems);
+}
+
+template<class ET, class VCT> constexpr
+typename strided_vector_engine<ET, VCT>::const_iterator
+strided_vector_engine<ET, VCT>::cbegin() const noexcept
+{
+    return const_iterator(this, 0, m_elems);
+}
+
+template<class ET, class VCT> constexpr
+typename strided_vector_engine<ET, VCT>::const_iterator
+strided_vector_engine<ET, VCT>::cend() const noexcept
+{
+    return const_iterator(this, m_elems, m_elems);
+}
+
+#endif
+//----------
+//- Capacity
+//
+template<class ET, class VCT> constexpr
+typename strided_vector_engine<ET, VCT>::size_type
+strided_vector_engine<ET, VCT>::capacity() const noexcept
+{
+    return m_elems;
+}
+
+template<class ET, class VCT> constexpr
+typename strided_vector_engine<ET, VCT>::size_type
+strided_vector_engine<ET, VCT>::elements() const noexcept
+{
+    return m_elems;
+}
+
+template<class ET, class VCT> constexpr
+typename strided_vector_engine<ET, VCT>::difference_type
+strided_vector_engine<ET, VCT>::stride() const noexcept
+{
+    return m_stride;
+}
+
+//----------------
+//- Element access
+//
+template<class ET, class VCT> constexpr
+typename strided_vector_engine<ET, VCT>::reference
+strided_vector_engine<ET, VCT>::operator ()(size_type i) const
+{
+    return mp_data[static_cast<difference_type>(i)*m_stride];
+}
+
+//-----------
+//- Modifiers
+//
+template<class ET, class VCT> constexpr
+void
+strided_vector_engine<ET, VCT>::swap(strided_vector_engine& rhs)
+{
+    std::swap(mp_data, rhs.mp_data);
+    std::swap(m_elems, rhs.m_elems);
+    std::swap(m_stride, rhs.m_stride);
+}
+
+//------------------------
+//- Private implementation
+//
+template<class ET, class VCT>
+template<class P> constexpr
+strided_vector_engine<ET, VCT>::strided_vector_engine(detail::strided_view<P> const& sv)
+:   mp_data(sv.p)
+,   m_elems(static_cast<size_type>(sv.cols))
+,   m_stride(static_cast<difference_type>(sv.cs))
+{}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_STRIDED_ENGINES_HPP_DEFINED
@@ -0,0 +1,806 @@
+//==================================================================================================
+//  File:       tiled_engine.hpp
+//
+//  Summary:    This header defines a dynamically-resizable matrix engine that stores its elements
+//              in contiguous, row-major, TS x TS tiles, so that elements that are near each other
+//              in either direction are also near each other in memory.  Tiles are laid out either
+//              in row-major order of the tile grid or, if MO is true, in Morton (Z-curve) order,
+//              which keeps tiles that are near each other in the grid near each other in memory.
+//
+//              In addition to the usual element interface, the engine provides read-only access
+//              to each tile's storage, and iteration over the tiles in storage order.  Tiles on
+//              the right and bottom edges are padded with zero-valued elements, so that every tile
+//              is full and kernels may operate on whole tiles; since elements are written only
+//              through element access, the padding cannot be overwritten.  Multiplication traits specializations are
+//              provided that compute products tile by tile with the GEMM kernel.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_TILED_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_TILED_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//- Interleaves the bits of a tile's (row, column) coordinates to form its Morton code; the row
+//  supplies the more significant bit of each pair.
+//
+inline uint64_t
+morton_code(uint32_t ti, uint32_t tj) noexcept
+{
+    uint64_t    code = 0;
+
+    for (uint32_t b = 0;  b < 32;  ++b)
+    {
+        code |= (uint64_t((tj >> b) & 1u) << (2*b)) | (uint64_t((ti >> b) & 1u) << (2*b + 1));
+    }
+    return code;
+}
+
+}       //- detail namespace
+//==================================================================================================
+//  Tiled matrix engine.
+//==================================================================================================
+//
+template<class T, class AT, size_t TS, bool MO>
+class tiled_matrix_engine
+{
+    static_assert(TS > 0);
+
+  public:
+    //- Types
+    //
+    using engine_category = resizable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using allocator_type  = AT;
+    using pointer         = typename allocator_traits<AT>::pointer;
+    using const_pointer   = typename allocator_traits<AT>::const_pointer;
+    using reference       = element_type&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    static constexpr size_type  tile_size     = TS;
+    static constexpr size_type  tile_elements = TS*TS;
+    static constexpr bool       morton_order  = MO;
+
+    //- A tile, as seen by tile iteration:  its coordinates in the tile grid, the number of its
+    //  rows and columns lying within the matrix, and its (row-major, TS x TS) storage.
+    //
+    template<class P>
+    struct tile_reference
+    {
+        size_type   row;
+        size_type   column;
+        size_type   rows;
+        size_type   columns;
+        P           data;
+    };
+
+    template<class P>
+    class tile_iterator;
+
+    //- As with std::set, both iterator types are constant, to preserve the zero padding.
+    //
+    using iterator       = tile_iterator<const_pointer>;
+    using const_iterator = tile_iterator<const_pointer>;
+
+    //- Construct/copy/destroy
+    //
+    ~tiled_matrix_engine() noexcept = default;
+
+    tiled_matrix_engine();
+    tiled_matrix_engine(tiled_matrix_engine&&) noexcept = default;
+    tiled_matrix_engine(tiled_matrix_engine const&) = default;
+    tiled_matrix_engine(size_type rows, size_type cols);
+    tiled_matrix_engine(size_type rows, size_type cols, size_type rowcap, size_type colcap);
+
+    tiled_matrix_engine&    operator =(tiled_matrix_engine&&) noexcept = default;
+    tiled_matrix_engine&    operator =(tiled_matrix_engine const&) = default;
+    template<class ET2>
+    tiled_matrix_engine&    operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    void    resize(size_type rows, size_type cols);
+    void    resize(size_type rows, size_type cols, size_type rowcap, size_type colcap);
+
+    //- Element access
+    //
+    reference           operator ()(size_type i, size_type j);
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    //- Tile access
+    //
+    size_type       tile_rows() const noexcept;
+    size_type       tile_columns() const noexcept;
+
+    const_pointer   tile_data(size_type ti, size_type tj) const noexcept;
+
+    const_iterator  begin() const noexcept;
+    const_iterator  end() const noexcept;
+
+    //- Modifiers
+    //
+    void    swap(tiled_matrix_engine& rhs) noexcept;
+    void    swap_columns(size_type c1, size_type c2) noexcept;
+    void    swap_rows(size_type r1, size_type r2) noexcept;
+
+  private:
+    template<class OT, class OP1, class OP2>    friend struct matrix_multiplication_traits;
+
+    std::vector<T, AT>      m_elems;
+    std::vector<size_type>  m_slots;        //- Morton order only; slot of tile (ti, tj)
+    std::vector<size_type>  m_tiles;        //- Morton order only; tile (ti*tcols + tj) in slot
+    size_type               m_rows;
+    size_type               m_cols;
+    size_type               m_tile_rows;
+    size_type               m_tile_cols;
+
+    pointer     tile_storage(size_type ti, size_type tj) noexcept;
+    size_type   slot(size_type ti, size_type tj) const noexcept;
+    size_type   offset(size_type i, size_type j) const noexcept;
+};
+
+//---------------
+//- Tile iterator
+//
+template<class T, class AT, size_t TS, bool MO>
+template<class P>
+class tiled_matrix_engine<T,AT,TS,MO>::tile_iterator
+{
+  public:
+    using iterator_category = forward_iterator_tag;
+    using value_type        = tile_reference<P>;
+    using difference_type   = ptrdiff_t;
+    using pointer           = value_type const*;
+    using reference         = value_type;
+
+    using engine_pointer = conditional_t<is_const_v<remove_pointer_t<P>>,
+                                         tiled_matrix_engine const*, tiled_matrix_engine*>;
+
+    tile_iterator() noexcept = default;
+    tile_iterator(engine_pointer p_eng, size_type slot) noexcept
+    :   mp_eng(p_eng), m_slot(slot)
+    {}
+
+    reference   operator *() const noexcept
+    {
+        size_type const     tile = MO ? mp_eng->m_tiles[m_slot] : m_slot;
+        size_type const     ti   = tile / mp_eng->m_tile_cols;
+        size_type const     tj   = tile % mp_eng->m_tile_cols;
+
+        return value_type{ ti, tj,
+                           min(TS, mp_eng->m_rows - ti*TS), min(TS, mp_eng->m_cols - tj*TS),
+                           mp_eng->m_elems.data() + m_slot*tile_elements };
+    }
+
+    tile_iterator&  operator ++() noexcept      { ++m_slot;  return *this; }
+    tile_iterator   operator ++(int) noexcept   { tile_iterator tmp(*this);  ++m_slot;  return tmp; }
+
+    bool    operator ==(tile_iterator const& rhs) const noexcept    { return m_slot == rhs.m_slot; }
+    bool    operator !=(tile_iterator const& rhs) const noexcept    { return m_slot != rhs.m_slot; }
+
+  private:
+    engine_pointer  mp_eng = nullptr;
+    size_type       m_slot = 0;
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class AT, size_t TS, bool MO>
+tiled_matrix_engine<T,AT,TS,MO>::tiled_matrix_engine()
+:   m_elems()
+,   m_slots()
+,   m_tiles()
+,   m_rows(0)
+,   m_cols(0)
+,   m_tile_rows(0)
+,   m_tile_cols(0)
+{}
+
+template<class T, class AT, size_t TS, bool MO>
+tiled_matrix_engine<T,AT,TS,MO>::tiled_matrix_engine(size_type rows, size_type cols)
+:   tiled_matrix_engine()
+{
+    m_rows      = rows;
+    m_cols      = cols;
+    m_tile_rows = (rows + TS - 1) / TS;
+    m_tile_cols = (cols + TS - 1) / TS;
+    m_elems.resize(m_tile_rows*m_tile_cols*tile_elements);
+
+    if constexpr (MO)
+    {
+        size_type const     n = m_tile_rows*m_tile_cols;
+
+        m_tiles.resize(n);
+        m_slots.resize(n);
+        iota(m_tiles.begin(), m_tiles.end(), size_type(0));
+        sort(m_tiles.begin(), m_tiles.end(),
+             [tc = m_tile_cols](size_type a, size_type b)
+             {
+                 return detail::morton_code(uint32_t(a / tc), uint32_t(a % tc)) <
+                        detail::morton_code(uint32_t(b / tc), uint32_t(b % tc));
+             });
+        for (size_type k = 0;  k < n;  ++k)
+        {
+            m_slots[m_tiles[k]] = k;
+        }
+    }
+}
+
+//- Capacity is determined by the tiling; the requested capacities are ignored.
+//
+template<class T, class AT, size_t TS, bool MO>
+tiled_matrix_engine<T,AT,TS,MO>::tiled_matrix_engine
+(size_type rows, size_type cols, size_type, size_type)
+:   tiled_matrix_engine(rows, cols)
+{}
+
+template<class T, class AT, size_t TS, bool MO>
+template<class ET2>
+tiled_matrix_engine<T,AT,TS,MO>&
+tiled_matrix_engine<T,AT,TS,MO>::operator =(ET2 const& rhs)
+{
+    static_assert(is_matrix_engine_v<ET2>);
+    using src_size_type = typename ET2::size_type;
+
+    size_type const         rows = static_cast<size_type>(rhs.rows());
+    size_type const         cols = static_cast<size_type>(rhs.columns());
+    tiled_matrix_engine     tmp(rows, cols);
+
+    for (size_type i = 0;  i < rows;  ++i)
+    {
+        for (size_type j = 0;  j < cols;  ++j)
+        {
+            tmp(i, j) = rhs(static_cast<src_size_type>(i), static_cast<src_size_type>(j));
+        }
+    }
+    tmp.swap(*this);
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::size_type
+tiled_matrix_engine<T,AT,TS,MO>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::size_type
+tiled_matrix_engine<T,AT,TS,MO>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::size_tuple
+tiled_matrix_engine<T,AT,TS,MO>::size() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::size_type
+tiled_matrix_engine<T,AT,TS,MO>::column_capacity() const noexcept
+{
+    return m_tile_cols*TS;
+}
+
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::size_type
+tiled_matrix_engine<T,AT,TS,MO>::row_capacity() const noexcept
+{
+    return m_tile_rows*TS;
+}
+
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::size_tuple
+tiled_matrix_engine<T,AT,TS,MO>::capacity() const noexcept
+{
+    return size_tuple(m_tile_rows*TS, m_tile_cols*TS);
+}
+
+template<class T, class AT, size_t TS, bool MO>
+void
+tiled_matrix_engine<T,AT,TS,MO>::resize(size_type rows, size_type cols)
+{
+    if (rows != m_rows  ||  cols != m_cols)
+    {
+        tiled_matrix_engine     tmp(rows, cols);
+        size_type const         r = min(rows, m_rows);
+        size_type const         c = min(cols, m_cols);
+
+        for (size_type i = 0;  i < r;  ++i)
+        {
+            for (size_type j = 0;  j < c;  ++j)
+            {
+                tmp(i, j) = (*this)(i, j);
+            }
+        }
+        tmp.swap(*this);
+    }
+}
+
+template<class T, class AT, size_t TS, bool MO>
+void
+tiled_matrix_engine<T,AT,TS,MO>::resize(size_type rows, size_type cols, size_type, size_type)
+{
+    resize(rows, cols);
+}
+
+//----------------
+//- Element access
+//
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::reference
+tiled_matrix_engine<T,AT,TS,MO>::operator ()(size_type i, size_type j)
+{
+    return m_elems[offset(i, j)];
+}
+
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::const_reference
+tiled_matrix_engine<T,AT,TS,MO>::operator ()(size_type i, size_type j) const
+{
+    return m_elems[offset(i, j)];
+}
+
+//-------------
+//- Tile access
+//
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::size_type
+tiled_matrix_engine<T,AT,TS,MO>::tile_rows() const noexcept
+{
+    return m_tile_rows;
+}
+
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::size_type
+tiled_matrix_engine<T,AT,TS,MO>::tile_columns() const noexcept
+{
+    return m_tile_cols;
+}
+
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::const_pointer
+tiled_matrix_engine<T,AT,TS,MO>::tile_data(size_type ti, size_type tj) const noexcept
+{
+    return m_elems.data() + slot(ti, tj)*tile_elements;
+}
+
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::const_iterator
+tiled_matrix_engine<T,AT,TS,MO>::begin() const noexcept
+{
+    return const_iterator(this, 0);
+}
+
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::const_iterator
+tiled_matrix_engine<T,AT,TS,MO>::end() const noexcept
+{
+    return const_iterator(this, m_tile_rows*m_tile_cols);
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class AT, size_t TS, bool MO>
+void
+tiled_matrix_engine<T,AT,TS,MO>::swap(tiled_matrix_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        m_elems.swap(rhs.m_elems);
+        m_slots.swap(rhs.m_slots);
+        m_tiles.swap(rhs.m_tiles);
+        detail::la_swap(m_rows,      rhs.m_rows);
+        detail::la_swap(m_cols,      rhs.m_cols);
+        detail::la_swap(m_tile_rows, rhs.m_tile_rows);
+        detail::la_swap(m_tile_cols, rhs.m_tile_cols);
+    }
+}
+
+template<class T, class AT, size_t TS, bool MO>
+void
+tiled_matrix_engine<T,AT,TS,MO>::swap_columns(size_type c1, size_type c2) noexcept
+{
+    if (c1 != c2)
+    {
+        for (size_type i = 0;  i < m_rows;  ++i)
+        {
+            detail::la_swap(m_elems[offset(i, c1)], m_elems[offset(i, c2)]);
+        }
+    }
+}
+
+template<class T, class AT, size_t TS, bool MO>
+void
+tiled_matrix_engine<T,AT,TS,MO>::swap_rows(size_type r1, size_type r2) noexcept
+{
+    if (r1 != r2)
+    {
+        for (size_type j = 0;  j < m_cols;  ++j)
+        {
+            detail::la_swap(m_elems[offset(r1, j)], m_elems[offset(r2, j)]);
+        }
+    }
+}
+
+//------------------------
+//- Private implementation
+//
+//- Writable tile storage, for the tile products, which preserve the zero padding.
+//
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::pointer
+tiled_matrix_engine<T,AT,TS,MO>::tile_storage(size_type ti, size_type tj) noexcept
+{
+    return m_elems.data() + slot(ti, tj)*tile_elements;
+}
+
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::size_type
+tiled_matrix_engine<T,AT,TS,MO>::slot(size_type ti, size_type tj) const noexcept
+{
+    if constexpr (MO)
+        return m_slots[ti*m_tile_cols + tj];
+    else
+        return ti*m_tile_cols + tj;
+}
+
+template<class T, class AT, size_t TS, bool MO> inline
+typename tiled_matrix_engine<T,AT,TS,MO>::size_type
+tiled_matrix_engine<T,AT,TS,MO>::offset(size_type i, size_type j) const noexcept
+{
+    return slot(i / TS, j / TS)*tile_elements + (i % TS)*TS + (j % TS);
+}
+
+//==================================================================================================
+//                          **** TILED ENGINE MULTIPLICATION TRAITS ****
+//==================================================================================================
+//  Engine promotion:  the product of two tiled matrices with the same tile size is tiled, with
+//  the tile order of the left-hand operand.  All other combinations use the defaults.
+//==================================================================================================
+//
+template<class OT, class T1, class A1, size_t TS, bool MO1, class T2, class A2, bool MO2>
+struct matrix_multiplication_engine_traits<OT, tiled_matrix_engine<T1, A1, TS, MO1>,
+                                               tiled_matrix_engine<T2, A2, TS, MO2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = tiled_matrix_engine<element_type, alloc_type, TS, MO1>;
+};
+
+//--------------------------------------------------------------------------------------------------
+//  Arithmetic.  Since edge tiles are zero-padded, every tile product is a full TS x TS product
+//  over contiguous storage, computed by the blocked GEMM kernel.  Products with other matrices
+//  multiply each tile by the matching rows or columns of a row-major copy of the other operand.
+//--------------------------------------------------------------------------------------------------
+//
+namespace detail {
+//- Returns a tile's storage as a kernel operand of element type T, converting it into buf if the
+//  tile's element type differs.
+//
+template<class T, class U>
+T const*
+tile_operand(U const* p_tile, size_t count, std::vector<T>& buf)
+{
+    if constexpr (is_same_v<remove_cv_t<U>, T>)
+    {
+        return p_tile;
+    }
+    else
+    {
+        buf.resize(count);
+
+        for (size_t i = 0;  i < count;  ++i)
+        {
+            buf[i] = static_cast<T>(p_tile[i]);
+        }
+        return buf.data();
+    }
+}
+
+//- Copies the (rows x cols) matrix m into the row-major buffer at p_dst, element by element.
+//
+template<class T, class ET, class OT>
+void
+pack_rows(matrix<ET, OT> const& m, T* p_dst)
+{
+    using size_type = typename matrix<ET, OT>::size_type;
+
+    size_t const    rows = static_cast<size_t>(m.rows());
+    size_t const    cols = static_cast<size_t>(m.columns());
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            p_dst[i*cols + j] = static_cast<T>(m(static_cast<size_type>(i), static_cast<size_type>(j)));
+        }
+    }
+}
+
+//- Copies the row-major (rows x cols) buffer at p_src into the result of a product.
+//
+template<class MT>
+MT
+unpack_rows(size_t rows, size_t cols, typename MT::element_type const* p_src)
+{
+    using size_type = typename MT::size_type;
+
+    MT  mr;
+
+    if constexpr (result_requires_resize(mr))
+    {
+        mr.resize(static_cast<size_type>(rows), static_cast<size_type>(cols));
+    }
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            mr(static_cast<size_type>(i), static_cast<size_type>(j)) = p_src[i*cols + j];
+        }
+    }
+    return mr;
+}
+
+//- tiled*matrix:  the rows of C covered by tile (ti, tk) of A accumulate that tile times the
+//  rows of B that it covers.
+//
+template<class OT, class OP1, class OP2>
+struct tiled_left_product;
+
+template<class OT, class T1, class A1, size_t TS, bool MO1, class OT1, class ET2, class OT2>
+struct tiled_left_product<OT, matrix<tiled_matrix_engine<T1, A1, TS, MO1>, OT1>, matrix<ET2, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, tiled_matrix_engine<T1, A1, TS, MO1>, ET2>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    static result_type
+    multiply(matrix<tiled_matrix_engine<T1, A1, TS, MO1>, OT1> const& m1, matrix<ET2, OT2> const& m2)
+    {
+        using elem_type = typename result_type::element_type;
+
+        PrintOperandTypes<result_type>("multiplication_traits (tiled*m)", m1, m2);
+
+        size_t const    rows  = static_cast<size_t>(m1.rows());
+        size_t const    inner = static_cast<size_t>(m1.columns());
+        size_t const    cols  = static_cast<size_t>(m2.columns());
+
+        if (static_cast<size_t>(m2.rows()) != inner)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        std::vector<elem_type>  b(inner*cols), c(rows*cols, elem_type(0)), t;
+
+        pack_rows(m2, b.data());
+
+        for (auto const& tile : m1.engine())
+        {
+            elem_type const*    p_t = tile_operand(tile.data, TS*TS, t);
+
+            gemm_kernel(tile.rows, cols, tile.columns, p_t, TS,
+                        b.data() + tile.column*TS*cols, cols, c.data() + tile.row*TS*cols, cols);
+        }
+        return unpack_rows<result_type>(rows, cols, c.data());
+    }
+};
+
+//- matrix*tiled:  the columns of C covered by tile (tk, tj) of B accumulate the columns of A that
+//  it covers times that tile.
+//
+template<class OT, class OP1, class OP2>
+struct tiled_right_product;
+
+template<class OT, class ET1, class OT1, class T2, class A2, size_t TS, bool MO2, class OT2>
+struct tiled_right_product<OT, matrix<ET1, OT1>, matrix<tiled_matrix_engine<T2, A2, TS, MO2>, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, ET1, tiled_matrix_engine<T2, A2, TS, MO2>>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    static result_type
+    multiply(matrix<ET1, OT1> const& m1, matrix<tiled_matrix_engine<T2, A2, TS, MO2>, OT2> const& m2)
+    {
+        using elem_type = typename result_type::element_type;
+
+        PrintOperandTypes<result_type>("multiplication_traits (m*tiled)", m1, m2);
+
+        size_t const    rows  = static_cast<size_t>(m1.rows());
+        size_t const    inner = static_cast<size_t>(m1.columns());
+        size_t const    cols  = static_cast<size_t>(m2.columns());
+
+        if (static_cast<size_t>(m2.rows()) != inner)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        std::vector<elem_type>  a(rows*inner), c(rows*cols, elem_type(0)), t;
+
+        pack_rows(m1, a.data());
+
+        for (auto const& tile : m2.engine())
+        {
+            elem_type const*    p_t = tile_operand(tile.data, TS*TS, t);
+
+            gemm_kernel(rows, tile.columns, tile.rows, a.data() + tile.row*TS, inner,
+                        p_t, TS, c.data() + tile.column*TS, cols);
+        }
+        return unpack_rows<result_type>(rows, cols, c.data());
+    }
+};
+
+//- Products of a tiled matrix with a matrix that is not structured (see multiplication_traits.hpp)
+//  go through the tiles.  Tiled matrices with different tile sizes are multiplied through the
+//  left-hand operand's tiles.
+//
+template<class OT, class T1, class A1, size_t TS, bool MO1, class OT1, class ET2, class OT2>
+struct matrix_product_traits<OT, matrix<tiled_matrix_engine<T1, A1, TS, MO1>, OT1>, matrix<ET2, OT2>,
+                             structured_side::none>
+:   public tiled_left_product<OT, matrix<tiled_matrix_engine<T1, A1, TS, MO1>, OT1>, matrix<ET2, OT2>>
+{};
+
+template<class OT, class ET1, class OT1, class T2, class A2, size_t TS, bool MO2, class OT2>
+struct matrix_product_traits<OT, matrix<ET1, OT1>, matrix<tiled_matrix_engine<T2, A2, TS, MO2>, OT2>,
+                             structured_side::none>
+:   public tiled_right_product<OT, matrix<ET1, OT1>, matrix<tiled_matrix_engine<T2, A2, TS, MO2>, OT2>>
+{};
+
+template<class OT, class T1, class A1, size_t TS1, bool MO1, class OT1,
+                   class T2, class A2, size_t TS2, bool MO2, class OT2>
+struct matrix_product_traits<OT, matrix<tiled_matrix_engine<T1, A1, TS1, MO1>, OT1>,
+                                 matrix<tiled_matrix_engine<T2, A2, TS2, MO2>, OT2>,
+                             structured_side::none>
+:   public tiled_left_product<OT, matrix<tiled_matrix_engine<T1, A1, TS1, MO1>, OT1>,
+                                  matrix<tiled_matrix_engine<T2, A2, TS2, MO2>, OT2>>
+{};
+
+}       //- detail namespace
+
+//- tiled*tiled:  C(ti, tj) = sum over tk of A(ti, tk) * B(tk, tj).
+//
+template<class OT, class T1, class A1, size_t TS, bool MO1, class OT1,
+                   class T2, class A2, bool MO2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<tiled_matrix_engine<T1, A1, TS, MO1>, OT1>,
+                                        matrix<tiled_matrix_engine<T2, A2, TS, MO2>, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, tiled_matrix_engine<T1, A1, TS, MO1>,
+                                                            tiled_matrix_engine<T2, A2, TS, MO2>>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<tiled_matrix_engine<T1, A1, TS, MO1>, OT1> const& m1,
+                                 matrix<tiled_matrix_engine<T2, A2, TS, MO2>, OT2> const& m2);
+};
+
+template<class OT, class T1, class A1, size_t TS, bool MO1, class OT1,
+                   class T2, class A2, bool MO2, class OT2>
+auto
+matrix_multiplication_traits<OT, matrix<tiled_matrix_engine<T1, A1, TS, MO1>, OT1>,
+                                 matrix<tiled_matrix_engine<T2, A2, TS, MO2>, OT2>>::multiply
+(matrix<tiled_matrix_engine<T1, A1, TS, MO1>, OT1> const& m1,
+ matrix<tiled_matrix_engine<T2, A2, TS, MO2>, OT2> const& m2) -> result_type
+{
+    using elem_type = typename result_type::element_type;
+
+    PrintOperandTypes<result_type>("multiplication_traits (tiled*tiled)", m1, m2);
+
+    if (m1.columns() != m2.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    auto const&     a = m1.engine();
+    auto const&     b = m2.engine();
+    result_type     mr(static_cast<size_type_r>(m1.rows()), static_cast<size_type_r>(m2.columns()));
+    auto&           c = mr.engine();
+
+    std::vector<elem_type>  ta, tb;
+
+    for (size_t ti = 0;  ti < a.tile_rows();  ++ti)
+    {
+        for (size_t tj = 0;  tj < b.tile_columns();  ++tj)
+        {
+            elem_type*  p_c = c.tile_storage(ti, tj);
+
+            for (size_t tk = 0;  tk < a.tile_columns();  ++tk)
+            {
+                elem_type const*    p_a = detail::tile_operand(a.tile_data(ti, tk), TS*TS, ta);
+                elem_type const*    p_b = detail::tile_operand(b.tile_data(tk, tj), TS*TS, tb);
+
+                detail::gemm_kernel(TS, TS, TS, p_a, TS, p_b, TS, p_c, TS);
+            }
+        }
+    }
+    return mr;
+}
+
+//- tiled*vector:  each tile contributes to TS elements of the result.
+//
+template<class OT, class T1, class A1, size_t TS, bool MO1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<tiled_matrix_engine<T1, A1, TS, MO1>, OT1>,
+                                        vector<ET2, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, tiled_matrix_engine<T1, A1, TS, MO1>, ET2>;
+    using op_traits    = OT;
+    using result_type  = vector<engine_type, op_traits>;
+
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<tiled_matrix_engine<T1, A1, TS, MO1>, OT1> const& m1,
+                                 vector<ET2, OT2> const& v2);
+};
+
+template<class OT, class T1, class A1, size_t TS, bool MO1, class OT1, class ET2, class OT2>
+auto
+matrix_multiplication_traits<OT, matrix<tiled_matrix_engine<T1, A1, TS, MO1>, OT1>,
+                                 vector<ET2, OT2>>::multiply
+(matrix<tiled_matrix_engine<T1, A1, TS, MO1>, OT1> const& m1, vector<ET2, OT2> const& v2)
+    -> result_type
+{
+    using elem_type = typename result_type::element_type;
+
+    PrintOperandTypes<result_type>("multiplication_traits (tiled*v)", m1, v2);
+
+    if (static_cast<size_t>(m1.columns()) != static_cast<size_t>(v2.elements()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    auto const&     a = m1.engine();
+    result_type     vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(static_cast<size_type_r>(a.rows()));
+    }
+
+    std::vector<elem_type>  y(a.tile_rows()*TS, elem_type(0));
+
+    for (auto const& tile : a)
+    {
+        size_t const    i0 = tile.row*TS;
+        size_t const    j0 = tile.column*TS;
+
+        for (size_t i = 0;  i < tile.rows;  ++i)
+        {
+            elem_type   er = elem_type(0);
+
+            for (size_t j = 0;  j < tile.columns;  ++j)
+            {
+                er += tile.data[i*TS + j] * v2(static_cast<size_type_2>(j0 + j));
+            }
+            y[i0 + i] += er;
+        }
+    }
+    for (size_t i = 0;  i < a.rows();  ++i)
+    {
+        vr(static_cast<size_type_r>(i)) = y[i];
+    }
+    return vr;
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_TILED_ENGINE_HPP_DEFINED
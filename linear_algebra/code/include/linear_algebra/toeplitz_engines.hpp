@@ -0,0 +1,915 @@
+//==================================================================================================
+//  File:       toeplitz_engines.hpp
+//
+//  Summary:    This header defines read-only matrix engines for Toeplitz and circulant matrices,
+//              which store only their defining sequences:
+//
+//                  Toeplitz (R x C):   T(i, j) = t(i - j),         R + C - 1 stored elements,
+//                  circulant (N x N):  C(i, j) = c((i - j) mod N), N stored elements.
+//
+//              Multiplication traits specializations are also provided so that products with
+//              vectors (and, column by column, with matrices) are computed as convolutions of
+//              the defining sequence with the operand.  For floating-point and complex elements,
+//              convolutions are computed with a radix-2 FFT in O(n log n) operations once the
+//              smaller dimension reaches a threshold; below it, and for other element types, the
+//              direct O(R*C) method is used.  The threshold is taken from the operation traits'
+//              nested 'fft_threshold' member, if present.
+//
+//              These matrices are created with the free functions toeplitz_matrix() and
+//              circulant_matrix().
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_TOEPLITZ_ENGINES_HPP_DEFINED
+#define LINEAR_ALGEBRA_TOEPLITZ_ENGINES_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Traits type to extract the FFT threshold from an operation traits type.  Operation traits
+//  types that do not provide a nested 'fft_threshold' member get the default value.
+//==================================================================================================
+//
+inline constexpr size_t     default_fft_threshold = 64;
+
+template<class OT, class = void>
+struct fft_threshold
+:   public integral_constant<size_t, default_fft_threshold>
+{};
+
+template<class OT>
+struct fft_threshold<OT, void_t<decltype(OT::fft_threshold)>>
+:   public integral_constant<size_t, OT::fft_threshold>
+{};
+
+template<class OT> inline constexpr
+size_t  fft_threshold_v = fft_threshold<OT>::value;
+
+//- Element types for which convolutions may be computed by FFT.
+//
+template<class T>
+struct fft_value
+{
+    static constexpr bool   enabled = is_floating_point_v<T>;
+    using type = complex<T>;
+};
+
+template<class T>
+struct fft_value<complex<T>>
+{
+    static constexpr bool   enabled = is_floating_point_v<T>;
+    using type = complex<T>;
+};
+
+//==================================================================================================
+//  In-place iterative radix-2 FFT.  The length of the array must be a power of two.  The inverse
+//  transform includes the 1/N scaling.
+//==================================================================================================
+//
+template<class R>
+void
+fft_kernel(std::vector<complex<R>>& a, bool inverse)
+{
+    size_t const    n = a.size();
+
+    //- Bit-reversal permutation.
+    //
+    for (size_t i = 1, j = 0;  i < n;  ++i)
+    {
+        size_t  bit = n >> 1;
+
+        for (;  (j & bit) != 0;  bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+
+        if (i < j)
+        {
+            la_swap(a[i], a[j]);
+        }
+    }
+
+    //- Twiddle factors are computed directly, rather than by recurrence, for accuracy.
+    //
+    R const                     two_pi = R(2) * acos(R(-1));
+    R const                     sign   = inverse ? R(1) : R(-1);
+    std::vector<complex<R>>     roots(n / 2);
+
+    for (size_t k = 0;  k < n / 2;  ++k)
+    {
+        roots[k] = polar(R(1), sign * two_pi * R(k) / R(n));
+    }
+
+    for (size_t len = 2;  len <= n;  len <<= 1)
+    {
+        size_t const    half = len / 2;
+        size_t const    step = n / len;
+
+        for (size_t i = 0;  i < n;  i += len)
+        {
+            for (size_t j = 0;  j < half;  ++j)
+            {
+                complex<R> const    u = a[i + j];
+                complex<R> const    v = a[i + j + half] * roots[j*step];
+
+                a[i + j]        = u + v;
+                a[i + j + half] = u - v;
+            }
+        }
+    }
+
+    if (inverse)
+    {
+        for (auto& x : a)
+        {
+            x /= R(n);
+        }
+    }
+}
+
+//==================================================================================================
+//  Toeplitz product kernel.  Computes y = T x for the R x C Toeplitz matrix whose diagonals are
+//  given by h, with h[k + C - 1] = t(k) for -(C-1) <= k <= R-1, and the C-element operand given
+//  by the callable 'x'.  Since y(i) = sum_j h[i - j + C - 1] * x(j), y consists of elements
+//  C-1 through C+R-2 of the linear convolution of h and x.
+//
+//  The kernel is set up once for a sequence and shape, and may then be applied to any number of
+//  operands, e.g., the columns of a matrix; when the FFT is used, h is transformed at setup.  The
+//  sequence h must outlive the kernel.
+//==================================================================================================
+//
+template<class T>
+class toeplitz_kernel
+{
+  public:
+    toeplitz_kernel(std::vector<T> const& h, size_t rows, size_t cols, size_t threshold);
+
+    template<class XF>
+    std::vector<T>  apply(XF const& x) const;
+
+  private:
+    using cx_type = conditional_t<fft_value<T>::enabled, typename fft_value<T>::type, T>;
+
+    std::vector<T> const&   m_h;
+    size_t                  m_rows;
+    size_t                  m_cols;
+    std::vector<cx_type>    m_fh;       //- Transformed, zero-padded h; empty for the direct method.
+};
+
+template<class T>
+toeplitz_kernel<T>::toeplitz_kernel(std::vector<T> const& h, size_t rows, size_t cols, size_t threshold)
+:   m_h(h)
+,   m_rows(rows)
+,   m_cols(cols)
+,   m_fh()
+{
+    if constexpr (fft_value<T>::enabled)
+    {
+        if (min(rows, cols) >= threshold)
+        {
+            size_t  n = 1;
+
+            while (n < h.size() + cols - 1)
+            {
+                n <<= 1;
+            }
+
+            m_fh.resize(n);
+
+            for (size_t k = 0;  k < h.size();  ++k)
+            {
+                m_fh[k] = cx_type(h[k]);
+            }
+            fft_kernel(m_fh, false);
+        }
+    }
+}
+
+template<class T>
+template<class XF>
+std::vector<T>
+toeplitz_kernel<T>::apply(XF const& x) const
+{
+    std::vector<T>  y(m_rows, T(0));
+
+    if constexpr (fft_value<T>::enabled)
+    {
+        if (!m_fh.empty())
+        {
+            size_t const            n = m_fh.size();
+            std::vector<cx_type>    fx(n);
+
+            for (size_t j = 0;  j < m_cols;  ++j)
+            {
+                fx[j] = cx_type(static_cast<T>(x(j)));
+            }
+
+            fft_kernel(fx, false);
+
+            for (size_t k = 0;  k < n;  ++k)
+            {
+                fx[k] *= m_fh[k];
+            }
+            fft_kernel(fx, true);
+
+            for (size_t i = 0;  i < m_rows;  ++i)
+            {
+                if constexpr (is_complex_v<T>)
+                    y[i] = fx[i + m_cols - 1];
+                else
+                    y[i] = fx[i + m_cols - 1].real();
+            }
+            return y;
+        }
+    }
+
+    for (size_t j = 0;  j < m_cols;  ++j)
+    {
+        T const     xj = static_cast<T>(x(j));
+
+        for (size_t i = 0;  i < m_rows;  ++i)
+        {
+            y[i] += m_h[i + m_cols - 1 - j] * xj;
+        }
+    }
+    return y;
+}
+
+//- Computes a single product; see toeplitz_kernel.
+//
+template<class T, class XF>
+std::vector<T>
+toeplitz_apply(std::vector<T> const& h, size_t rows, size_t cols, XF const& x, size_t threshold)
+{
+    return toeplitz_kernel<T>(h, rows, cols, threshold).apply(x);
+}
+
+}       //- detail namespace
+//==================================================================================================
+//  Toeplitz engine.  Element k of the stored sequence holds the value on diagonal i - j = k - (C-1),
+//  so that the sequence runs from the top-right corner to the bottom-left corner.
+//==================================================================================================
+//
+template<class T, class AT>
+class toeplitz_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using allocator_type  = AT;
+    using pointer         = element_type const*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type const&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    using sequence_type   = dr_vector_engine<T, AT>;
+
+    //- Construct/copy/destroy
+    //
+    ~toeplitz_engine() noexcept = default;
+
+    toeplitz_engine();
+    toeplitz_engine(toeplitz_engine&&) noexcept = default;
+    toeplitz_engine(toeplitz_engine const&) = default;
+    template<class VT>
+    toeplitz_engine(VT const& diagonals, size_type rows, size_type cols);
+
+    toeplitz_engine&    operator =(toeplitz_engine&&) noexcept = default;
+    toeplitz_engine&    operator =(toeplitz_engine const&) = default;
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    //- Element access
+    //
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    //- Sequence access
+    //
+    sequence_type const&    diagonals() const noexcept;
+
+    //- Modifiers
+    //
+    void    swap(toeplitz_engine& rhs) noexcept;
+
+  private:
+    sequence_type   m_diags;
+    size_type       m_rows;
+    size_type       m_cols;
+};
+
+template<class T, class AT>
+toeplitz_engine<T,AT>::toeplitz_engine()
+:   m_diags()
+,   m_rows(0)
+,   m_cols(0)
+{}
+
+template<class T, class AT>
+template<class VT>
+toeplitz_engine<T,AT>::toeplitz_engine(VT const& diagonals, size_type rows, size_type cols)
+:   m_diags()
+,   m_rows(rows)
+,   m_cols(cols)
+{
+    if (rows == 0  ||  cols == 0  ||  static_cast<size_t>(diagonals.elements()) != rows + cols - 1)
+    {
+        throw runtime_error("invalid size");
+    }
+    m_diags = diagonals;
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::size_type
+toeplitz_engine<T,AT>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::size_type
+toeplitz_engine<T,AT>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::size_tuple
+toeplitz_engine<T,AT>::size() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::size_type
+toeplitz_engine<T,AT>::column_capacity() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::size_type
+toeplitz_engine<T,AT>::row_capacity() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::size_tuple
+toeplitz_engine<T,AT>::capacity() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::const_reference
+toeplitz_engine<T,AT>::operator ()(size_type i, size_type j) const
+{
+    return m_diags(i + m_cols - 1 - j);
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::sequence_type const&
+toeplitz_engine<T,AT>::diagonals() const noexcept
+{
+    return m_diags;
+}
+
+template<class T, class AT> inline
+void
+toeplitz_engine<T,AT>::swap(toeplitz_engine& rhs) noexcept
+{
+    m_diags.swap(rhs.m_diags);
+    detail::la_swap(m_rows, rhs.m_rows);
+    detail::la_swap(m_cols, rhs.m_cols);
+}
+
+//==================================================================================================
+//  Circulant engine.  The stored sequence is the first column.
+//==================================================================================================
+//
+template<class T, class AT>
+class circulant_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using allocator_type  = AT;
+    using pointer         = element_type const*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type const&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    using sequence_type   = dr_vector_engine<T, AT>;
+
+    //- Construct/copy/destroy
+    //
+    ~circulant_engine() noexcept = default;
+
+    circulant_engine() = default;
+    circulant_engine(circulant_engine&&) noexcept = default;
+    circulant_engine(circulant_engine const&) = default;
+    template<class VT>
+    circulant_engine(VT const& first_column);
+
+    circulant_engine&   operator =(circulant_engine&&) noexcept = default;
+    circulant_engine&   operator =(circulant_engine const&) = default;
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    //- Element access
+    //
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    //- Sequence access
+    //
+    sequence_type const&    first_column() const noexcept;
+
+    //- Modifiers
+    //
+    void    swap(circulant_engine& rhs) noexcept;
+
+  private:
+    sequence_type   m_col;
+};
+
+template<class T, class AT>
+template<class VT>
+circulant_engine<T,AT>::circulant_engine(VT const& first_column)
+:   m_col()
+{
+    m_col = first_column;
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::size_type
+circulant_engine<T,AT>::columns() const noexcept
+{
+    return m_col.elements();
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::size_type
+circulant_engine<T,AT>::rows() const noexcept
+{
+    return m_col.elements();
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::size_tuple
+circulant_engine<T,AT>::size() const noexcept
+{
+    return size_tuple(m_col.elements(), m_col.elements());
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::size_type
+circulant_engine<T,AT>::column_capacity() const noexcept
+{
+    return m_col.elements();
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::size_type
+circulant_engine<T,AT>::row_capacity() const noexcept
+{
+    return m_col.elements();
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::size_tuple
+circulant_engine<T,AT>::capacity() const noexcept
+{
+    return size_tuple(m_col.elements(), m_col.elements());
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::const_reference
+circulant_engine<T,AT>::operator ()(size_type i, size_type j) const
+{
+    size_type const     n = m_col.elements();
+
+    return m_col((i >= j) ? (i - j) : (i + n - j));
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::sequence_type const&
+circulant_engine<T,AT>::first_column() const noexcept
+{
+    return m_col;
+}
+
+template<class T, class AT> inline
+void
+circulant_engine<T,AT>::swap(circulant_engine& rhs) noexcept
+{
+    m_col.swap(rhs.m_col);
+}
+
+//==================================================================================================
+//                              **** TOEPLITZ AND CIRCULANT MATRICES ****
+//==================================================================================================
+//  toeplitz_matrix() returns the R x C Toeplitz matrix with the given first column (R elements)
+//  and first row (C elements); the first element of the row is ignored in favor of that of the
+//  column.  circulant_matrix() returns the N x N circulant matrix with the given first column.
+//  The operation traits are those of the (first) argument.
+//==================================================================================================
+//
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+toeplitz_matrix(vector<ET1, OT1> const& first_column, vector<ET2, OT2> const& first_row)
+{
+    using elem_type   = common_type_t<typename ET1::value_type, typename ET2::value_type>;
+    using engine_type = toeplitz_engine<elem_type, allocator<elem_type>>;
+
+    size_t const    rows = static_cast<size_t>(first_column.elements());
+    size_t const    cols = static_cast<size_t>(first_row.elements());
+
+    if (rows == 0  ||  cols == 0)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    vector<dr_vector_engine<elem_type, allocator<elem_type>>>   diags(rows + cols - 1);
+
+    for (size_t j = 1;  j < cols;  ++j)
+    {
+        diags(cols - 1 - j) = static_cast<elem_type>(first_row(static_cast<typename ET2::size_type>(j)));
+    }
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        diags(cols - 1 + i) = static_cast<elem_type>(first_column(static_cast<typename ET1::size_type>(i)));
+    }
+
+    matrix<engine_type, OT1>    mr;
+
+    mr.engine() = engine_type(diags.engine(), rows, cols);
+    return mr;
+}
+
+template<class ET1, class OT1>
+auto
+circulant_matrix(vector<ET1, OT1> const& first_column)
+{
+    using elem_type   = typename ET1::value_type;
+    using engine_type = circulant_engine<elem_type, allocator<elem_type>>;
+
+    matrix<engine_type, OT1>    mr;
+
+    mr.engine() = engine_type(first_column.engine());
+    return mr;
+}
+
+namespace detail {
+//==================================================================================================
+//  Returns the diagonal sequence, in the order used by toeplitz_kernel and converted to the
+//  element type R, of a Toeplitz or circulant engine or of its transpose.
+//==================================================================================================
+//
+template<class R, class T, class AT>
+std::vector<R>
+toeplitz_sequence(toeplitz_engine<T, AT> const& eng, bool transposed)
+{
+    auto const&     d = eng.diagonals();
+    size_t const    n = d.elements();
+    std::vector<R>  h(n);
+
+    for (size_t k = 0;  k < n;  ++k)
+    {
+        h[k] = static_cast<R>(transposed ? d(n - 1 - k) : d(k));
+    }
+    return h;
+}
+
+template<class R, class T, class AT>
+std::vector<R>
+toeplitz_sequence(circulant_engine<T, AT> const& eng, bool transposed)
+{
+    auto const&     c = eng.first_column();
+    size_t const    n = c.elements();
+
+    if (n == 0)
+    {
+        return std::vector<R>();
+    }
+
+    std::vector<R>  h(2*n - 1);
+
+    //- h[k] = c((k - (n-1)) mod n) = c((k + 1) mod n); the transpose reverses the sequence.
+    //
+    for (size_t k = 0;  k < 2*n - 1;  ++k)
+    {
+        size_t const    kk = transposed ? (2*n - 2 - k) : k;
+
+        h[k] = static_cast<R>(c((kk + 1) % n));
+    }
+    return h;
+}
+
+//==================================================================================================
+//  Multiplication traits shared by the Toeplitz and circulant engines; the public
+//  specializations of matrix_multiplication_traits below derive from these.  Results are dense
+//  and use the default engine promotion.
+//==================================================================================================
+//
+template<class OT, class OP1, class OP2>
+struct toeplitz_multiplication_traits;
+
+//- structured*vector.
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct toeplitz_multiplication_traits<OT, matrix<ET1, OT1>, vector<ET2, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, ET1, ET2>;
+    using op_traits    = OT;
+    using result_type  = vector<engine_type, op_traits>;
+
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type
+    multiply(matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2)
+    {
+        using elem_type = typename result_type::element_type;
+
+        PrintOperandTypes<result_type>("multiplication_traits (toeplitz*v)", m1, v2);
+
+        size_t const    rows = static_cast<size_t>(m1.rows());
+        size_t const    cols = static_cast<size_t>(m1.columns());
+
+        if (static_cast<size_t>(v2.elements()) != cols)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        auto const  y = toeplitz_apply(toeplitz_sequence<elem_type>(m1.engine(), false), rows, cols,
+                                       [&v2](size_t j) { return v2(static_cast<size_type_2>(j)); },
+                                       fft_threshold_v<OT>);
+        result_type vr;
+
+        if constexpr (result_requires_resize(vr))
+        {
+            vr.resize(static_cast<size_type_r>(rows));
+        }
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            vr(static_cast<size_type_r>(i)) = y[i];
+        }
+        return vr;
+    }
+};
+
+//- vector*structured:  x^T T = (T^T x)^T, where T^T is Toeplitz with the reversed sequence.
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct toeplitz_multiplication_traits<OT, vector<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, ET1, ET2>;
+    using op_traits    = OT;
+    using result_type  = vector<engine_type, op_traits>;
+
+    using size_type_1 = typename vector<ET1, OT1>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type
+    multiply(vector<ET1, OT1> const& v1, matrix<ET2, OT2> const& m2)
+    {
+        using elem_type = typename result_type::element_type;
+
+        PrintOperandTypes<result_type>("multiplication_traits (v*toeplitz)", v1, m2);
+
+        size_t const    rows = static_cast<size_t>(m2.rows());
+        size_t const    cols = static_cast<size_t>(m2.columns());
+
+        if (static_cast<size_t>(v1.elements()) != rows)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        auto const  y = toeplitz_apply(toeplitz_sequence<elem_type>(m2.engine(), true), cols, rows,
+                                       [&v1](size_t i) { return v1(static_cast<size_type_1>(i)); },
+                                       fft_threshold_v<OT>);
+        result_type vr;
+
+        if constexpr (result_requires_resize(vr))
+        {
+            vr.resize(static_cast<size_type_r>(cols));
+        }
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            vr(static_cast<size_type_r>(j)) = y[j];
+        }
+        return vr;
+    }
+};
+
+//- structured*matrix:  each column of the result is the product with a column of the operand.
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct toeplitz_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, ET1, ET2>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    using size_type_2 = typename matrix<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type
+    multiply(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2)
+    {
+        using elem_type = typename result_type::element_type;
+
+        PrintOperandTypes<result_type>("multiplication_traits (toeplitz*m)", m1, m2);
+
+        size_t const    rows  = static_cast<size_t>(m1.rows());
+        size_t const    inner = static_cast<size_t>(m1.columns());
+        size_t const    cols  = static_cast<size_t>(m2.columns());
+
+        if (static_cast<size_t>(m2.rows()) != inner)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        auto const  h = toeplitz_sequence<elem_type>(m1.engine(), false);
+        auto const  kernel = toeplitz_kernel<elem_type>(h, rows, inner, fft_threshold_v<OT>);
+        result_type mr;
+
+        if constexpr (result_requires_resize(mr))
+        {
+            mr.resize(static_cast<size_type_r>(rows), static_cast<size_type_r>(cols));
+        }
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            size_type_2 const   j2 = static_cast<size_type_2>(j);
+            auto const          y  = kernel.apply([&m2, j2](size_t k)
+                                                  { return m2(static_cast<size_type_2>(k), j2); });
+
+            for (size_t i = 0;  i < rows;  ++i)
+            {
+                mr(static_cast<size_type_r>(i), static_cast<size_type_r>(j)) = y[i];
+            }
+        }
+        return mr;
+    }
+};
+
+//- matrix*structured:  each row of the result is the product of a row of the operand with the
+//  structured matrix, i.e., the product of the transposed structured matrix with that row.
+//
+template<class OT, class OP1, class OP2>
+struct toeplitz_right_multiplication_traits;
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct toeplitz_right_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using engine_type  = matrix_multiplication_engine_t<OT, ET1, ET2>;
+    using op_traits    = OT;
+    using result_type  = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<ET1, OT1>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type
+    multiply(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2)
+    {
+        using elem_type = typename result_type::element_type;
+
+        PrintOperandTypes<result_type>("multiplication_traits (m*toeplitz)", m1, m2);
+
+        size_t const    rows  = static_cast<size_t>(m1.rows());
+        size_t const    inner = static_cast<size_t>(m2.rows());
+        size_t const    cols  = static_cast<size_t>(m2.columns());
+
+        if (static_cast<size_t>(m1.columns()) != inner)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        auto const  h = toeplitz_sequence<elem_type>(m2.engine(), true);
+        auto const  kernel = toeplitz_kernel<elem_type>(h, cols, inner, fft_threshold_v<OT>);
+        result_type mr;
+
+        if constexpr (result_requires_resize(mr))
+        {
+            mr.resize(static_cast<size_type_r>(rows), static_cast<size_type_r>(cols));
+        }
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            size_type_1 const   i1 = static_cast<size_type_1>(i);
+            auto const          y  = kernel.apply([&m1, i1](size_t k)
+                                                  { return m1(i1, static_cast<size_type_1>(k)); });
+
+            for (size_t j = 0;  j < cols;  ++j)
+            {
+                mr(static_cast<size_type_r>(i), static_cast<size_type_r>(j)) = y[j];
+            }
+        }
+        return mr;
+    }
+};
+
+}       //- detail namespace
+//==================================================================================================
+//                     **** TOEPLITZ AND CIRCULANT MULTIPLICATION TRAITS ****
+//==================================================================================================
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<toeplitz_engine<T1, A1>, OT1>, vector<ET2, OT2>>
+:   public detail::toeplitz_multiplication_traits<OT, matrix<toeplitz_engine<T1, A1>, OT1>,
+                                                      vector<ET2, OT2>>
+{};
+
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<circulant_engine<T1, A1>, OT1>, vector<ET2, OT2>>
+:   public detail::toeplitz_multiplication_traits<OT, matrix<circulant_engine<T1, A1>, OT1>,
+                                                      vector<ET2, OT2>>
+{};
+
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+struct matrix_multiplication_traits<OT, vector<ET1, OT1>, matrix<toeplitz_engine<T2, A2>, OT2>>
+:   public detail::toeplitz_multiplication_traits<OT, vector<ET1, OT1>,
+                                                      matrix<toeplitz_engine<T2, A2>, OT2>>
+{};
+
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+struct matrix_multiplication_traits<OT, vector<ET1, OT1>, matrix<circulant_engine<T2, A2>, OT2>>
+:   public detail::toeplitz_multiplication_traits<OT, vector<ET1, OT1>,
+                                                      matrix<circulant_engine<T2, A2>, OT2>>
+{};
+
+//- Products with other matrices go through detail::matrix_product_traits (see
+//  multiplication_traits.hpp).  A convolution per column costs more than the other structured
+//  products, so these engines take the lowest priority.
+//
+namespace detail {
+
+template<class T, class A>
+struct structured_multiplication_priority<toeplitz_engine<T, A>>
+:   public integral_constant<int, 1>
+{};
+
+template<class T, class A>
+struct structured_multiplication_priority<circulant_engine<T, A>>
+:   public integral_constant<int, 1>
+{};
+
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_product_traits<OT, matrix<toeplitz_engine<T1, A1>, OT1>, matrix<ET2, OT2>,
+                             structured_side::left>
+:   public toeplitz_multiplication_traits<OT, matrix<toeplitz_engine<T1, A1>, OT1>,
+                                              matrix<ET2, OT2>>
+{};
+
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_product_traits<OT, matrix<circulant_engine<T1, A1>, OT1>, matrix<ET2, OT2>,
+                             structured_side::left>
+:   public toeplitz_multiplication_traits<OT, matrix<circulant_engine<T1, A1>, OT1>,
+                                              matrix<ET2, OT2>>
+{};
+
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+struct matrix_product_traits<OT, matrix<ET1, OT1>, matrix<toeplitz_engine<T2, A2>, OT2>,
+                             structured_side::right>
+:   public toeplitz_right_multiplication_traits<OT, matrix<ET1, OT1>,
+                                                    matrix<toeplitz_engine<T2, A2>, OT2>>
+{};
+
+template<class OT, class ET1, class OT1, class T2, class A2, class OT2>
+struct matrix_product_traits<OT, matrix<ET1, OT1>, matrix<circulant_engine<T2, A2>, OT2>,
+                             structured_side::right>
+:   public toeplitz_right_multiplication_traits<OT, matrix<ET1, OT1>,
+                                                    matrix<circulant_engine<T2, A2>, OT2>>
+{};
+
+}       //- detail namespace
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_TOEPLITZ_ENGINES_HPP_DEFINED
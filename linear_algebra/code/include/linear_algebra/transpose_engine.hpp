@@ -1,7 +1,8 @@
 //==================================================================================================
 //  File:       transpose_engine.hpp
 //
-//  Summary:    This header defines an engine that acts as a "view" of matrix transpose.
+//  Summary:    This header defines an engine that acts as a "view" of matrix transpose, and a
+//              function that transposes a matrix in place.
 //==================================================================================================
 //
 #ifndef LINEAR_ALGEBRA_TRANSPOSE_ENGINE_HPP_DEFINED
@@ -149,5 +150,74 @@ transpose_engine<ET, MCT>::transpose_engine(referent_type& eng)
 :   mp_other(&eng)
 {}
 
+namespace detail {
+
+template<class ET, class = void>
+struct has_transpose_in_place
+:   std::false_type
+{};
+
+template<class ET>
+struct has_transpose_in_place<ET, std::void_t<decltype(std::declval<ET&>().transpose_in_place())>>
+:   std::true_type
+{};
+
+template<class ET> inline constexpr
+bool    has_transpose_in_place_v = has_transpose_in_place<ET>::value;
+
+}       //- detail namespace
+//==================================================================================================
+//  In-place transpose.  Engines that provide transpose_in_place() do it themselves; square
+//  matrices are otherwise transposed by exchanging elements (with the blocked kernel if the engine
+//  has data()), and other resizable ones by materializing the transpose.  A rectangular matrix
+//  whose engine cannot be resized cannot be transposed in place.
+//==================================================================================================
+//
+template<class ET, class OT>
+void
+transpose_in_place(matrix<ET, OT>& m)
+{
+    static_assert(is_writable_engine_v<ET>);
+
+    using size_type = typename matrix<ET, OT>::size_type;
+
+    if constexpr (detail::has_transpose_in_place_v<ET>)
+    {
+        m.engine().transpose_in_place();
+    }
+    else
+    {
+        if (m.rows() == m.columns())
+        {
+            if constexpr (detail::has_data_v<ET>)
+            {
+                detail::transpose_square_kernel(static_cast<size_t>(m.rows()), m.engine().data(),
+                                                static_cast<size_t>(m.engine().column_capacity()));
+            }
+            else
+            {
+                for (size_type i = 0;  i < m.rows();  ++i)
+                {
+                    for (size_type j = i + 1;  j < m.columns();  ++j)
+                    {
+                        detail::la_swap(m(i, j), m(j, i));
+                    }
+                }
+            }
+        }
+        else if constexpr (is_resizable_engine_v<ET>)
+        {
+            ET  tmp;
+
+            tmp = m.t().engine();
+            m.engine().swap(tmp);
+        }
+        else
+        {
+            throw runtime_error("invalid size");
+        }
+    }
+}
+
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_TRANSPOSE_ENGINE_HPP_DEFINED
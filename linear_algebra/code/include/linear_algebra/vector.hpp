@@ -18,8 +18,11 @@ class vector
 {
     static_assert(is_vector_engine_v<ET>);
 
+    using possibly_writable_vector_tag = detail::noe_category_t<ET, writable_vector_engine_tag>;
+
     static constexpr bool   has_cx_elem  = detail::is_complex_v<typename ET::value_type>;
     static constexpr bool   has_eng_iter = detail::has_iteration_v<ET>;
+    static constexpr bool   has_eng_data = detail::has_data_v<ET>;
 
   public:
     //- Types
@@ -31,8 +34,8 @@ class vector
     using size_type              = typename engine_type::size_type;
     using reference              = typename engine_type::reference;
     using const_reference        = typename engine_type::const_reference;
-    using iterator               = detail::engine_m_iter_t<has_eng_iter, ET>; //typename engine_type::iterator;
-    using const_iterator         = detail::engine_c_iter_t<has_eng_iter, ET>; //typename engine_type::const_iterator;
+    using iterator               = detail::engine_m_iter_t<has_eng_data, has_eng_iter, ET>;
+    using const_iterator         = detail::engine_c_iter_t<has_eng_data, has_eng_iter, ET>;
     using reverse_iterator       = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
@@ -41,6 +44,11 @@ class vector
     using hermitian_type         = conditional_t<has_cx_elem, vector, transpose_type>;
     using const_hermitian_type   = conditional_t<has_cx_elem, vector, const_transpose_type>;
 
+    template<size_t S = 0>
+    using slice_type             = vector<slice_engine<engine_type, possibly_writable_vector_tag, S>, OT>;
+    template<size_t S = 0>
+    using const_slice_type       = vector<slice_engine<engine_type, readable_vector_engine_tag, S>, OT>;
+
     //- Construct/copy/destroy
     //
     ~vector() = default;
@@ -105,6 +113,13 @@ class vector
     constexpr hermitian_type        h();
     constexpr const_hermitian_type  h() const;
 
+    constexpr slice_type<>          slice(size_type start, size_type n, size_type stride = 1);
+    constexpr const_slice_type<>    slice(size_type start, size_type n, size_type stride = 1) const;
+    template<size_t S>
+    constexpr slice_type<S>         slice(size_type start, size_type n);
+    template<size_t S>
+    constexpr const_slice_type<S>   slice(size_type start, size_type n) const;
+
     //- Data access
     //
     constexpr engine_type&          engine() noexcept;
@@ -180,7 +195,11 @@ template<class ET, class OT> constexpr
 typename vector<ET,OT>::iterator
 vector<ET,OT>::begin() noexcept
 {
-    if constexpr (has_eng_iter)
+    if constexpr (has_eng_data)
+    {
+        return m_engine.data();
+    }
+    else if constexpr (has_eng_iter)
     {
         return m_engine.begin();
     }
@@ -194,7 +213,11 @@ template<class ET, class OT> constexpr
 typename vector<ET,OT>::const_iterator
 vector<ET,OT>::begin() const noexcept
 {
-    if constexpr (has_eng_iter)
+    if constexpr (has_eng_data)
+    {
+        return m_engine.data();
+    }
+    else if constexpr (has_eng_iter)
     {
         return m_engine.cbegin();
     }
@@ -208,7 +231,11 @@ template<class ET, class OT> constexpr
 typename vector<ET,OT>::iterator
 vector<ET,OT>::end() noexcept
 {
-    if constexpr (has_eng_iter)
+    if constexpr (has_eng_data)
+    {
+        return m_engine.data() + m_engine.elements();
+    }
+    else if constexpr (has_eng_iter)
     {
         return m_engine.end();
     }
@@ -222,7 +249,11 @@ template<class ET, class OT> constexpr
 typename vector<ET,OT>::const_iterator
 vector<ET,OT>::end() const noexcept
 {
-    if constexpr (has_eng_iter)
+    if constexpr (has_eng_data)
+    {
+        return m_engine.data() + m_engine.elements();
+    }
+    else if constexpr (has_eng_iter)
     {
         return m_engine.cend();
     }
@@ -264,7 +295,11 @@ template<class ET, class OT> constexpr
 typename vector<ET,OT>::const_iterator
 vector<ET,OT>::cbegin() const noexcept
 {
-    if constexpr (has_eng_iter)
+    if constexpr (has_eng_data)
+    {
+        return m_engine.data();
+    }
+    else if constexpr (has_eng_iter)
     {
         return m_engine.cbegin();
     }
@@ -278,7 +313,11 @@ template<class ET, class OT> constexpr
 typename vector<ET,OT>::const_iterator
 vector<ET,OT>::cend() const noexcept
 {
-    if constexpr (has_eng_iter)
+    if constexpr (has_eng_data)
+    {
+        return m_engine.data() + m_engine.elements();
+    }
+    else if constexpr (has_eng_iter)
     {
         return m_engine.cend();
     }
@@ -409,6 +448,39 @@ vector<ET,OT>::h() const
     }
 }
 
+//- Slices:  n elements taken every stride elements, starting at element start.  The stride may
+//  also be given at compile time, as a template argument.
+//
+template<class ET, class OT> constexpr 
+typename vector<ET,OT>::template slice_type<>
+vector<ET,OT>::slice(size_type start, size_type n, size_type stride)
+{
+    return slice_type<>(detail::special_ctor_tag(), m_engine, start, n, stride);
+}
+
+template<class ET, class OT> constexpr 
+typename vector<ET,OT>::template const_slice_type<>
+vector<ET,OT>::slice(size_type start, size_type n, size_type stride) const
+{
+    return const_slice_type<>(detail::special_ctor_tag(), m_engine, start, n, stride);
+}
+
+template<class ET, class OT>
+template<size_t S> constexpr 
+typename vector<ET,OT>::template slice_type<S>
+vector<ET,OT>::slice(size_type start, size_type n)
+{
+    return slice_type<S>(detail::special_ctor_tag(), m_engine, start, n, static_cast<size_type>(S));
+}
+
+template<class ET, class OT>
+template<size_t S> constexpr 
+typename vector<ET,OT>::template const_slice_type<S>
+vector<ET,OT>::slice(size_type start, size_type n) const
+{
+    return const_slice_type<S>(detail::special_ctor_tag(), m_engine, start, n, static_cast<size_type>(S));
+}
+
 //-------------
 //- Data access
 //
@@ -0,0 +1,588 @@
+#include "linear_algebra.hpp"
+#include <cassert>
+#include <cmath>
+
+using std::cout;
+using std::endl;
+
+using drm_double    = STD_LA::dyn_matrix<double>;
+using drv_double    = STD_LA::dyn_vector<double>;
+
+//--------------------------------------------------------------------------------------------------
+//- Helper for filling operands with reproducible, well-scaled pseudo-random values.
+//
+template<class ET, class OT>
+void
+FillRandom(STD_LA::matrix<ET, OT>& m, unsigned seed)
+{
+    using size_type    = typename STD_LA::matrix<ET, OT>::size_type;
+    using element_type = typename STD_LA::matrix<ET, OT>::element_type;
+
+    for (size_type i = 0;  i < m.rows();  ++i)
+    {
+        for (size_type j = 0;  j < m.columns();  ++j)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            m(i, j) = static_cast<element_type>((seed >> 8) % 2001) / element_type(1000) - 1;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test compares Strassen-Winograd products against the classical algorithm, for square,
+//  rectangular, and odd-sized operands that require padding.
+//--------------------------------------------------------------------------------------------------
+//
+void t500()
+{
+    PRINT_FNAME();
+
+    using fast_ops   = STD_LA::strassen_operation_traits<16>;
+    using drm_fast   = STD_LA::matrix<STD_LA::dr_matrix_engine<double, std::allocator<double>>, fast_ops>;
+
+    static_assert(std::is_same_v<decltype(std::declval<drm_fast>() * std::declval<drm_fast>()), drm_fast>);
+    static_assert(std::is_same_v<decltype(std::declval<drm_fast>() * std::declval<drv_double>()),
+                                 STD_LA::vector<STD_LA::dr_vector_engine<double, std::allocator<double>>, fast_ops>>);
+
+    size_t const    dims[][3] = { {64, 64, 64}, {100, 37, 81}, {129, 130, 131}, {8, 200, 9} };
+
+    for (auto const& d : dims)
+    {
+        drm_double  a(d[0], d[1]), b(d[1], d[2]);
+        drm_fast    fa(d[0], d[1]), fb(d[1], d[2]);
+
+        FillRandom(a, 1);
+        FillRandom(b, 2);
+        fa = a;
+        fb = b;
+
+        drm_double  c1 = a * b;
+        drm_fast    c2 = fa * fb;
+
+        double  diff = MaxAbsDiff(c1, c2);
+        cout << d[0] << "x" << d[1] << " * " << d[1] << "x" << d[2] << ": max diff = " << diff << endl;
+        assert(c2.rows() == c1.rows()  &&  c2.columns() == c1.columns());
+        assert(diff < 1.0e-10);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test checks the symmetric eigensystem and the SVD by reconstruction, orthogonality of the
+//  computed vectors, and ordering of the computed values; it includes wide, tall, and rank-
+//  deficient operands.
+//--------------------------------------------------------------------------------------------------
+//
+void t501()
+{
+    PRINT_FNAME();
+
+    size_t const    n = 70;
+    drm_double      a(n, n), s(n, n);
+
+    FillRandom(a, 3);
+    s = a + a.t();
+
+    auto [w, z] = STD_LA::symmetric_eigensystem(s);
+
+    drm_double  sz = s * z;
+    drm_double  zw = z;
+    drm_double  ztz = z.t() * z;
+    double      resid = 0, orth = 0;
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        for (size_t j = 0;  j < n;  ++j)
+        {
+            zw(i, j) *= w(j);
+            orth = std::max(orth, std::abs(ztz(i, j) - (i == j ? 1.0 : 0.0)));
+        }
+        if (i > 0) assert(w(i-1) <= w(i));
+    }
+    resid = MaxAbsDiff(sz, zw);
+    cout << "eigensystem " << n << ": residual = " << resid << ", orthogonality = " << orth << endl;
+    assert(resid < 1.0e-10  &&  orth < 1.0e-12);
+
+    auto    wv = STD_LA::symmetric_eigenvalues(s);
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        assert(std::abs(wv(i) - w(i)) < 1.0e-10);
+    }
+
+    size_t const    dims[][2] = { {60, 35}, {35, 60}, {1, 7}, {40, 40} };
+
+    for (auto const& d : dims)
+    {
+        drm_double  b(d[0], d[1]);
+
+        FillRandom(b, 4);
+
+        //- Make the last operand rank-deficient by duplicating columns.
+        //
+        if (d[0] == d[1])
+        {
+            for (size_t i = 0;  i < d[0];  ++i)
+            {
+                b(i, 1) = b(i, 0);
+                b(i, 3) = 2 * b(i, 2);
+            }
+        }
+
+        auto [u, sv, v] = STD_LA::singular_value_decomposition(b);
+        size_t const    p = std::min(d[0], d[1]);
+
+        assert(u.rows() == d[0]  &&  u.columns() == p);
+        assert(v.rows() == d[1]  &&  v.columns() == p);
+
+        drm_double  us = u;
+        for (size_t i = 0;  i < d[0];  ++i)
+        {
+            for (size_t j = 0;  j < p;  ++j)
+            {
+                us(i, j) *= sv(j);
+            }
+        }
+        drm_double  usvt = us * v.t();
+        drm_double  vtv  = v.t() * v;
+
+        orth = 0;
+        for (size_t i = 0;  i < p;  ++i)
+        {
+            for (size_t j = 0;  j < p;  ++j)
+            {
+                orth = std::max(orth, std::abs(vtv(i, j) - (i == j ? 1.0 : 0.0)));
+            }
+            if (i > 0) assert(sv(i-1) >= sv(i));
+            assert(sv(i) >= 0);
+        }
+        resid = MaxAbsDiff(b, usvt);
+        cout << "svd " << d[0] << "x" << d[1] << ": residual = " << resid << ", orthogonality = "
+             << orth << ", smallest = " << sv(p-1) << endl;
+        assert(resid < 1.0e-10  &&  orth < 1.0e-12);
+
+        auto    svv = STD_LA::singular_values(b);
+        for (size_t i = 0;  i < p;  ++i)
+        {
+            assert(std::abs(svv(i) - sv(i)) < 1.0e-10);
+        }
+    }
+
+    //- Read-only external engines have const elements; the results must not.
+    //
+    double const    buf[] = { 2.0, 1.0, 1.0, 2.0, 0.0, 3.0 };
+    auto            cs = STD_LA::external_matrix(buf, 2, 2);
+    auto            cb = STD_LA::external_matrix(buf, 3, 2);
+
+    auto [cw, cz]     = STD_LA::symmetric_eigensystem(cs);
+    auto [cu, cv, cx] = STD_LA::singular_value_decomposition(cb);
+    auto    cwv = STD_LA::symmetric_eigenvalues(cs);
+    auto    cvv = STD_LA::singular_values(cb);
+
+    static_assert(std::is_same_v<decltype(cwv), drv_double>  &&  std::is_same_v<decltype(cz), drm_double>);
+    static_assert(std::is_same_v<decltype(cvv), drv_double>  &&  std::is_same_v<decltype(cu), drm_double>);
+
+    assert(std::abs(cw(0) - 1.0) < 1.0e-14  &&  std::abs(cw(1) - 3.0) < 1.0e-14);
+    assert(std::abs(cwv(1) - 3.0) < 1.0e-14  &&  cx.rows() == 2);
+    assert(std::abs(cv(0) - cvv(0)) < 1.0e-14  &&  std::abs(cv(1) - cvv(1)) < 1.0e-14);
+    assert(std::abs(cv(0)*cv(0) * cv(1)*cv(1) - 54.0) < 1.0e-10);
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test checks LU-based and closed-form inverses/determinants, including the affine and
+//  batched fixed-size paths.
+//--------------------------------------------------------------------------------------------------
+//
+template<class MT>
+double
+InverseError(MT const& m, MT const& mi)
+{
+    double  err = 0;
+    auto    p = m * mi;
+
+    for (size_t i = 0;  i < (size_t) m.rows();  ++i)
+    {
+        for (size_t j = 0;  j < (size_t) m.columns();  ++j)
+        {
+            err = std::max(err, std::abs(p(i, j) - (i == j ? 1.0 : 0.0)));
+        }
+    }
+    return err;
+}
+
+void t502()
+{
+    PRINT_FNAME();
+
+    //- Dynamic matrices, large enough to exercise the blocked factorization.
+    //
+    drm_double  a(90, 90);
+
+    FillRandom(a, 5);
+
+    drm_double  ai  = STD_LA::inverse(a);
+    double      err = InverseError(a, ai);
+    double      det = STD_LA::determinant(a);
+    double      dti = STD_LA::determinant(ai);
+
+    cout << "dyn inverse error = " << err << ", det*det(inv) = " << det*dti << endl;
+    assert(err < 1.0e-10  &&  std::abs(det*dti - 1.0) < 1.0e-8);
+
+    drm_double  b(3, 3);
+    b(0, 0) = 2;  b(0, 1) = 0;  b(0, 2) = 1;
+    b(1, 0) = 1;  b(1, 1) = 3;  b(1, 2) = 2;
+    b(2, 0) = 1;  b(2, 1) = 1;  b(2, 2) = 2;
+    assert(std::abs(STD_LA::determinant(b) - 6.0) < 1.0e-14);
+    assert(std::abs(STD_LA::determinant(b.t()) - 6.0) < 1.0e-14);
+
+    b(2, 0) = 3;  b(2, 1) = 3;  b(2, 2) = 3;
+    b(0, 0) = 1;  b(0, 1) = 1;  b(0, 2) = 1;
+    assert(STD_LA::determinant(b) == 0.0);
+
+    bool    threw = false;
+    try { (void) STD_LA::inverse(b); } catch (std::runtime_error const&) { threw = true; }
+    assert(threw);
+
+    //- Fixed-size matrices, closed-form and affine.
+    //
+    STD_LA::fs_matrix<double, 2, 2>     f2;
+    STD_LA::fs_matrix<double, 3, 3>     f3;
+    STD_LA::fs_matrix<double, 4, 4>     f4, f4a;
+    STD_LA::fs_matrix<double, 5, 5>     f5;
+
+    FillRandom(f2, 6);
+    FillRandom(f3, 7);
+    FillRandom(f4, 8);
+    FillRandom(f4a, 9);
+    FillRandom(f5, 10);
+    f4a(3, 0) = 0;  f4a(3, 1) = 0;  f4a(3, 2) = 0;  f4a(3, 3) = 1;
+
+    static_assert(std::is_same_v<decltype(STD_LA::inverse(f3)), decltype(f3)>);
+    static_assert(std::is_same_v<decltype(STD_LA::inverse(a)), drm_double>);
+    static_assert(std::is_same_v<decltype(STD_LA::inverse(a.t())), drm_double>);
+
+    assert(InverseError(f2, STD_LA::inverse(f2)) < 1.0e-12);
+    assert(InverseError(f3, STD_LA::inverse(f3)) < 1.0e-12);
+    assert(InverseError(f4, STD_LA::inverse(f4)) < 1.0e-12);
+    assert(InverseError(f4a, STD_LA::inverse(f4a)) < 1.0e-12);
+    assert(InverseError(f4a, STD_LA::affine_inverse(f4a)) < 1.0e-12);
+    assert(InverseError(f5, STD_LA::inverse(f5)) < 1.0e-12);
+
+    drm_double  d4(4, 4);
+    d4 = f4;
+    assert(std::abs(STD_LA::determinant(f4) - STD_LA::determinant(d4)) < 1.0e-14);
+    d4 = f4a;
+    assert(std::abs(STD_LA::determinant(f4a) - STD_LA::determinant(d4)) < 1.0e-14);
+
+    //- Batched inverses and determinants, with a partial final group and one singular input.
+    //
+    std::vector<STD_LA::fs_matrix<double, 4, 4>>    src(21), dst(21), aff(21);
+    std::vector<double>                             dets(21);
+
+    for (size_t i = 0;  i < src.size();  ++i)
+    {
+        FillRandom(src[i], 11 + (unsigned) i);
+        aff[i] = src[i];
+        aff[i](3, 0) = 0;  aff[i](3, 1) = 0;  aff[i](3, 2) = 0;  aff[i](3, 3) = 1;
+    }
+    for (size_t j = 0;  j < 4;  ++j)
+    {
+        src[13](2, j) = 0;
+    }
+
+    assert(STD_LA::batch_inverse(src.data(), dst.data(), src.size()) == 1);
+    STD_LA::batch_determinant(src.data(), dets.data(), src.size());
+
+    for (size_t i = 0;  i < src.size();  ++i)
+    {
+        assert(std::abs(dets[i] - STD_LA::determinant(src[i])) < 1.0e-14);
+        if (i != 13) assert(InverseError(src[i], dst[i]) < 1.0e-10);
+    }
+    assert(dets[13] == 0.0);
+
+    assert(STD_LA::batch_affine_inverse(aff.data(), dst.data(), aff.size()) == 0);
+    for (size_t i = 0;  i < aff.size();  ++i)
+    {
+        assert(InverseError(aff[i], dst[i]) < 1.0e-10);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Geometry primitives on fixed-size 3/4-vectors, and their batched SoA variants.
+//
+void t503()
+{
+    PRINT_FNAME();
+
+    using fsv_float3 = STD_LA::fs_vector<float, 3>;
+    using fsv_float4 = STD_LA::fs_vector<float, 4>;
+
+    fsv_float3  x, y, z;
+    fsv_float4  q;
+
+    x(0) = 1;  x(1) = 0;  x(2) = 0;
+    y(0) = 0;  y(1) = 1;  y(2) = 0;
+
+    z = STD_LA::cross(x, y);
+    static_assert(std::is_same_v<decltype(STD_LA::cross(x, y)), fsv_float3>);
+    assert(z(0) == 0.0f  &&  z(1) == 0.0f  &&  z(2) == 1.0f);
+
+    fsv_float3  v;
+    v(0) = 3;  v(1) = 0;  v(2) = 4;
+    assert(STD_LA::length(v) == 5.0f);
+    assert(std::abs(STD_LA::length(STD_LA::normalize(v)) - 1.0f) < 1.0e-6f);
+
+    fsv_float3  zero;
+    zero(0) = 0;  zero(1) = 0;  zero(2) = 0;
+    assert(STD_LA::length(STD_LA::normalize(zero)) == 0.0f);
+
+    //- A quarter turn about z takes x to y; two of them compose to a half turn, taking x to -x.
+    //
+    q = STD_LA::quaternion_from_axis_angle<fsv_float4>(z, 3.14159265f / 2);
+    static_assert(std::is_same_v<decltype(STD_LA::quaternion_from_axis_angle<drv_double>(z, 1.0)), drv_double>);
+    v = STD_LA::quaternion_rotate(q, x);
+    assert(std::abs(v(0)) < 1.0e-6f  &&  std::abs(v(1) - 1.0f) < 1.0e-6f  &&  std::abs(v(2)) < 1.0e-6f);
+
+    v = STD_LA::quaternion_rotate(STD_LA::quaternion_multiply(q, q), x);
+    assert(std::abs(v(0) + 1.0f) < 1.0e-6f  &&  std::abs(v(1)) < 1.0e-6f);
+
+    drv_double  dv(3);
+    dv(0) = 1;  dv(1) = 2;  dv(2) = 2;
+    static_assert(std::is_same_v<decltype(STD_LA::quaternion_rotate(q, dv)), drv_double>);
+    assert(std::abs(STD_LA::length(STD_LA::quaternion_rotate(q, dv)) - 3.0) < 1.0e-6);
+
+    //- Batched variants must agree with the single-vector forms, point by point.
+    //
+    size_t const        n = 37;
+    std::vector<float>  px(n), py(n), pz(n), len(n), cx(n), cy(n), cz(n);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        px[i] = float(i) - 10;  py[i] = float(i % 7);  pz[i] = 2.5f - float(i % 3);
+    }
+    px[5] = py[5] = pz[5] = 0;
+
+    STD_LA::batch_cross(px.data(), py.data(), pz.data(), py.data(), pz.data(), px.data(),
+                        cx.data(), cy.data(), cz.data(), n);
+    STD_LA::batch_length(px.data(), py.data(), pz.data(), len.data(), n);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        v(0) = px[i];  v(1) = py[i];  v(2) = pz[i];
+        y(0) = py[i];  y(1) = pz[i];  y(2) = px[i];
+        z = STD_LA::cross(v, y);
+        assert(z(0) == cx[i]  &&  z(1) == cy[i]  &&  z(2) == cz[i]);
+        assert(std::abs(len[i] - STD_LA::length(v)) < 1.0e-5f);
+    }
+
+    std::vector<float>  ox(px), oy(py), oz(pz), rx(px), ry(py), rz(pz);
+
+    STD_LA::batch_normalize(px.data(), py.data(), pz.data(), n);
+    STD_LA::batch_quaternion_rotate(q, rx.data(), ry.data(), rz.data(), n);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        float const     ln = std::sqrt(px[i]*px[i] + py[i]*py[i] + pz[i]*pz[i]);
+        assert((i == 5) ? ln == 0.0f : std::abs(ln - 1.0f) < 1.0e-6f);
+
+        //- The quarter turn about z maps (x, y, z) to (-y, x, z).
+        //
+        assert(std::abs(rx[i] + oy[i]) < 1.0e-5f  &&  std::abs(ry[i] - ox[i]) < 1.0e-5f);
+        assert(std::abs(rz[i] - oz[i]) < 1.0e-5f);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test runs graph algorithms as semiring products on a small directed graph: shortest
+//  paths (min-plus), reachability by breadth-first search (or-and), and most-reliable paths
+//  (max-times).
+//--------------------------------------------------------------------------------------------------
+//
+void t504()
+{
+    PRINT_FNAME();
+
+    using tropical  = STD_LA::semiring_operation_traits<STD_LA::min_plus_semiring>;
+    using boolean   = STD_LA::semiring_operation_traits<STD_LA::or_and_semiring>;
+    using reliable  = STD_LA::semiring_operation_traits<STD_LA::max_times_semiring>;
+
+    using trop_mat  = STD_LA::matrix<STD_LA::dr_matrix_engine<double, std::allocator<double>>, tropical>;
+    using trop_vec  = STD_LA::vector<STD_LA::dr_vector_engine<double, std::allocator<double>>, tropical>;
+    using bool_mat  = STD_LA::matrix<STD_LA::dr_matrix_engine<bool, std::allocator<bool>>, boolean>;
+    using bool_vec  = STD_LA::vector<STD_LA::dr_vector_engine<bool, std::allocator<bool>>, boolean>;
+    using rel_mat   = STD_LA::matrix<STD_LA::fs_matrix_engine<float, 5, 5>, reliable>;
+
+    static_assert(std::is_same_v<decltype(std::declval<bool_mat>() * std::declval<bool_vec>()), bool_vec>);
+    static_assert(std::is_same_v<decltype(std::declval<trop_vec>() * std::declval<trop_vec>()), double>);
+
+    //- Edges 0->1 (4), 0->2 (1), 2->1 (2), 1->3 (1), 2->3 (5); vertex 4 is unreachable.
+    //
+    size_t const    n   = 5;
+    double const    inf = std::numeric_limits<double>::infinity();
+    size_t const    edges[][2] = { {0, 1}, {0, 2}, {2, 1}, {1, 3}, {2, 3} };
+    double const    weights[]  = { 4, 1, 2, 1, 5 };
+
+    trop_mat    w(n, n);
+    bool_mat    adj(n, n);
+    rel_mat     p;
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        for (size_t j = 0;  j < n;  ++j)
+        {
+            w(i, j)   = (i == j) ? 0.0 : inf;
+            adj(i, j) = false;
+            p(i, j)   = (i == j) ? 1.0f : 0.0f;
+        }
+    }
+    for (size_t e = 0;  e < 5;  ++e)
+    {
+        w(edges[e][0], edges[e][1])   = weights[e];
+        adj(edges[e][0], edges[e][1]) = true;
+        p(edges[e][0], edges[e][1])   = 1.0f / float(weights[e] + 1);
+    }
+
+    //- Bellman-Ford:  n-1 relaxations of the distance vector, computed as vector*matrix.
+    //
+    trop_vec    dist(n);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        dist(i) = (i == 0) ? 0.0 : inf;
+    }
+    for (size_t k = 1;  k < n;  ++k)
+    {
+        dist = dist * w;
+    }
+    assert(dist(0) == 0.0  &&  dist(1) == 3.0  &&  dist(2) == 1.0  &&  dist(3) == 4.0);
+    assert(dist(4) == inf);
+
+    //- The same distances from the transposed matrix*vector form, and from the all-pairs
+    //  distance matrix obtained by repeated squaring.
+    //
+    trop_vec    dist2 = w.t() * (w.t() * (w.t() * dist));
+    trop_mat    apsp  = w * w;
+
+    apsp = apsp * apsp;
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        assert(dist2(i) == dist(i));
+        assert(apsp(0, i) == dist(i));
+    }
+    assert(w.row(0) * w.column(3) == 5.0);
+
+    //- Breadth-first search:  each product expands the frontier by one level.
+    //
+    bool_vec    frontier(n), reached(n);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        frontier(i) = reached(i) = (i == 2);
+    }
+    for (size_t level = 0;  level < n;  ++level)
+    {
+        frontier = frontier * adj;
+        for (size_t i = 0;  i < n;  ++i)
+        {
+            reached(i) = reached(i)  ||  frontier(i);
+        }
+    }
+    assert(!reached(0)  &&  reached(1)  &&  reached(2)  &&  reached(3)  &&  !reached(4));
+
+    //- Most-reliable paths from vertex 0, with edge reliabilities 1/(weight+1).
+    //
+    rel_mat     p2 = p * p;
+    rel_mat     p3 = p2 * p;
+
+    assert(p3(0, 1) == std::max(p(0, 1), p(0, 2) * p(2, 1)));
+    assert(p3(0, 3) == std::max(p3(0, 1) * p(1, 3), p(0, 2) * p(2, 3)));
+    assert(p3(0, 4) == 0.0f);
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Mixed-precision solves:  a well-conditioned system is refined to full accuracy from a float
+//  factorization, while an ill-conditioned one falls back to a full-precision factorization.
+//
+void t505()
+{
+    PRINT_FNAME();
+
+    size_t const    n = 200;
+    drm_double      a(n, n);
+    drm_double      bm(n, 1);
+    drv_double      b(n);
+
+    FillRandom(a, 11u);
+    FillRandom(bm, 12u);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        a(i, i) += 0.5 * n;
+        b(i) = bm(i, 0);
+    }
+
+    auto const  [x, info] = STD_LA::mixed_precision_solve(a, b);
+    drv_double  xd = STD_LA::solve(a, b);
+    drv_double  ax = a * x;
+    double      res = 0, diff = 0;
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        res  = std::max(res, std::abs(ax(i) - b(i)));
+        diff = std::max(diff, std::abs(x(i) - xd(i)));
+    }
+    assert(info.refined  &&  info.iterations >= 2);
+    assert(res < 1.0e-12  &&  diff < 1.0e-12);
+
+    //- The 12x12 Hilbert matrix is far too ill-conditioned for a float factorization.
+    //
+    size_t const    m = 12;
+    drm_double      h(m, m);
+    drv_double      hb(m);
+
+    for (size_t i = 0;  i < m;  ++i)
+    {
+        for (size_t j = 0;  j < m;  ++j)
+        {
+            h(i, j) = 1.0 / double(i + j + 1);
+        }
+        hb(i) = 1.0;
+    }
+
+    auto const  [hx, hinfo] = STD_LA::mixed_precision_solve(h, hb);
+
+    assert(!hinfo.refined  &&  hx == STD_LA::solve(h, hb));
+
+    //- Singular and mismatched systems throw.
+    //
+    int     threw = 0;
+
+    try
+    {
+        STD_LA::mixed_precision_solve(drm_double(3, 3), drv_double(3));
+    }
+    catch (std::runtime_error const&)
+    {
+        ++threw;
+    }
+    try
+    {
+        STD_LA::solve(a, hb);
+    }
+    catch (std::runtime_error const&)
+    {
+        ++threw;
+    }
+    assert(threw == 2);
+}
+
+void
+TestGroup50()
+{
+    PRINT_FNAME();
+
+    t500();
+    t501();
+    t502();
+    t503();
+    t504();
+    t505();
+}
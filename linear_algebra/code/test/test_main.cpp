@@ -9,6 +9,7 @@ void TestGroup40();
 void TestGroup50();
 void TestGroup60();
 void TestGroup70();
+void TestGroup80();
 
 int main()
 {
@@ -17,9 +18,10 @@ int main()
 //    TestGroup20();
 //    TestGroup30();
 //	TestGroup40();
-//	TestGroup50();
-//	TestGroup60();
-//	TestGroup70();
+    TestGroup50();
+    TestGroup60();
+    TestGroup70();
+    TestGroup80();
 
     return 0;
 }
\ No newline at end of file
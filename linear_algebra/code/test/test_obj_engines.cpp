@@ -0,0 +1,1123 @@
+#include "linear_algebra.hpp"
+#include <cassert>
+#include <array>
+#include <cmath>
+#include <numeric>
+
+#ifdef LA_TEST_PARALLEL_ALGORITHMS
+#include <execution>
+#endif
+
+using std::cout;
+using std::endl;
+
+using fsm_double44  = STD_LA::fs_matrix<double, 4, 4>;
+using fsv_double3   = STD_LA::fs_vector<double, 3>;
+using fsv_double4   = STD_LA::fs_vector<double, 4>;
+
+//--------------------------------------------------------------------------------------------------
+//  This test checks the affine transform engine:  storage, result types of its products, and
+//  agreement of the specialized products with the equivalent 4x4 products.
+//--------------------------------------------------------------------------------------------------
+//
+void t600()
+{
+    PRINT_FNAME();
+
+    using affine_double = STD_LA::matrix<STD_LA::affine_engine<double>>;
+
+    static_assert(sizeof(STD_LA::affine_engine<float>) == 12*sizeof(float));
+    static_assert(!STD_LA::detail::is_writable_v<STD_LA::affine_engine<double>>);
+    static_assert(std::is_same_v<decltype(std::declval<affine_double&>()(3, 3)), double const&>);
+
+    affine_double   a{ 0.0, -1.0, 0.0,  1.0,
+                       1.0,  0.0, 0.0,  2.0,
+                       0.0,  0.0, 2.0, -3.0 };
+    affine_double   b{ 1.0,  0.5, 0.0,  4.0,
+                       0.0,  1.0, 0.0,  0.0,
+                       0.2,  0.0, 1.0,  1.0 };
+    affine_double   id;
+    fsm_double44    fa, fb;
+
+    fa = a;
+    fb = b;
+    assert(a(3, 0) == 0.0  &&  a(3, 3) == 1.0  &&  id(2, 2) == 1.0  &&  id(0, 3) == 0.0);
+
+    auto    ab  = a * b;
+    auto    afb = a * fb;
+    auto    fab = fa * b;
+
+    static_assert(std::is_same_v<decltype(ab), affine_double>);
+    static_assert(std::is_same_v<decltype(afb), fsm_double44>);
+    static_assert(std::is_same_v<decltype(fab), fsm_double44>);
+    static_assert(std::is_same_v<decltype(a * fsv_double4()), fsv_double4>);
+
+    fsm_double44    ref = fa * fb;
+
+    PRINT(ab);
+    assert(MaxAbsDiff(ab, ref) == 0.0);
+    assert(MaxAbsDiff(afb, ref) == 0.0);
+    assert(MaxAbsDiff(fab, ref) == 0.0);
+
+    STD_LA::fs_matrix<double, 2, 4>     f24{ 1.0, 2.0, 3.0, 4.0,  -1.0, 0.5, 0.0, 2.0 };
+    auto                                f24b = f24 * b;
+
+    static_assert(std::is_same_v<decltype(f24b), decltype(f24)>);
+    assert(MaxAbsDiff(f24b, f24 * fb) == 0.0);
+
+    fsv_double4     p4{ 1.0, 2.0, 3.0, 1.0 }, d4{ 1.0, 2.0, 3.0, 0.0 };
+    fsv_double3     p3{ 1.0, 2.0, 3.0 };
+    fsv_double4     rp = a * p4, rd = a * d4;
+    fsv_double3     tp = STD_LA::transform_point(a, p3);
+    fsv_double3     td = STD_LA::transform_direction(a, p3);
+    fsv_double3     tpf = STD_LA::transform_point(fa, p3);
+
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        assert(rp(i) == tp(i)  &&  rd(i) == td(i)  &&  tp(i) == tpf(i));
+    }
+    assert(rp(3) == 1.0  &&  rd(3) == 0.0);
+    assert(tp(0) == -1.0  &&  tp(1) == 3.0  &&  tp(2) == 3.0);
+
+    affine_double   ai = STD_LA::inverse(a);
+
+    assert(MaxAbsDiff(a * ai, id) < 1.0e-15);
+    assert(STD_LA::determinant(a) == STD_LA::determinant(fa));
+
+    //- Swaps are limited to the stored rows and the linear part's columns.
+    //
+    STD_LA::affine_engine<double>   e = a.engine();
+    int                             threw = 0;
+
+    e.swap_rows(0, 2);
+    e.swap_columns(0, 1);
+    assert(e(0, 0) == a(2, 1)  &&  e(2, 1) == a(0, 0)  &&  e(0, 3) == a(2, 3));
+
+    for (auto const& ij : { std::pair<size_t, size_t>(0, 3), std::pair<size_t, size_t>(3, 1) })
+    {
+        try
+        {
+            e.swap_rows(ij.first, ij.second);
+        }
+        catch (std::runtime_error const&)
+        {
+            ++threw;
+        }
+        try
+        {
+            e.swap_columns(ij.first, ij.second);
+        }
+        catch (std::runtime_error const&)
+        {
+            ++threw;
+        }
+    }
+    assert(threw == 4);
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Strided slices of vectors, and diagonals of matrices.
+//
+void t601()
+{
+    PRINT_FNAME();
+
+    using drv_double = STD_LA::dyn_vector<double>;
+    using drm_double = STD_LA::dyn_matrix<double>;
+
+    drv_double  v(10);
+
+    for (size_t i = 0;  i < 10;  ++i)
+    {
+        v(i) = (double) i;
+    }
+
+    auto    s1 = v.slice(1, 3, 3);
+    auto    s2 = v.slice<2>(0, 5);
+    auto    s3 = v.slice(2, 3);
+
+    static_assert(std::is_same_v<decltype(s2), drv_double::slice_type<2>>);
+    assert(s1.elements() == 3  &&  s2.elements() == 5);
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        assert(s1(i) == 1.0 + 3*i  &&  s2(i) == 2.0*i  &&  s3(i) == 2.0 + i);
+    }
+
+    s2(4) = -1.0;
+    assert(v(8) == -1.0);
+
+    drv_double const&   cv = v;
+    auto                cs = cv.slice<3>(0, 4);
+    static_assert(std::is_same_v<decltype(cs), drv_double::const_slice_type<3>>);
+    assert(cs(3) == 9.0);
+
+    drv_double  sum = s1 + s3.slice(0, 3);
+    assert(sum.elements() == 3  &&  sum(2) == 7.0 + 4.0);
+
+    //- Diagonals of dynamic, fixed-size, and view engines.
+    //
+    drm_double                      m(3, 4);
+    STD_LA::fs_matrix<double, 3, 4> f;
+
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        for (size_t j = 0;  j < 4;  ++j)
+        {
+            m(i, j) = f(i, j) = (double)(10*i + j);
+        }
+    }
+
+    auto    d0 = m.diagonal();
+    auto    d1 = f.diagonal(1);
+    auto    dm = m.diagonal(-1);
+    auto    dt = m.t().diagonal(-1);
+    auto    de = m.diagonal(4);
+
+    assert(d0.elements() == 3  &&  d1.elements() == 3  &&  dm.elements() == 2);
+    assert(dt.elements() == 3  &&  de.elements() == 0);
+
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        assert(d0(i) == 11.0*i  &&  d1(i) == 11.0*i + 1  &&  dt(i) == d1(i));
+    }
+    assert(dm(0) == 10.0  &&  dm(1) == 21.0);
+
+    d0(2) = 0.0;
+    f.diagonal()(1) = 0.0;
+    assert(m(2, 2) == 0.0  &&  f(1, 1) == 0.0);
+
+    auto    rs = m.row(1).slice(1, 2, 2);
+    assert(rs(0) == 11.0  &&  rs(1) == 13.0);
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Views of views collapse to flat strided views of the owning engine's storage.
+//
+void t602()
+{
+    PRINT_FNAME();
+
+    using drm_double = STD_LA::dyn_matrix<double>;
+    using drv_double = STD_LA::dyn_vector<double>;
+
+    drm_double  m(6, 7);
+
+    for (size_t i = 0;  i < 6;  ++i)
+    {
+        for (size_t j = 0;  j < 7;  ++j)
+        {
+            m(i, j) = (double)(10*i + j);
+        }
+    }
+
+    auto    s1 = m.submatrix(1, 4, 1, 5);
+    auto    s2 = s1.submatrix(1, 3, 1, 4);
+    auto    st = s2.t();
+    auto    r  = st.row(2);
+    auto    c  = st.column(1);
+    auto    d  = st.diagonal(-1);
+
+    using strided_m = STD_LA::strided_matrix_engine<drm_double::engine_type,
+                                                    STD_LA::writable_matrix_engine_tag>;
+    using strided_v = STD_LA::strided_vector_engine<drm_double::engine_type,
+                                                    STD_LA::writable_vector_engine_tag>;
+
+    static_assert(std::is_same_v<decltype(m.t())::engine_type,
+                                 STD_LA::transpose_engine<drm_double::engine_type,
+                                                          STD_LA::writable_matrix_engine_tag>>);
+    static_assert(std::is_same_v<decltype(s2)::engine_type, strided_m>);
+    static_assert(std::is_same_v<decltype(st.t().submatrix(0, 1, 0, 1))::engine_type, strided_m>);
+    static_assert(std::is_same_v<decltype(r)::engine_type, strided_v>);
+    static_assert(std::is_same_v<decltype(m.t().row(0))::engine_type, strided_v>);
+
+    assert(st.rows() == 4  &&  st.columns() == 3);
+    assert(r.elements() == 3  &&  c.elements() == 4  &&  d.elements() == 3);
+
+    //- st(i, j) == m(2 + j, 2 + i)
+    //
+    for (size_t i = 0;  i < 4;  ++i)
+    {
+        for (size_t j = 0;  j < 3;  ++j)
+        {
+            assert(st(i, j) == m(2 + j, 2 + i));
+        }
+        assert(c(i) == m(3, 2 + i));
+    }
+    for (size_t j = 0;  j < 3;  ++j)
+    {
+        assert(r(j) == m(2 + j, 4));
+        assert(d(j) == st(j + 1, j));
+    }
+
+    r(1) = -1.0;
+    assert(m(3, 4) == -1.0);
+
+    drm_double const&   cm  = m;
+    auto                cst = cm.submatrix(0, 3, 0, 3).t();
+    static_assert(std::is_same_v<decltype(cst)::engine_type,
+                                 STD_LA::strided_matrix_engine<drm_double::engine_type,
+                                                               STD_LA::readable_matrix_engine_tag>>);
+    assert(cst(2, 0) == m(0, 2));
+
+    //- Strided views take part in arithmetic like any other engine.
+    //
+    drm_double  p = s2 * st;
+    drv_double  q = st * r;
+
+    assert(p.rows() == 3  &&  p.columns() == 3  &&  q.elements() == 4);
+    assert(p(1, 2) == s2(1, 0)*st(0, 2) + s2(1, 1)*st(1, 2) + s2(1, 2)*st(2, 2) + s2(1, 3)*st(3, 2));
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Vectors over contiguous storage iterate with raw pointers, and so work at full speed with the
+//  standard algorithms, including the parallel ones.
+//
+void t603()
+{
+    PRINT_FNAME();
+
+    using drv_double = STD_LA::dyn_vector<double>;
+    using drm_double = STD_LA::dyn_matrix<double>;
+    using fsv_double = STD_LA::fs_vector<double, 5>;
+
+    static_assert(std::is_same_v<drv_double::iterator, double*>);
+    static_assert(std::is_same_v<drv_double::const_iterator, double const*>);
+    static_assert(std::is_same_v<fsv_double::iterator, double*>);
+    static_assert(std::is_same_v<drm_double::row_type::iterator, double*>);
+    static_assert(std::is_same_v<drm_double::const_row_type::iterator, double const*>);
+    static_assert(!std::is_pointer_v<drm_double::column_type::iterator>);
+
+    size_t const    n = 10000;
+    drv_double      v(n), w(n);
+    drm_double      m(3, n);
+
+    std::iota(v.begin(), v.end(), 1.0);
+    std::copy(v.begin(), v.end(), m.row(1).begin());
+    assert(m(1, n - 1) == (double) n);
+    assert(std::distance(m.row(2).begin(), m.row(2).end()) == (std::ptrdiff_t) n);
+
+    double const    expected = 0.5 * n * (n + 1);
+
+#ifdef LA_TEST_PARALLEL_ALGORITHMS
+    std::transform(std::execution::par_unseq, v.begin(), v.end(), w.begin(),
+                   [](double x) { return 2.0*x; });
+    assert(std::reduce(std::execution::par_unseq, w.cbegin(), w.cend()) == 2.0*expected);
+
+    auto    r = m.row(1);
+    std::for_each(std::execution::par_unseq, r.begin(), r.end(), [](double& x) { x = -x; });
+    assert(std::reduce(std::execution::par_unseq, r.begin(), r.end()) == -expected);
+#else
+    std::transform(v.begin(), v.end(), w.begin(), [](double x) { return 2.0*x; });
+    assert(std::accumulate(w.cbegin(), w.cend(), 0.0) == 2.0*expected);
+#endif
+
+    fsv_double  f{ 5.0, 4.0, 3.0, 2.0, 1.0 };
+    std::sort(f.begin(), f.end());
+    assert(f(0) == 1.0  &&  f(4) == 5.0);
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Factored low-rank matrices:  storage, result types, and agreement of the factored products
+//  with the equivalent dense products.
+//
+void t604()
+{
+    PRINT_FNAME();
+
+    using drv_double = STD_LA::dyn_vector<double>;
+    using drm_double = STD_LA::dyn_matrix<double>;
+    using lrm_double = STD_LA::matrix<STD_LA::low_rank_engine<double, std::allocator<double>>>;
+
+    size_t const    rows = 40, cols = 30, rank = 3;
+    drm_double      u(rows, rank), v(cols, rank), b(cols, 7), c(5, rows);
+    drv_double      s(rank), x(cols), y(rows);
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        y(i) = std::cos(double(i));
+
+        for (size_t k = 0;  k < rank;  ++k)
+        {
+            u(i, k) = std::sin(double(i + 2*k));
+        }
+        for (size_t j = 0;  j < 5;  ++j)
+        {
+            c(j, i) = double(i + j) / rows;
+        }
+    }
+    for (size_t i = 0;  i < cols;  ++i)
+    {
+        x(i) = 1.0 / (i + 1);
+
+        for (size_t k = 0;  k < rank;  ++k)
+        {
+            v(i, k) = std::cos(double(3*i + k));
+        }
+        for (size_t j = 0;  j < 7;  ++j)
+        {
+            b(i, j) = double(i) - double(j);
+        }
+    }
+    for (size_t k = 0;  k < rank;  ++k)
+    {
+        s(k) = double(k + 1);
+    }
+
+    lrm_double  a  = STD_LA::low_rank_matrix(u, s, v);
+    drm_double  ad = a;
+
+    static_assert(std::is_same_v<decltype(a), decltype(STD_LA::low_rank_matrix(u, v))>);
+    static_assert(std::is_same_v<decltype(a * a.t()), drm_double>);
+    static_assert(std::is_same_v<decltype(a * STD_LA::low_rank_matrix(v, u)), lrm_double>);
+    assert(a.rows() == rows  &&  a.columns() == cols  &&  a.engine().rank() == rank);
+    assert(ad(4, 7) == a(4, 7));
+
+    drv_double  ax  = a * x;
+    drv_double  ya  = y * a;
+    drm_double  ab  = a * b;
+    drm_double  ca  = c * a;
+    lrm_double  aa  = a * STD_LA::low_rank_matrix(v, u);
+    drm_double  aad = ad * STD_LA::low_rank_matrix(v, u);
+
+    drv_double  ax_d = ad * x;
+    drv_double  ya_d = y * ad;
+    drm_double  ab_d = ad * b;
+    drm_double  ca_d = c * ad;
+    drm_double  aa_d = ad * (v * u.t());
+
+    double  diff = 0;
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        diff = std::max(diff, std::abs(ax(i) - ax_d(i)));
+    }
+    for (size_t j = 0;  j < cols;  ++j)
+    {
+        diff = std::max(diff, std::abs(ya(j) - ya_d(j)));
+    }
+    diff = std::max(diff, MaxAbsDiff(ab, ab_d));
+    diff = std::max(diff, MaxAbsDiff(ca, ca_d));
+    diff = std::max(diff, MaxAbsDiff(aa, aa_d));
+    diff = std::max(diff, MaxAbsDiff(aad, aa_d));
+
+    assert(aa.rows() == rows  &&  aa.columns() == rows  &&  aa.engine().rank() == rank);
+    assert(diff < 1.0e-10);
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Unevaluated Kronecker products:  element access, result types, and agreement of the vec-trick
+//  products with the equivalent dense products.
+//
+void t605()
+{
+    PRINT_FNAME();
+
+    using drv_double = STD_LA::dyn_vector<double>;
+    using drm_double = STD_LA::dyn_matrix<double>;
+    using krm_double = STD_LA::matrix<STD_LA::kronecker_engine<double, std::allocator<double>>>;
+
+    drm_double  a(3, 4), b(5, 2), c(4, 3), d(2, 6), e(7, 15);
+    drv_double  x(8), y(15);
+
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        for (size_t j = 0;  j < 4;  ++j)
+        {
+            a(i, j) = c(j, i) = double(i + 1) - 0.5*double(j);
+        }
+    }
+    for (size_t i = 0;  i < 5;  ++i)
+    {
+        for (size_t j = 0;  j < 2;  ++j)
+        {
+            b(i, j) = std::sin(double(2*i + j));
+        }
+    }
+    for (size_t j = 0;  j < 6;  ++j)
+    {
+        d(0, j) = -1.0;
+        d(1, j) = double(j) - 1.0;
+    }
+    for (size_t i = 0;  i < 15;  ++i)
+    {
+        y(i) = double(i % 4);
+
+        for (size_t j = 0;  j < 7;  ++j)
+        {
+            e(j, i) = std::cos(double(j + 3*i));
+        }
+    }
+    for (size_t i = 0;  i < 8;  ++i)
+    {
+        x(i) = 1.0 / (i + 1);
+    }
+
+    krm_double  k  = STD_LA::kronecker_product(a, b);
+    drm_double  kd = k;
+
+    static_assert(std::is_same_v<decltype(k * STD_LA::kronecker_product(c, d)), krm_double>);
+    static_assert(std::is_same_v<decltype(k * k.t()), drm_double>);
+    assert(k.rows() == 15  &&  k.columns() == 8);
+    assert(k(7, 5) == a(1, 2) * b(2, 1));
+
+    drv_double  kx = k * x;
+    drv_double  yk = y * k;
+    drm_double  ek = e * k;
+    drm_double  kc = k * STD_LA::kronecker_product(c, d);
+    drm_double  kt = k * kd.t();
+
+    drv_double  kx_d = kd * x;
+    drv_double  yk_d = y * kd;
+    drm_double  ek_d = e * kd;
+    drm_double  kc_d = kd * drm_double(STD_LA::kronecker_product(c, d));
+    drm_double  kt_d = kd * kd.t();
+
+    double  diff = 0;
+
+    for (size_t i = 0;  i < 15;  ++i)
+    {
+        diff = std::max(diff, std::abs(kx(i) - kx_d(i)));
+    }
+    for (size_t j = 0;  j < 8;  ++j)
+    {
+        diff = std::max(diff, std::abs(yk(j) - yk_d(j)));
+    }
+    diff = std::max(diff, MaxAbsDiff(ek, ek_d));
+    diff = std::max(diff, MaxAbsDiff(kc, kc_d));
+    diff = std::max(diff, MaxAbsDiff(kt, kt_d));
+
+    assert(kc.rows() == 15  &&  kc.columns() == 18);
+
+    //- Kronecker products whose factors do not conform, although the products themselves do.
+    //
+    drm_double  f1(2, 3), f2(2, 2), f3(2, 2), f4(3, 1);
+
+    for (size_t i = 0;  i < 2;  ++i)
+    {
+        for (size_t j = 0;  j < 3;  ++j)
+        {
+            f1(i, j) = double(i + 2*j) - 1.0;
+            f4(j, 0) = 0.5*double(j) + 1.0;
+
+            if (j < 2)
+            {
+                f2(i, j) = double(i*j) + 0.25;
+                f3(i, j) = std::sin(double(i + 3*j));
+            }
+        }
+    }
+
+    krm_double  g1 = STD_LA::kronecker_product(f1, f2);
+    krm_double  g2 = STD_LA::kronecker_product(f3, f4);
+    krm_double  gg = g1 * g2;
+    drm_double  gg_d = drm_double(g1) * drm_double(g2);
+
+    assert(gg.rows() == 4  &&  gg.columns() == 2);
+    diff = std::max(diff, MaxAbsDiff(gg, gg_d));
+    assert(diff < 1.0e-12);
+
+    //- A product with an empty factor is empty, and element access reports an invalid index.
+    //
+    STD_LA::kronecker_engine<double, std::allocator<double>>   ke;
+    bool                                                       threw = false;
+
+    assert(ke.rows() == 0  &&  ke.columns() == 0);
+
+    try
+    {
+        (void) ke(0, 0);
+    }
+    catch (std::runtime_error const&)
+    {
+        threw = true;
+    }
+    assert(threw);
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Toeplitz and circulant matrices:  element access, and agreement of the convolution-based
+//  products, both direct and by FFT, with the equivalent dense products.
+//
+void t606()
+{
+    PRINT_FNAME();
+
+    using drv_double = STD_LA::dyn_vector<double>;
+    using drm_double = STD_LA::dyn_matrix<double>;
+    using drv_cx     = STD_LA::dyn_vector<std::complex<double>>;
+    using drm_cx     = STD_LA::dyn_matrix<std::complex<double>>;
+    using fft_ops    = STD_LA::matrix_operation_traits;
+
+    static_assert(STD_LA::detail::fft_threshold_v<fft_ops> == STD_LA::detail::default_fft_threshold);
+
+    size_t const    sizes[][2] = { {5, 3}, {3, 7}, {100, 70}, {129, 300} };
+
+    for (auto const& sz : sizes)
+    {
+        size_t const    rows = sz[0], cols = sz[1];
+        drv_double      c(rows), r(cols), x(cols), y(rows);
+        drm_double      b(cols, 3), a(3, rows);
+
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            c(i) = std::sin(0.1 * i) + 1.0;
+            y(i) = std::cos(0.3 * i);
+
+            for (size_t k = 0;  k < 3;  ++k)
+            {
+                a(k, i) = double(i + k) / rows;
+            }
+        }
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            r(j) = 1.0 / (j + 1);
+            x(j) = double(j % 5) - 2.0;
+
+            for (size_t k = 0;  k < 3;  ++k)
+            {
+                b(j, k) = double(j*k) / cols;
+            }
+        }
+
+        auto        t  = STD_LA::toeplitz_matrix(c, r);
+        drm_double  td = t;
+
+        assert(t.rows() == rows  &&  t.columns() == cols);
+        assert(t(0, 0) == c(0)  &&  t(rows - 1, 0) == c(rows - 1)  &&  t(0, cols - 1) == r(cols - 1));
+        assert(t.engine().diagonals().elements() == rows + cols - 1);
+
+        drv_double  tx = t * x,  tx_d = td * x;
+        drv_double  yt = y * t,  yt_d = y * td;
+        drm_double  tb = t * b,  tb_d = td * b;
+        drm_double  at = a * t,  at_d = a * td;
+
+        double  diff = std::max(MaxAbsDiff(tb, tb_d), MaxAbsDiff(at, at_d));
+
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            diff = std::max(diff, std::abs(tx(i) - tx_d(i)));
+        }
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            diff = std::max(diff, std::abs(yt(j) - yt_d(j)));
+        }
+        cout << rows << "x" << cols << " Toeplitz: max diff = " << diff << endl;
+        assert(diff < 1.0e-10);
+    }
+
+    for (size_t n : { size_t(6), size_t(100) })
+    {
+        drv_cx  c(n), x(n);
+        drm_cx  xr(2, n);
+
+        for (size_t i = 0;  i < n;  ++i)
+        {
+            c(i) = std::complex<double>(double(i), 1.0 / (i + 1));
+            x(i) = std::complex<double>(std::cos(double(i)), std::sin(double(i)));
+            xr(0, i) = x(i);
+            xr(1, i) = std::conj(x(i));
+        }
+
+        auto    m  = STD_LA::circulant_matrix(c);
+        drm_cx  md = m;
+
+        assert(m(0, 1) == c(n - 1)  &&  m(n - 1, 0) == c(n - 1)  &&  m(2, 2) == c(0));
+
+        drv_cx  mx = m * x,  mx_d = md * x;
+        drv_cx  xm = x * m,  xm_d = x * md;
+        drm_cx  xrm = xr * m,  xrm_d = xr * md;
+        double  diff = MaxAbsDiff(xrm, xrm_d);
+
+        for (size_t i = 0;  i < n;  ++i)
+        {
+            diff = std::max(diff, std::abs(mx(i) - mx_d(i)));
+            diff = std::max(diff, std::abs(xm(i) - xm_d(i)));
+        }
+        assert(diff < 1.0e-10);
+    }
+
+    //- A default-constructed (empty) circulant has an empty diagonal sequence.
+    //
+    STD_LA::circulant_engine<double, std::allocator<double>>    e;
+
+    assert(e.rows() == 0  &&  STD_LA::detail::toeplitz_sequence<double>(e, true).empty());
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Tiled matrices:  element and tile access in both tile orders, and agreement of the tile-wise
+//  products with the equivalent dense products for sizes that are not multiples of the tile size.
+//
+template<bool MO>
+void
+TestTiled()
+{
+    using drv_double = STD_LA::dyn_vector<double>;
+    using drm_double = STD_LA::dyn_matrix<double>;
+    using tm_double  = STD_LA::tiled_matrix<double, 8, MO>;
+
+    size_t const    m = 37, k = 45, n = 29;
+    drm_double      ad(m, k), bd(k, n);
+    drv_double      x(k);
+
+    for (size_t i = 0;  i < m;  ++i)
+    {
+        for (size_t j = 0;  j < k;  ++j)
+        {
+            ad(i, j) = std::sin(0.1*i + 0.2*j);
+        }
+    }
+    for (size_t i = 0;  i < k;  ++i)
+    {
+        x(i) = double(i % 7) - 3.0;
+
+        for (size_t j = 0;  j < n;  ++j)
+        {
+            bd(i, j) = std::cos(0.3*i - 0.1*j);
+        }
+    }
+
+    tm_double   a = ad;
+    tm_double   b = bd;
+
+    assert(a.rows() == m  &&  a.columns() == k);
+    assert(a.row_capacity() == 40  &&  a.column_capacity() == 48);
+    assert(a.engine().tile_rows() == 5  &&  a.engine().tile_columns() == 6);
+    assert(MaxAbsDiff(a, ad) == 0.0);
+    assert(a.engine().tile_data(2, 3)[1*8 + 4] == ad(17, 28));
+
+    //- Tile storage is read-only, so the padding cannot be overwritten.
+    //
+    static_assert(std::is_same_v<decltype(a.engine().tile_data(0, 0)), double const*>);
+    static_assert(std::is_same_v<decltype((*a.engine().begin()).data), double const*>);
+
+    //- Each tile is visited once; edge tiles report their valid extents and are zero-padded.
+    //
+    size_t  count = 0, elems = 0;
+
+    for (auto const& tile : a.engine())
+    {
+        assert(tile.data == a.engine().tile_data(tile.row, tile.column));
+        ++count;
+        elems += tile.rows * tile.columns;
+
+        for (size_t i = 0;  i < 8;  ++i)
+        {
+            for (size_t j = 0;  j < 8;  ++j)
+            {
+                assert((i < tile.rows  &&  j < tile.columns)  ||  tile.data[i*8 + j] == 0.0);
+            }
+        }
+    }
+    assert(count == 30  &&  elems == m*k);
+
+    auto    ab = a * b;
+    auto    ax = a * x;
+
+    static_assert(std::is_same_v<decltype(ab), tm_double>);
+
+    //- Mixed products with dense matrices, and with tiled matrices of another element type and
+    //  tile size.
+    //
+    STD_LA::tiled_matrix<float, 4, !MO>     bf = bd;
+
+    drm_double  abd  = a * bd;
+    drm_double  adb  = ad * b;
+    drm_double  abf  = a * bf;
+
+    drm_double  ab_d = ad * bd;
+    drv_double  ax_d = ad * x;
+    double      diff = std::max(MaxAbsDiff(ab, ab_d), std::max(MaxAbsDiff(abd, ab_d), MaxAbsDiff(adb, ab_d)));
+
+    assert(MaxAbsDiff(abf, ab_d) < 1.0e-4);
+
+    for (size_t i = 0;  i < m;  ++i)
+    {
+        diff = std::max(diff, std::abs(ax(i) - ax_d(i)));
+    }
+    assert(diff < 1.0e-12);
+
+    //- Resizing preserves the retained elements and keeps the padding zero.
+    //
+    a.resize(20, 50);
+    assert(a(19, 44) == ad(19, 44)  &&  a(19, 49) == 0.0);
+    a.swap_rows(0, 19);
+    a.swap_columns(1, 40);
+    assert(a(0, 40) == ad(19, 1)  &&  a(19, 1) == ad(0, 40));
+}
+
+void t607()
+{
+    PRINT_FNAME();
+
+    TestTiled<false>();
+    TestTiled<true>();
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Permutation matrices:  element access, agreement of the gather/scatter products with the
+//  equivalent dense products, composition, and in-place permutation by cycle following.
+//
+void t608()
+{
+    PRINT_FNAME();
+
+    using drv_double = STD_LA::dyn_vector<double>;
+    using drm_double = STD_LA::dyn_matrix<double>;
+    using drv_size   = STD_LA::dyn_vector<size_t>;
+
+    size_t const    n = 7;
+    drv_size        idx(n), idx2(n), piv(n);
+    drv_double      x(n);
+    drm_double      a(n, 4), b(3, n);
+
+    size_t const    perm[]  = { 3, 0, 6, 1, 5, 4, 2 };
+    size_t const    perm2[] = { 1, 2, 0, 3, 6, 5, 4 };
+    size_t const    pivs[]  = { 4, 1, 5, 6, 4, 5, 6 };
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        idx(i)  = perm[i];
+        idx2(i) = perm2[i];
+        piv(i)  = pivs[i];
+        x(i)    = 1.5 * i - 2.0;
+
+        for (size_t j = 0;  j < 4;  ++j)
+        {
+            a(i, j) = 10.0*i + j;
+        }
+        for (size_t j = 0;  j < 3;  ++j)
+        {
+            b(j, i) = 10.0*j + i;
+        }
+    }
+
+    auto        p  = STD_LA::permutation_matrix<double>(idx);
+    auto        p2 = STD_LA::permutation_matrix<double>(idx2);
+    drm_double  pd = p;
+    drm_double  p2d = p2;
+
+    assert(p(0, 3) == 1.0  &&  p(0, 0) == 0.0  &&  p(6, 2) == 1.0);
+
+    drv_double  px = p * x,  px_d = pd * x;
+    drv_double  xp = x * p,  xp_d = x * pd;
+    drm_double  pa = p * a,  pa_d = pd * a;
+    drm_double  bp = b * p,  bp_d = b * pd;
+
+    assert(MaxAbsDiff(pa, pa_d) == 0.0);
+    assert(MaxAbsDiff(bp, bp_d) == 0.0);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        assert(px(i) == px_d(i)  &&  xp(i) == xp_d(i));
+    }
+
+    //- Composition and inversion stay in permutation form.
+    //
+    auto    pp = p * p2;
+
+    static_assert(std::is_same_v<decltype(pp), decltype(p)>);
+    assert(MaxAbsDiff(pp, pd * p2d) == 0.0);
+
+    auto        pinv = p;
+    drm_double  id(n, n);
+
+    pinv.engine() = p.engine().inverse();
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        id(i, i) = 1.0;
+    }
+    assert(MaxAbsDiff(pinv * p, id) == 0.0);
+    assert(MaxAbsDiff(pinv, pd.t()) == 0.0);
+    assert(MaxAbsDiff(p.t() * p, id) == 0.0);
+
+    //- In-place permutation matches the out-of-place products.
+    //
+    drm_double  ai = a;
+    drm_double  bi = b;
+    drv_double  xi = x;
+
+    STD_LA::permute_rows(ai, p);
+    STD_LA::permute_columns(bi, p);
+    STD_LA::permute(xi, p);
+    assert(MaxAbsDiff(ai, pa) == 0.0);
+    assert(MaxAbsDiff(bi, bp) == 0.0);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        assert(xi(i) == px(i));
+    }
+
+    //- Row interchanges recorded as pivots.
+    //
+    auto        pv = STD_LA::pivot_permutation(piv);
+    drm_double  av = a;
+
+    for (size_t k = 0;  k < n;  ++k)
+    {
+        av.swap_rows(k, pivs[k]);
+    }
+    assert(MaxAbsDiff(pv * a, av) == 0.0);
+
+    bool    threw = false;
+
+    try
+    {
+        idx(1) = 3;
+        STD_LA::permutation_matrix(idx);
+    }
+    catch (std::runtime_error const&)
+    {
+        threw = true;
+    }
+    assert(threw);
+}
+
+//--------------------------------------------------------------------------------------------------
+//- A minimal stand-in for std::mdspan with std::layout_stride, providing just the interface that
+//  external_vector(), external_matrix(), and to_mdspan() rely upon.
+//
+template<class T, size_t R>
+struct mock_mdspan
+{
+    struct extents_type
+    {
+        using index_type = size_t;
+
+        template<class... I>
+        extents_type(I... ext) : m_ext{ static_cast<size_t>(ext)... } {}
+
+        std::array<size_t, R>   m_ext;
+    };
+
+    struct mapping_type
+    {
+        mapping_type(extents_type const& ext, std::array<size_t, R> const& str)
+        :   m_ext(ext), m_str(str) {}
+
+        extents_type            m_ext;
+        std::array<size_t, R>   m_str;
+    };
+
+    mock_mdspan(T* p, mapping_type const& map) : mp_data(p), m_map(map) {}
+
+    static constexpr size_t     rank() { return R; }
+    size_t      extent(size_t r) const  { return m_map.m_ext.m_ext[r]; }
+    size_t      stride(size_t r) const  { return m_map.m_str[r]; }
+    T*          data_handle() const     { return mp_data; }
+
+    T*              mp_data;
+    mapping_type    m_map;
+};
+
+//--------------------------------------------------------------------------------------------------
+//- External engines:  dense and strided views of caller-owned buffers, writes through them,
+//  arithmetic with owning objects, and round trips through mdspan-like views without copying.
+//
+void t609()
+{
+    PRINT_FNAME();
+
+    using drv_double = STD_LA::dyn_vector<double>;
+    using drm_double = STD_LA::dyn_matrix<double>;
+
+    size_t const    rows = 5, cols = 4, ld = 6;
+    double          buf[rows*ld];
+    double          cm[rows*cols];
+    double          xb[2*cols];
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        for (size_t j = 0;  j < ld;  ++j)
+        {
+            buf[i*ld + j] = (j < cols) ? 10.0*i + j : -1.0;
+        }
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            cm[j*rows + i] = 10.0*i + j;
+        }
+    }
+    for (size_t j = 0;  j < 2*cols;  ++j)
+    {
+        xb[j] = (j % 2 == 0) ? 1.0 + j/2 : 0.0;
+    }
+
+    //- A dense view with a leading dimension exposes data(); a column-major view does not.
+    //
+    auto    a  = STD_LA::external_matrix(buf, rows, cols, ld);
+    auto    ac = STD_LA::external_matrix(cm, rows, cols, ptrdiff_t(1), ptrdiff_t(rows));
+    auto    x  = STD_LA::external_vector(xb, cols, 2);
+    auto    cb = STD_LA::external_vector(static_cast<double const*>(xb), 2*cols);
+
+    static_assert(STD_LA::detail::has_data_v<decltype(a)::engine_type>);
+    static_assert(!STD_LA::detail::has_data_v<decltype(ac)::engine_type>);
+    static_assert(std::is_same_v<decltype(cb)::engine_type::engine_category,
+                                 STD_LA::readable_vector_engine_tag>);
+
+    drm_double  ad = a;
+    drv_double  xd(cols);
+
+    xd = x;
+
+    assert(ad == ac  &&  a == ac  &&  a.engine().column_capacity() == ld);
+    assert(xd(3) == 4.0  &&  cb(6) == 4.0);
+
+    drv_double  ax  = a * x;
+    drv_double  acx = ac * x;
+    drm_double  sum = a + ac;
+
+    assert(ax == ad * xd  &&  acx == ax  &&  sum == 2.0 * ad);
+
+    //- Products of dense views use the blocked kernel, and agree with the element-wise product
+    //  of the column-major view.
+    //
+    double          bt[cols*ld];
+
+    for (size_t i = 0;  i < cols*ld;  ++i)
+    {
+        bt[i] = (i % ld < rows) ? 0.5*double(i % 7) - 1.0 : -1.0;
+    }
+
+    auto        bx  = STD_LA::external_matrix(static_cast<double const*>(bt), cols, rows, ld);
+    drm_double  ab  = a * bx;
+    drm_double  acb = ac * bx;
+
+    assert(ab.rows() == rows  &&  ab.columns() == rows  &&  ab == acb);
+
+    //- Writes go to the caller's buffer, and leave the padding alone.
+    //
+    a(2, 3) = 99.0;
+    assert(buf[2*ld + 3] == 99.0  &&  buf[2*ld + 4] == -1.0);
+
+    a = 2.0 * ad;
+    assert(buf[4*ld + 3] == 86.0  &&  buf[4*ld + 5] == -1.0);
+
+    ac.swap_rows(0, 4);
+    assert(cm[0] == 40.0  &&  cm[4] == 0.0);
+
+    bool    threw = false;
+
+    try
+    {
+        STD_LA::external_matrix(buf, rows, cols, size_t(2));
+    }
+    catch (std::runtime_error const&)
+    {
+        threw = true;
+    }
+    assert(threw);
+
+    //- Round trips through mdspan-like views share storage.
+    //
+    using mds2 = mock_mdspan<double, 2>;
+    using mds1 = mock_mdspan<double, 1>;
+
+    mds2    ma = STD_LA::to_mdspan<mds2>(a);
+    mds2    mc = STD_LA::to_mdspan<mds2>(ac);
+    mds1    mx = STD_LA::to_mdspan<mds1>(x);
+    mds1    md = STD_LA::to_mdspan<mds1>(xd);
+
+    assert(ma.data_handle() == buf  &&  ma.stride(0) == ld  &&  ma.stride(1) == 1);
+    assert(mc.data_handle() == cm  &&  mc.stride(0) == 1  &&  mc.stride(1) == rows);
+    assert(mx.data_handle() == xb  &&  mx.stride(0) == 2  &&  md.stride(0) == 1);
+
+    auto    b  = STD_LA::external_matrix(ma);
+    auto    bc = STD_LA::external_matrix(mc);
+    auto    y  = STD_LA::external_vector(mx);
+
+    assert(&b(1, 2) == &a(1, 2)  &&  &bc(3, 1) == &ac(3, 1)  &&  &y(3) == &x(3));
+    assert(b == a  &&  bc == ac  &&  y == x);
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Products of two different structured engines compile, whichever headers are included, and
+//  agree with the equivalent dense products.
+//
+void t610()
+{
+    PRINT_FNAME();
+
+    using drm_double = STD_LA::dyn_matrix<double>;
+    using drv_double = STD_LA::dyn_vector<double>;
+    using drv_size   = STD_LA::dyn_vector<size_t>;
+
+    size_t const    n = 6;
+    drm_double      u(n, 2), v(n, 2), a(2, 2), b(3, 3);
+    drv_double      c(n), r(n);
+    drv_size        idx(n);
+
+    size_t const    perm[] = { 4, 0, 5, 2, 1, 3 };
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        c(i)   = 1.0 / (i + 1);
+        r(i)   = double(i % 3) - 1.0;
+        idx(i) = perm[i];
+
+        for (size_t k = 0;  k < 2;  ++k)
+        {
+            u(i, k) = std::sin(double(i + 3*k));
+            v(i, k) = std::cos(double(2*i + k));
+        }
+    }
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        for (size_t j = 0;  j < 3;  ++j)
+        {
+            b(i, j) = double(i*3 + j) - 4.0;
+
+            if (i < 2  &&  j < 2)
+            {
+                a(i, j) = double(i) - 2.0*double(j) + 0.5;
+            }
+        }
+    }
+
+    auto    lr = STD_LA::low_rank_matrix(u, v);
+    auto    kr = STD_LA::kronecker_product(a, b);
+    auto    pm = STD_LA::permutation_matrix<double>(idx);
+    auto    tp = STD_LA::toeplitz_matrix(c, r);
+
+    auto    check = [](auto const& m1, auto const& m2)
+                    {
+                        drm_double const    p = m1 * m2;
+                        drm_double const    d = drm_double(m1) * drm_double(m2);
+
+                        assert(p.rows() == d.rows()  &&  p.columns() == d.columns());
+                        assert(MaxAbsDiff(p, d) < 1.0e-12);
+                    };
+
+    check(lr, kr);
+    check(kr, lr);
+    check(lr, pm);
+    check(pm, lr);
+    check(lr, tp);
+    check(tp, lr);
+    check(kr, pm);
+    check(pm, kr);
+    check(kr, tp);
+    check(tp, kr);
+    check(tp, STD_LA::circulant_matrix(c));
+    check(STD_LA::circulant_matrix(c), tp);
+    check(tp, pm);
+    check(pm, tp);
+    check(pm, STD_LA::permutation_matrix<double>(idx));
+}
+
+void
+TestGroup60()
+{
+    PRINT_FNAME();
+
+    t600();
+    t601();
+    t602();
+    t603();
+    t604();
+    t605();
+    t606();
+    t607();
+    t608();
+    t609();
+    t610();
+}
@@ -1,5 +1,6 @@
 #include "linear_algebra.hpp"
 #include <array>
+#include <cassert>
 
 using std::cout;
 using std::endl;
@@ -172,6 +173,34 @@ constexpr double t003()
 
 constexpr double cd = t003();
 
+//- Assigning a matrix with a different engine to a fixed-size matrix copies every row.
+//
+void t004()
+{
+    PRINT_FNAME();
+
+    STD_LA::dyn_matrix<float>   src(3, 5);
+    fsm_double_35               dst;
+
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        for (size_t j = 0;  j < 5;  ++j)
+        {
+            src(i, j) = float(10*i + j + 1);
+        }
+    }
+
+    dst = src;
+
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        for (size_t j = 0;  j < 5;  ++j)
+        {
+            assert(dst(i, j) == double(10*i + j + 1));
+        }
+    }
+}
+
 void
 TestGroup00()
 {
@@ -181,4 +210,5 @@ TestGroup00()
 
     t000();
     t001();
+    t004();
 }
@@ -0,0 +1,339 @@
+#include "linear_algebra.hpp"
+#include <cassert>
+#include <cmath>
+#include <map>
+
+#ifdef LA_TEST_PARALLEL_ALGORITHMS
+#include <execution>
+#endif
+
+using std::cout;
+using std::endl;
+
+using drm_double    = STD_LA::dyn_matrix<double>;
+using drm_float     = STD_LA::dyn_matrix<float>;
+using drv_double    = STD_LA::dyn_vector<double>;
+using drv_float     = STD_LA::dyn_vector<float>;
+using fsm_double34  = STD_LA::fs_matrix<double, 3, 4>;
+using fsm_double44  = STD_LA::fs_matrix<double, 4, 4>;
+
+//--------------------------------------------------------------------------------------------------
+//- elementwise_map, zip_with, and Hadamard product, over dense and view engines.
+//
+void t700()
+{
+    PRINT_FNAME();
+
+    drv_double  v(100);
+    drv_float   w(100);
+
+    for (size_t i = 0;  i < 100;  ++i)
+    {
+        v(i) = double(i) - 50;
+        w(i) = float(i) / 4;
+    }
+
+    auto    relu = [](double x) { return (x > 0) ? x : 0.0; };
+    auto    vr = STD_LA::elementwise_map(relu, v);
+    auto    vh = STD_LA::hadamard(v, w);
+    auto    vd = STD_LA::zip_with([](double x, float y) { return x / (y + 1); }, v, w);
+
+    static_assert(std::is_same_v<decltype(vr), drv_double>);
+    static_assert(std::is_same_v<decltype(vh), decltype(v + w)>);
+
+    //- The name does not collide with std::map when both namespaces are in use.
+    {
+        using namespace std;
+        using namespace STD_LA;
+
+        assert(elementwise_map(relu, v) == vr);
+    }
+
+    for (size_t i = 0;  i < 100;  ++i)
+    {
+        assert(vr(i) == std::max(v(i), 0.0));
+        assert(vh(i) == v(i) * w(i));
+        assert(vd(i) == v(i) / (w(i) + 1));
+    }
+
+    //- Matrices with padded rows, fixed-size matrices, and transposed views.
+    //
+    drm_double      a(3, 4, 5, 7), b(4, 3);
+    fsm_double34    f;
+
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        for (size_t j = 0;  j < 4;  ++j)
+        {
+            a(i, j) = f(i, j) = b(j, i) = double(4*i + j) - 5;
+        }
+    }
+
+    auto    ae = STD_LA::elementwise_map([](double x) { return std::exp(x); }, a);
+    auto    fc = STD_LA::elementwise_map([](double x) { return std::clamp(x, -1.0, 1.0); }, f);
+    auto    ab = STD_LA::hadamard(a, b.t());
+    auto    fa = STD_LA::zip_with([](double x, double y) { return std::abs(x - y); }, f, a);
+
+    static_assert(std::is_same_v<decltype(fc), fsm_double34>);
+    assert(ae.rows() == 3  &&  ae.columns() == 4);
+
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        for (size_t j = 0;  j < 4;  ++j)
+        {
+            assert(ae(i, j) == std::exp(a(i, j)));
+            assert(fc(i, j) == std::clamp(f(i, j), -1.0, 1.0));
+            assert(ab(i, j) == a(i, j) * a(i, j));
+            assert(fa(i, j) == 0.0);
+        }
+    }
+
+    bool    threw = false;
+    try
+    {
+        STD_LA::hadamard(a, b);
+    }
+    catch (std::runtime_error const&)
+    {
+        threw = true;
+    }
+    assert(threw);
+
+#ifdef LA_TEST_PARALLEL_ALGORITHMS
+    drm_double  big(300, 200), big2(300, 200, 300, 256);
+
+    for (size_t i = 0;  i < 300;  ++i)
+    {
+        for (size_t j = 0;  j < 200;  ++j)
+        {
+            big(i, j) = big2(i, j) = double(i) - double(j);
+        }
+    }
+
+    auto    pm = STD_LA::elementwise_map(std::execution::par_unseq, relu, big);
+    auto    ph = STD_LA::hadamard(std::execution::par_unseq, big, big2);
+    auto    pv = STD_LA::zip_with(std::execution::par, [](double x, float y) { return x + y; }, v, w);
+
+    for (size_t i = 0;  i < 300;  ++i)
+    {
+        for (size_t j = 0;  j < 200;  ++j)
+        {
+            assert(pm(i, j) == relu(big(i, j)));
+            assert(ph(i, j) == big(i, j) * big(i, j));
+        }
+    }
+    for (size_t i = 0;  i < 100;  ++i)
+    {
+        assert(pv(i) == v(i) + w(i));
+    }
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Row and column broadcasting, out of place and in place.
+//
+void t701()
+{
+    PRINT_FNAME();
+
+    drm_double  m(4, 3, 6, 5);
+    drv_double  means(3), weights(4);
+
+    for (size_t i = 0;  i < 4;  ++i)
+    {
+        weights(i) = double(i + 1);
+
+        for (size_t j = 0;  j < 3;  ++j)
+        {
+            m(i, j) = double(10*i + j);
+        }
+    }
+    for (size_t j = 0;  j < 3;  ++j)
+    {
+        means(j) = 15.0 + j;
+    }
+
+    auto    c = STD_LA::broadcast_rows(std::minus<>(), m, means);
+    auto    s = STD_LA::broadcast_columns(std::multiplies<>(), m, weights);
+    auto    t = STD_LA::broadcast_rows(std::minus<>(), m.t(), weights);
+
+    static_assert(std::is_same_v<decltype(c), drm_double>);
+
+    for (size_t i = 0;  i < 4;  ++i)
+    {
+        for (size_t j = 0;  j < 3;  ++j)
+        {
+            assert(c(i, j) == m(i, j) - means(j));
+            assert(s(i, j) == m(i, j) * weights(i));
+            assert(t(j, i) == m(i, j) - weights(i));
+        }
+    }
+
+    fsm_double34    f;
+    STD_LA::fs_vector<float, 3>     fw;
+
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        fw(i) = float(i) + 0.5f;
+
+        for (size_t j = 0;  j < 4;  ++j)
+        {
+            f(i, j) = double(i + j);
+        }
+    }
+
+    STD_LA::broadcast_columns_in_place(std::divides<>(), f, fw);
+    STD_LA::broadcast_rows_in_place(std::minus<>(), m, means);
+
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        for (size_t j = 0;  j < 4;  ++j)
+        {
+            assert(f(i, j) == double(i + j) / fw(i));
+        }
+    }
+    assert(m == c);
+
+    bool    threw = false;
+    try
+    {
+        STD_LA::broadcast_rows(std::plus<>(), m, weights);
+    }
+    catch (std::runtime_error const&)
+    {
+        threw = true;
+    }
+    assert(threw);
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Materialized and in-place transposes:  blocked copies from transpose views, strided views, and
+//  column-major external buffers, and in-place transposes of square, contiguous rectangular, and
+//  padded rectangular matrices.
+//
+template<class MT>
+bool
+IsTransposeOf(MT const& t, drm_double const& a)
+{
+    if ((size_t) t.rows() != (size_t) a.columns()  ||  (size_t) t.columns() != (size_t) a.rows())
+    {
+        return false;
+    }
+    for (size_t i = 0;  i < (size_t) a.rows();  ++i)
+    {
+        for (size_t j = 0;  j < (size_t) a.columns();  ++j)
+        {
+            if (t(j, i) != a(i, j))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void t702()
+{
+    PRINT_FNAME();
+
+    for (auto [m, n] : { std::pair<size_t, size_t>(1, 1), { 3, 11 }, { 131, 77 }, { 700, 600 } })
+    {
+        drm_double  a(m, n, m + 3, n + 5);
+
+        for (size_t i = 0;  i < m;  ++i)
+        {
+            for (size_t j = 0;  j < n;  ++j)
+            {
+                a(i, j) = 1000.0*i + j;
+            }
+        }
+
+        drm_double  at = a.t();
+        drm_double  st = a.submatrix(1 % m, m - 1 % m, 0, n).t();
+        drm_double  ac = at.t();
+        drm_double  ap = a;
+
+        assert(IsTransposeOf(at, a));
+        assert(ac == a  &&  ac.engine().capacity() == ac.engine().size());
+        assert(ap.engine().capacity() != ap.engine().size());
+
+        for (size_t i = 0;  i + 1 % m < m;  ++i)
+        {
+            for (size_t j = 0;  j < n;  ++j)
+            {
+                assert(st(j, i) == a(i + 1 % m, j));
+            }
+        }
+
+        //- A column-major buffer is the transpose of a row-major one.
+        //
+        std::vector<double>     cm(m*n);
+
+        for (size_t i = 0;  i < m;  ++i)
+        {
+            for (size_t j = 0;  j < n;  ++j)
+            {
+                cm[j*m + i] = a(i, j);
+            }
+        }
+
+        drm_double  fc = STD_LA::external_matrix(cm.data(), m, n, ptrdiff_t(1), ptrdiff_t(m));
+
+        assert(fc == a);
+
+        //- In place:  ac has no spare capacity, while ap does.
+        //
+        STD_LA::transpose_in_place(ac);
+        STD_LA::transpose_in_place(ap);
+        assert(ac == at  &&  ap == at);
+        STD_LA::transpose_in_place(ac);
+        assert(ac == a);
+    }
+
+    //- Square matrices are transposed in place, with or without data().
+    //
+    fsm_double44    f;
+    double          sq[25];
+
+    for (size_t i = 0;  i < 4;  ++i)
+    {
+        for (size_t j = 0;  j < 4;  ++j)
+        {
+            f(i, j) = 4.0*i + j;
+        }
+    }
+    for (size_t k = 0;  k < 25;  ++k)
+    {
+        sq[k] = k;
+    }
+
+    auto    e = STD_LA::external_matrix(sq, 5, 5, ptrdiff_t(5), ptrdiff_t(1));
+
+    STD_LA::transpose_in_place(f);
+    STD_LA::transpose_in_place(e);
+    assert(f(1, 2) == 9.0  &&  f(2, 1) == 6.0  &&  f(3, 3) == 15.0);
+    assert(sq[1] == 5.0  &&  sq[5] == 1.0  &&  sq[24] == 24.0);
+
+    bool    threw = false;
+
+    try
+    {
+        fsm_double34    g;
+        STD_LA::transpose_in_place(g);
+    }
+    catch (std::runtime_error const&)
+    {
+        threw = true;
+    }
+    assert(threw);
+}
+
+void
+TestGroup70()
+{
+    PRINT_FNAME();
+
+    t700();
+    t701();
+    t702();
+}
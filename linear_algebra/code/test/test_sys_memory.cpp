@@ -0,0 +1,565 @@
+#include "linear_algebra.hpp"
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+#ifdef LA_HAS_SHM_ENGINES
+#include <sys/wait.h>
+#endif
+
+using std::cout;
+using std::endl;
+
+//--------------------------------------------------------------------------------------------------
+//- An allocator that counts the elements it allocates and deallocates, for checking that the
+//  dynamic engines release their storage through their allocators.
+//
+struct alloc_counts
+{
+    static inline size_t    allocated   = 0;
+    static inline size_t    deallocated = 0;
+};
+
+template<class T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator() noexcept = default;
+    template<class U>
+    counting_allocator(counting_allocator<U> const&) noexcept {}
+
+    T*      allocate(size_t n)
+            {
+                alloc_counts::allocated += n;
+                return std::allocator<T>().allocate(n);
+            }
+    void    deallocate(T* p, size_t n) noexcept
+            {
+                alloc_counts::deallocated += n;
+                std::allocator<T>().deallocate(p, n);
+            }
+};
+
+template<class T, class U>
+bool    operator ==(counting_allocator<T> const&, counting_allocator<U> const&) { return true; }
+template<class T, class U>
+bool    operator !=(counting_allocator<T> const&, counting_allocator<U> const&) { return false; }
+
+//--------------------------------------------------------------------------------------------------
+//- NUMA-aware allocation:  buffers large enough to be initialized in parallel are zeroed and
+//  copied correctly under both placements, partitions cover every element exactly once, and
+//  engines release their storage through the allocator.
+//
+template<STD_LA::numa_placement P>
+void
+TestNumaPlacement()
+{
+    using alloc_type = STD_LA::numa_allocator<double, P>;
+    using drm_numa   = STD_LA::dyn_matrix<double, alloc_type>;
+    using drv_numa   = STD_LA::dyn_vector<double, alloc_type>;
+
+    static_assert(STD_LA::detail::has_first_touch_v<alloc_type>);
+    static_assert(std::is_same_v<STD_LA::detail::rebind_alloc_t<alloc_type, float>,
+                                 STD_LA::numa_allocator<float, P>>);
+
+    size_t const    n = 600;
+    drm_numa        a(n, n);
+    drv_numa        x(n);
+
+    assert(reinterpret_cast<uintptr_t>(a.engine().data()) % alloc_type::page_size == 0);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        for (size_t j = 0;  j < n;  ++j)
+        {
+            assert(a(i, j) == 0.0);
+            a(i, j) = double(i) - double(j);
+        }
+        x(i) = 1.0;
+    }
+
+    drm_numa    b = a;
+    auto        ax = b * x;
+
+    assert(b(17, 3) == 14.0  &&  b(n - 1, 0) == double(n - 1));
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        assert(ax(i) == double(n)*i - double(n*(n - 1)/2));
+    }
+}
+
+void t800()
+{
+    PRINT_FNAME();
+
+    TestNumaPlacement<STD_LA::numa_placement::partitioned>();
+    TestNumaPlacement<STD_LA::numa_placement::interleaved>();
+
+    //- Partitions are contiguous, page-aligned, and cover [0, n).
+    //
+    using alloc_type = STD_LA::numa_allocator<double>;
+
+    size_t const    page = alloc_type::page_size / sizeof(double);
+
+    for (size_t n : { size_t(1), size_t(1000), size_t(123457) })
+    {
+        for (size_t parts : { size_t(1), size_t(3), size_t(16) })
+        {
+            size_t  next = 0;
+
+            for (size_t k = 0;  k < parts;  ++k)
+            {
+                auto const  [b, e] = alloc_type::partition(n, parts, k);
+
+                assert(b == next  &&  b <= e  &&  (b % page == 0  ||  b == n));
+                next = e;
+            }
+            assert(next == n);
+        }
+    }
+
+    //- Matrix engines release their storage through the allocator.
+    //
+    {
+        STD_LA::dyn_matrix<double, counting_allocator<double>>  m(10, 20);
+        STD_LA::dyn_matrix<double, counting_allocator<double>>  c = m;
+
+        c.resize(30, 40);
+    }
+    assert(alloc_counts::allocated > 0  &&  alloc_counts::allocated == alloc_counts::deallocated);
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Huge-page allocation:  large buffers are aligned to the huge page size, small ones are not
+//  required to be, both are initialized correctly, and the allocator propagates to the results
+//  of arithmetic.
+//
+template<STD_LA::huge_page_source S>
+void
+TestHugePages()
+{
+    using alloc_type = STD_LA::huge_page_allocator<double, S>;
+    using drm_huge   = STD_LA::dyn_matrix<double, alloc_type>;
+    using drv_huge   = STD_LA::dyn_vector<double, alloc_type>;
+
+    size_t const    n = 600;
+    drm_huge        a(n, n);
+    drm_huge        s(4, 4);
+    drv_huge        x(n);
+
+    assert(alloc_type::uses_huge_pages(n*n)  &&  !alloc_type::uses_huge_pages(16));
+    assert(alloc_type::mapping_size(n*n) == 2*alloc_type::huge_page_size);
+    assert(reinterpret_cast<uintptr_t>(a.engine().data()) % alloc_type::huge_page_size == 0);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        for (size_t j = 0;  j < n;  ++j)
+        {
+            assert(a(i, j) == 0.0);
+            a(i, j) = (i == j) ? 2.0 : 0.0;
+        }
+        x(i) = double(i);
+    }
+
+    auto    aa = a * a;
+    auto    ax = a * x;
+    auto    ap = a + a;
+
+    static_assert(std::is_same_v<typename decltype(aa)::engine_type::allocator_type, alloc_type>);
+    static_assert(std::is_same_v<typename decltype(ax)::engine_type::allocator_type, alloc_type>);
+    static_assert(std::is_same_v<typename decltype(ap)::engine_type::allocator_type, alloc_type>);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        assert(aa(i, i) == 4.0  &&  ax(i) == 2.0*i  &&  ap(i, i) == 4.0);
+    }
+    s(3, 3) = 1.0;
+    assert(s(3, 3) == 1.0);
+}
+
+void t801()
+{
+    PRINT_FNAME();
+
+    TestHugePages<STD_LA::huge_page_source::transparent>();
+    TestHugePages<STD_LA::huge_page_source::hugetlb>();
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Shared-memory engines:  a segment can be opened only once published, a second process sees
+//  the published elements, and read-only objects take part in arithmetic with dense ones.
+//
+void t802()
+{
+    PRINT_FNAME();
+
+#ifdef LA_HAS_SHM_ENGINES
+    using drv_double = STD_LA::dyn_vector<double>;
+
+    std::string const   mname = "/la_test_m_" + std::to_string(::getpid());
+    std::string const   vname = "/la_test_v_" + std::to_string(::getpid());
+
+    STD_LA::remove_shared(mname.c_str());
+    STD_LA::remove_shared(vname.c_str());
+
+    size_t const    rows = 300, cols = 200;
+    auto            w  = STD_LA::create_shared_matrix<double>(mname.c_str(), rows, cols);
+    auto            wv = STD_LA::create_shared_vector<double>(vname.c_str(), cols);
+    bool            threw = false;
+
+    try
+    {
+        STD_LA::open_shared_matrix<double>(mname.c_str());
+    }
+    catch (std::runtime_error const&)
+    {
+        threw = true;
+    }
+    assert(threw);
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            assert(w(i, j) == 0.0);
+            w(i, j) = double(i) + 0.001*j;
+        }
+    }
+    for (size_t j = 0;  j < cols;  ++j)
+    {
+        wv(j) = 1.0;
+    }
+    w.engine().publish();
+    wv.engine().publish();
+
+    //- The element type must match.
+    //
+    threw = false;
+
+    try
+    {
+        STD_LA::open_shared_matrix<float>(mname.c_str());
+    }
+    catch (std::runtime_error const&)
+    {
+        threw = true;
+    }
+    assert(threw);
+
+    //- A worker process maps the published segments read-only.
+    //
+    pid_t const     pid = ::fork();
+
+    if (pid == 0)
+    {
+        auto    r  = STD_LA::open_shared_matrix<double>(mname.c_str());
+        auto    rv = STD_LA::open_shared_vector<double>(vname.c_str());
+        bool    ok = r.rows() == rows  &&  r.columns() == cols  &&  r(299, 199) == 299.199;
+
+        ok = ok  &&  rv.elements() == cols  &&  rv(5) == 1.0;
+        ::_exit(ok ? 0 : 1);
+    }
+
+    int     status = -1;
+
+    assert(pid > 0);
+    ::waitpid(pid, &status, 0);
+    assert(WIFEXITED(status)  &&  WEXITSTATUS(status) == 0);
+
+    auto        r  = STD_LA::open_shared_matrix<double>(mname.c_str());
+    auto        rv = STD_LA::open_shared_vector<double>(vname.c_str());
+    drv_double  x(cols);
+
+    static_assert(std::is_same_v<decltype(r)::engine_type::engine_category,
+                                 STD_LA::readable_matrix_engine_tag>);
+
+    for (size_t j = 0;  j < cols;  ++j)
+    {
+        x(j) = 1.0;
+    }
+
+    drv_double  rx  = r * x;
+    drv_double  rrv = r * rv;
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        double const    expect = cols*double(i) + 0.001*(cols*(cols - 1)/2);
+
+        assert(std::abs(rx(i) - expect) < 1.0e-9  &&  std::abs(rrv(i) - expect) < 1.0e-9);
+    }
+    assert(w(10, 10) == r(10, 10));
+
+    assert(STD_LA::remove_shared(mname.c_str()));
+    assert(STD_LA::remove_shared(vname.c_str()));
+    assert(r(7, 3) == 7.003);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Out-of-core multiplication:  file round trips, and agreement of the tiled, double-buffered
+//  product with the in-core product for tile sizes that do and do not divide the extents.
+//
+void t803()
+{
+    PRINT_FNAME();
+
+    using drm_double = STD_LA::dyn_matrix<double>;
+
+    size_t const    m = 70, k = 50, n = 90;
+    drm_double      a(m, k), b(k, n);
+
+    for (size_t i = 0;  i < m;  ++i)
+    {
+        for (size_t j = 0;  j < k;  ++j)
+        {
+            a(i, j) = std::sin(0.3*i + 0.7*j);
+        }
+    }
+    for (size_t i = 0;  i < k;  ++i)
+    {
+        for (size_t j = 0;  j < n;  ++j)
+        {
+            b(i, j) = std::cos(0.2*i - 0.5*j);
+        }
+    }
+
+    char const*     pa = "la_test_ooc_a.bin";
+    char const*     pb = "la_test_ooc_b.bin";
+    char const*     pc = "la_test_ooc_c.bin";
+
+    STD_LA::write_matrix_file<double>(pa, a);
+    STD_LA::write_matrix_file<double>(pb, b);
+    assert(STD_LA::read_matrix_file<double>(pa) == a);
+
+    drm_double  ab = a * b;
+
+    for (size_t tile : { size_t(16), size_t(25), size_t(1024) })
+    {
+        auto    fa = STD_LA::matrix_file<double>::open(pa);
+        auto    fb = STD_LA::matrix_file<double>::open(pb);
+        auto    fc = STD_LA::matrix_file<double>::create(pc, m, n);
+
+        STD_LA::out_of_core_multiply(fa, fb, fc, tile);
+
+        drm_double  c = STD_LA::read_matrix_file<double>(pc);
+        double      diff = 0;
+
+        for (size_t i = 0;  i < m;  ++i)
+        {
+            for (size_t j = 0;  j < n;  ++j)
+            {
+                diff = std::max(diff, std::abs(c(i, j) - ab(i, j)));
+            }
+        }
+        assert(diff < 1.0e-12);
+    }
+
+    bool    threw = false;
+
+    try
+    {
+        STD_LA::matrix_file<float>::open(pa);
+    }
+    catch (std::runtime_error const&)
+    {
+        threw = true;
+    }
+    assert(threw);
+
+    std::remove(pa);
+    std::remove(pb);
+    std::remove(pc);
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Scatter accumulation:  several threads assemble overlapping 2x2 element matrices, and single
+//  contributions, into one matrix; both modes agree with serial assembly.
+//
+void t804()
+{
+    PRINT_FNAME();
+
+    using drm_double = STD_LA::dyn_matrix<double>;
+
+    size_t const    n = 150, nthr = 4, nelem = 1000;
+    drm_double      expect(n, n);
+    drm_double      elem(2, 2);
+
+    elem(0, 0) = 1.0;  elem(0, 1) = -1.0;
+    elem(1, 0) = -1.0; elem(1, 1) = 2.0;
+
+    auto    element_nodes = [=](size_t e)
+                            {
+                                size_t const    a = (e*37) % (n - 1);
+                                return std::array<size_t, 2>{ a, a + 1 };
+                            };
+
+    for (size_t e = 0;  e < nelem;  ++e)
+    {
+        auto const  nodes = element_nodes(e);
+
+        for (size_t r = 0;  r < 2;  ++r)
+        {
+            for (size_t c = 0;  c < 2;  ++c)
+            {
+                expect(nodes[r], nodes[c]) += elem(r, c);
+            }
+        }
+        expect((e*101) % n, (e*7) % n) += 0.5;
+    }
+
+    for (auto mode : { STD_LA::accumulation_mode::privatized, STD_LA::accumulation_mode::locked })
+    {
+        drm_double  a(n, n);
+
+        STD_LA::scatter_accumulator     acc(a, nthr, mode);
+        std::vector<std::thread>        pool;
+
+        for (size_t k = 0;  k < nthr;  ++k)
+        {
+            pool.emplace_back([&, k]()
+                              {
+                                  for (size_t e = k;  e < nelem;  e += nthr)
+                                  {
+                                      auto const  nodes = element_nodes(e);
+
+                                      acc.add_block(k, nodes, nodes, elem);
+                                      acc.add(k, (e*101) % n, (e*7) % n, 0.5);
+                                  }
+                              });
+        }
+        for (auto& t : pool)
+        {
+            t.join();
+        }
+        acc.merge();
+        assert(a == expect);
+    }
+
+    bool    threw = false;
+
+    try
+    {
+        drm_double                      a(3, 3);
+        STD_LA::scatter_accumulator     acc(a, 1);
+
+        acc.add(0, 3, 0, 1.0);
+    }
+    catch (std::runtime_error const&)
+    {
+        threw = true;
+    }
+    assert(threw);
+}
+
+//--------------------------------------------------------------------------------------------------
+//- Request coalescing:  products submitted by several threads, against a dense matrix and against
+//  a transpose view of it, equal the direct products, and back-to-back submissions share batches.
+//
+void t805()
+{
+    PRINT_FNAME();
+
+    using drm_double = STD_LA::dyn_matrix<double>;
+    using drv_double = STD_LA::dyn_vector<double>;
+
+    size_t const    m = 120, n = 90, nthr = 4, nreq = 10;
+    drm_double      w(m, n);
+
+    for (size_t i = 0;  i < m;  ++i)
+    {
+        for (size_t j = 0;  j < n;  ++j)
+        {
+            w(i, j) = static_cast<double>((i*3 + j*5) % 7) - 3.0;
+        }
+    }
+
+    auto    make_x = [](size_t len, size_t r)
+                     {
+                         drv_double  x(len);
+
+                         for (size_t j = 0;  j < len;  ++j)
+                         {
+                             x(j) = static_cast<double>((j*r + 1) % 5) - 2.0;
+                         }
+                         return x;
+                     };
+
+    {
+        STD_LA::gemv_coalescer      co(w, 8, std::chrono::milliseconds(2));
+        std::vector<std::thread>    pool;
+
+        for (size_t k = 0;  k < nthr;  ++k)
+        {
+            pool.emplace_back([&, k]()
+                              {
+                                  for (size_t r = k;  r < nthr*nreq;  r += nthr)
+                                  {
+                                      drv_double const    x = make_x(n, r);
+
+                                      assert(co.submit(x).get() == w * x);
+                                  }
+                              });
+        }
+        for (auto& t : pool)
+        {
+            t.join();
+        }
+        assert(co.requests() == nthr*nreq);
+    }
+
+    //- With a window that cannot elapse, a batch is formed only when max_batch requests are
+    //  waiting; destroying the coalescer completes the rest.
+    //
+    auto                                    wt = w.t();
+    std::vector<std::future<drv_double>>    results;
+
+    {
+        STD_LA::gemv_coalescer  co(wt, 8, std::chrono::hours(1));
+
+        for (size_t r = 0;  r < 20;  ++r)
+        {
+            results.push_back(co.submit(make_x(m, r)));
+        }
+        for (size_t r = 0;  r < 16;  ++r)
+        {
+            assert(results[r].get() == wt * make_x(m, r));
+        }
+        assert(co.batches() == 2);
+    }
+    for (size_t r = 16;  r < 20;  ++r)
+    {
+        assert(results[r].get() == wt * make_x(m, r));
+    }
+
+    bool    threw = false;
+
+    try
+    {
+        STD_LA::gemv_coalescer  co(w);
+
+        co.submit(drv_double(n + 1));
+    }
+    catch (std::runtime_error const&)
+    {
+        threw = true;
+    }
+    assert(threw);
+}
+
+void
+TestGroup80()
+{
+    PRINT_FNAME();
+
+    t800();
+    t801();
+    t802();
+    t803();
+    t804();
+    t805();
+}